@@ -17,7 +17,10 @@
 */
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
+#include "unicode/uset.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "cmemory.h"
@@ -26,8 +29,8 @@
 
 U_NAMESPACE_BEGIN
 
-BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
-        list(parentList), listLength(parentListLength) {
+BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength, uint32_t freezeOptions) :
+        list(parentList), listLength(parentListLength), trie(NULL), trieMemory(NULL) {
     uprv_memset(latin1Contains, 0, sizeof(latin1Contains));
     uprv_memset(table7FF, 0, sizeof(table7FF));
     uprv_memset(bmpBlockBits, 0, sizeof(bmpBlockBits));
@@ -49,18 +52,73 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
 
     initBits();
     overrideIllegal();
+    usimd_initASCIISet(&asciiSet, latin1Contains);
+
+    if((freezeOptions&USET_FREEZE_CODE_POINT_TRIE)!=0) {
+        buildTrie();
+    }
 }
 
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
+        asciiSet(otherBMPSet.asciiSet),
         containsFFFD(otherBMPSet.containsFFFD),
-        list(newParentList), listLength(newParentListLength) {
+        list(newParentList), listLength(newParentListLength), trie(NULL), trieMemory(NULL) {
     uprv_memcpy(latin1Contains, otherBMPSet.latin1Contains, sizeof(latin1Contains));
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
+    if(otherBMPSet.trie!=NULL) {
+        copyTrie(otherBMPSet.trie);
+    }
 }
 
 BMPSet::~BMPSet() {
+    ucptrie_close(trie);
+    uprv_free(trieMemory);
+}
+
+void BMPSet::buildTrie() {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UMutableCPTrie *mutableTrie=umutablecptrie_open(0, 0, &errorCode);
+    // The list ends with 0x110000, either as the limit of the last range
+    // or as an extra terminator.
+    for(int32_t i=0; (i+1)<listLength && U_SUCCESS(errorCode); i+=2) {
+        umutablecptrie_setRange(mutableTrie, list[i], list[i+1]-1, 1, &errorCode);
+    }
+    trie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_8, &errorCode);
+    umutablecptrie_close(mutableTrie);
+    if(U_FAILURE(errorCode)) {
+        // Fall back to the binary searches.
+        ucptrie_close(trie);
+        trie=NULL;
+    }
+}
+
+/*
+ * Copies the other set's trie via its serialized form,
+ * which is a plain memory copy rather than a rebuild.
+ */
+void BMPSet::copyTrie(const UCPTrie *otherTrie) {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t length=ucptrie_toBinary(otherTrie, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR) {
+        return;
+    }
+    trieMemory=uprv_malloc(length);
+    if(trieMemory==NULL) {
+        // Fall back to the binary searches.
+        return;
+    }
+    errorCode=U_ZERO_ERROR;
+    ucptrie_toBinary(otherTrie, trieMemory, length, &errorCode);
+    trie=ucptrie_openFromBinary(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_8,
+                                trieMemory, length, NULL, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        ucptrie_close(trie);
+        trie=NULL;
+        uprv_free(trieMemory);
+        trieMemory=NULL;
+    }
 }
 
 /*
@@ -315,6 +373,97 @@ BMPSet::contains(UChar32 c) const {
     }
 }
 
+// Overloads for the templates below.
+
+static inline int32_t
+asciiBlockSpan(const uint8_t *s, int32_t length, const USimdASCIISet &set, UBool contained) {
+    return usimd_u8ASCIISpan(s, length, &set, contained);
+}
+
+static inline int32_t
+asciiBlockSpan(const UChar *s, int32_t length, const USimdASCIISet &set, UBool contained) {
+    return usimd_u16ASCIISpan(s, length, &set, contained);
+}
+
+static inline int32_t
+asciiBlockSpanBack(const uint8_t *s, int32_t length, const USimdASCIISet &set, UBool contained) {
+    return usimd_u8ASCIISpanBack(s, length, &set, contained);
+}
+
+static inline int32_t
+asciiBlockSpanBack(const UChar *s, int32_t length, const USimdASCIISet &set, UBool contained) {
+    return usimd_u16ASCIISpanBack(s, length, &set, contained);
+}
+
+/*
+ * Number of code units in an ASCII run that are tested one at a time
+ * before the rest of the run is tested a block at a time.
+ * Most runs in text are shorter than this, and for them
+ * the setup of a block test would cost more than it saves.
+ */
+static const int32_t ASCII_SCALAR_RUN_LENGTH=16;
+
+/*
+ * In UTF-16 text, a run of Latin-1 characters pauses for block tests
+ * after increasing numbers of units (up to this many)
+ * while block tests find only short ASCII runs.
+ */
+static const int32_t ASCII_MAX_PAUSE_LENGTH=0x10000;
+
+/*
+ * Returns where the one-unit-at-a-time loop over an ASCII run from s
+ * pauses to test the rest of the run a block at a time, or limit.
+ */
+template<typename Unit>
+static inline const Unit *
+asciiRunPause(const Unit *s, const Unit *limit, int32_t pauseLength=ASCII_SCALAR_RUN_LENGTH) {
+    return (limit-s)>pauseLength ? s+pauseLength : limit;
+}
+
+/* Same as asciiRunPause() but backward from limit. */
+template<typename Unit>
+static inline const Unit *
+asciiRunPauseBack(const Unit *s, const Unit *limit, int32_t pauseLength=ASCII_SCALAR_RUN_LENGTH) {
+    return (limit-s)>pauseLength ? limit-pauseLength : s;
+}
+
+/*
+ * Returns the end of a long run of ASCII code units from s
+ * for which latin1Contains[unit]==contained.
+ */
+template<typename Unit, UBool contained>
+static inline const Unit *
+spanLongASCIIRun(const Unit *s, const Unit *limit,
+                 const UBool latin1Contains[], const USimdASCIISet &asciiSet) {
+    if(asciiSet.rangeCount>=0) {
+        s+=asciiBlockSpan(s, (int32_t)(limit-s), asciiSet, contained);
+    }
+    // Fewer than one block remain, or s is at the end of the run.
+    Unit c;
+    while(s<limit && (c=*s)<0x80 && latin1Contains[c]==contained) {
+        ++s;
+    }
+    return s;
+}
+
+/*
+ * Returns the start of a long run of ASCII code units before limit (and not before s)
+ * for which latin1Contains[unit]==contained.
+ */
+template<typename Unit, UBool contained>
+static inline const Unit *
+spanBackLongASCIIRun(const Unit *s, const Unit *limit,
+                     const UBool latin1Contains[], const USimdASCIISet &asciiSet) {
+    if(asciiSet.rangeCount>=0) {
+        limit-=asciiBlockSpanBack(s, (int32_t)(limit-s), asciiSet, contained);
+    }
+    Unit c;
+    while(s<limit && (c=*(limit-1))<0x80 && latin1Contains[c]==contained) {
+        --limit;
+    }
+    return limit;
+}
+
 /*
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
@@ -322,16 +471,46 @@ BMPSet::contains(UChar32 c) const {
 const UChar *
 BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
     UChar c, c2;
+    int32_t pauseLength=ASCII_SCALAR_RUN_LENGTH;
 
     if(spanCondition) {
         // span
         do {
             c=*s;
             if(c<=0xff) {
-                if(!latin1Contains[c]) {
-                    break;
+                // Run of Latin-1 characters
+                for(;;) {
+                    const UChar *pause=asciiRunPause(s, limit, pauseLength);
+                    do {
+                        if(!latin1Contains[c]) {
+                            return s;
+                        } else if(++s==pause) {
+                            break;
+                        }
+                        c=*s;
+                    } while(c<=0xff);
+                    if(s!=pause) {
+                        break;
+                    } else if(s==limit) {
+                        return s;
+                    }
+                    // Long run: Continue with its ASCII characters.
+                    const UChar *runLimit=spanLongASCIIRun<UChar, TRUE>(s, limit, latin1Contains, asciiSet);
+                    if((runLimit-s)<pauseLength && pauseLength<ASCII_MAX_PAUSE_LENGTH) {
+                        // Few long ASCII runs: Test blocks less often.
+                        pauseLength*=4;
+                    }
+                    s=runLimit;
+                    if(s==limit) {
+                        return s;
+                    }
+                    c=*s;
+                    if(c>0xff) {
+                        break;
+                    }
                 }
-            } else if(c<=0x7ff) {
+            }
+            if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))==0) {
                     break;
                 }
@@ -368,10 +547,39 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
         do {
             c=*s;
             if(c<=0xff) {
-                if(latin1Contains[c]) {
-                    break;
+                // Run of Latin-1 characters
+                for(;;) {
+                    const UChar *pause=asciiRunPause(s, limit, pauseLength);
+                    do {
+                        if(latin1Contains[c]) {
+                            return s;
+                        } else if(++s==pause) {
+                            break;
+                        }
+                        c=*s;
+                    } while(c<=0xff);
+                    if(s!=pause) {
+                        break;
+                    } else if(s==limit) {
+                        return s;
+                    }
+                    // Long run: Continue with its ASCII characters.
+                    const UChar *runLimit=spanLongASCIIRun<UChar, FALSE>(s, limit, latin1Contains, asciiSet);
+                    if((runLimit-s)<pauseLength && pauseLength<ASCII_MAX_PAUSE_LENGTH) {
+                        // Few long ASCII runs: Test blocks less often.
+                        pauseLength*=4;
+                    }
+                    s=runLimit;
+                    if(s==limit) {
+                        return s;
+                    }
+                    c=*s;
+                    if(c>0xff) {
+                        break;
+                    }
                 }
-            } else if(c<=0x7ff) {
+            }
+            if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))!=0) {
                     break;
                 }
@@ -411,16 +619,46 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
 const UChar *
 BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
     UChar c, c2;
+    int32_t pauseLength=ASCII_SCALAR_RUN_LENGTH;
 
     if(spanCondition) {
         // span
         for(;;) {
             c=*(--limit);
             if(c<=0xff) {
-                if(!latin1Contains[c]) {
-                    break;
+                // Run of Latin-1 characters
+                for(;;) {
+                    const UChar *pause=asciiRunPauseBack(s, limit, pauseLength);
+                    do {
+                        if(!latin1Contains[c]) {
+                            return limit+1;
+                        } else if(limit==pause) {
+                            break;
+                        }
+                        c=*(--limit);
+                    } while(c<=0xff);
+                    if(c>0xff) {
+                        break;
+                    } else if(limit==s) {
+                        return s;
+                    }
+                    // Long run: *limit is in the span. Continue with its ASCII characters.
+                    const UChar *runStart=spanBackLongASCIIRun<UChar, TRUE>(s, limit, latin1Contains, asciiSet);
+                    if((limit-runStart)<pauseLength && pauseLength<ASCII_MAX_PAUSE_LENGTH) {
+                        // Few long ASCII runs: Test blocks less often.
+                        pauseLength*=4;
+                    }
+                    limit=runStart;
+                    if(limit==s) {
+                        return s;
+                    }
+                    c=*(--limit);
+                    if(c>0xff) {
+                        break;
+                    }
                 }
-            } else if(c<=0x7ff) {
+            }
+            if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))==0) {
                     break;
                 }
@@ -460,10 +698,39 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
         for(;;) {
             c=*(--limit);
             if(c<=0xff) {
-                if(latin1Contains[c]) {
-                    break;
+                // Run of Latin-1 characters
+                for(;;) {
+                    const UChar *pause=asciiRunPauseBack(s, limit, pauseLength);
+                    do {
+                        if(latin1Contains[c]) {
+                            return limit+1;
+                        } else if(limit==pause) {
+                            break;
+                        }
+                        c=*(--limit);
+                    } while(c<=0xff);
+                    if(c>0xff) {
+                        break;
+                    } else if(limit==s) {
+                        return s;
+                    }
+                    // Long run: *limit is in the span. Continue with its ASCII characters.
+                    const UChar *runStart=spanBackLongASCIIRun<UChar, FALSE>(s, limit, latin1Contains, asciiSet);
+                    if((limit-runStart)<pauseLength && pauseLength<ASCII_MAX_PAUSE_LENGTH) {
+                        // Few long ASCII runs: Test blocks less often.
+                        pauseLength*=4;
+                    }
+                    limit=runStart;
+                    if(limit==s) {
+                        return s;
+                    }
+                    c=*(--limit);
+                    if(c>0xff) {
+                        break;
+                    }
                 }
-            } else if(c<=0x7ff) {
+            }
+            if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))!=0) {
                     break;
                 }
@@ -512,21 +779,41 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     uint8_t b=*s;
     if(U8_IS_SINGLE(b)) {
         // Initial all-ASCII span.
+        const uint8_t *pause=asciiRunPause(s, limit);
         if(spanCondition) {
             do {
-                if(!latin1Contains[b] || ++s==limit) {
+                if(!latin1Contains[b]) {
                     return s;
+                } else if(++s==pause) {
+                    break;
                 }
                 b=*s;
             } while(U8_IS_SINGLE(b));
         } else {
             do {
-                if(latin1Contains[b] || ++s==limit) {
+                if(latin1Contains[b]) {
                     return s;
+                } else if(++s==pause) {
+                    break;
                 }
                 b=*s;
             } while(U8_IS_SINGLE(b));
         }
+        if(s==pause) {
+            if(s==limit) {
+                return s;
+            }
+            s=spanCondition ?
+                spanLongASCIIRun<uint8_t, TRUE>(s, limit, latin1Contains, asciiSet) :
+                spanLongASCIIRun<uint8_t, FALSE>(s, limit, latin1Contains, asciiSet);
+            if(s==limit) {
+                return s;
+            }
+            b=*s;
+            if(U8_IS_SINGLE(b)) {
+                return s;
+            }
+        }
         length=(int32_t)(limit-s);
     }
 
@@ -578,12 +865,13 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         b=*s;
         if(U8_IS_SINGLE(b)) {
             // ASCII
+            const uint8_t *pause=asciiRunPause(s, limit);
             if(spanCondition) {
                 do {
                     if(!latin1Contains[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==pause) {
+                        break;
                     }
                     b=*s;
                 } while(U8_IS_SINGLE(b));
@@ -591,12 +879,27 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 do {
                     if(latin1Contains[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==pause) {
+                        break;
                     }
                     b=*s;
                 } while(U8_IS_SINGLE(b));
             }
+            if(s==pause) {
+                if(s==limit) {
+                    return limit0;
+                }
+                s=spanCondition ?
+                    spanLongASCIIRun<uint8_t, TRUE>(s, limit, latin1Contains, asciiSet) :
+                    spanLongASCIIRun<uint8_t, FALSE>(s, limit, latin1Contains, asciiSet);
+                if(s==limit) {
+                    return limit0;
+                }
+                b=*s;
+                if(U8_IS_SINGLE(b)) {
+                    return s;
+                }
+            }
         }
         ++s;  // Advance past the lead byte.
         if(b>=0xe0) {
@@ -683,12 +986,13 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
         b=s[--length];
         if(U8_IS_SINGLE(b)) {
             // ASCII sub-span
+            int32_t pause=(int32_t)(asciiRunPauseBack(s, s+length)-s);
             if(spanCondition) {
                 do {
                     if(!latin1Contains[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==pause) {
+                        break;
                     }
                     b=s[--length];
                 } while(U8_IS_SINGLE(b));
@@ -696,12 +1000,28 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 do {
                     if(latin1Contains[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==pause) {
+                        break;
                     }
                     b=s[--length];
                 } while(U8_IS_SINGLE(b));
             }
+            if(U8_IS_SINGLE(b)) {
+                // Paused: s[length] is in the span.
+                if(length==0) {
+                    return 0;
+                }
+                length=(int32_t)((spanCondition ?
+                    spanBackLongASCIIRun<uint8_t, TRUE>(s, s+length, latin1Contains, asciiSet) :
+                    spanBackLongASCIIRun<uint8_t, FALSE>(s, s+length, latin1Contains, asciiSet))-s);
+                if(length==0) {
+                    return 0;
+                }
+                b=s[--length];
+                if(U8_IS_SINGLE(b)) {
+                    return length+1;
+                }
+            }
         }
 
         int32_t prev=length;
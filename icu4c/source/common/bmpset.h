@@ -20,7 +20,9 @@
 #define __BMPSET_H__
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -34,10 +36,16 @@ U_NAMESPACE_BEGIN
  *                    with mixed for illegal ranges.
  * Supplementary characters: Binary search over
  * the supplementary part of the parent set's inversion list.
+ *
+ * Runs of ASCII characters are spanned 16 bytes or 8 UChars at a time
+ * if the set's ASCII characters form few enough ranges.
+ *
+ * If requested via freeze options, a UCPTrie with one byte per code point
+ * replaces the binary searches for mixed BMP blocks and supplementary code points.
  */
 class BMPSet : public UMemory {
 public:
-    BMPSet(const int32_t *parentList, int32_t parentListLength);
+    BMPSet(const int32_t *parentList, int32_t parentListLength, uint32_t freezeOptions);
     BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength);
     virtual ~BMPSet();
 
@@ -74,6 +82,8 @@ class BMPSet : public UMemory {
 private:
     void initBits();
     void overrideIllegal();
+    void buildTrie();
+    void copyTrie(const UCPTrie *otherTrie);
 
     /**
      * Same as UnicodeSet::findCodePoint(UChar32 c) const except that the
@@ -101,6 +111,12 @@ class BMPSet : public UMemory {
      */
     UBool latin1Contains[0x100];
 
+    /*
+     * The ASCII characters of the set as ranges, for vectorized spans.
+     * Not used if asciiSet.rangeCount<0.
+     */
+    USimdASCIISet asciiSet;
+
     /* TRUE if contains(U+FFFD). */
     UBool containsFFFD;
 
@@ -153,9 +169,24 @@ class BMPSet : public UMemory {
      */
     const int32_t *list;
     int32_t listLength;
+
+    /*
+     * Optional fast-type UCPTrie with 8-bit values, 1 for code points in the set.
+     * If not NULL, then containsSlow() looks up the trie instead of
+     * doing a binary search over the list.
+     */
+    UCPTrie *trie;
+    /*
+     * Serialized trie data owned by a copy; NULL if the trie was built
+     * by this set or there is no trie.
+     */
+    void *trieMemory;
 };
 
 inline UBool BMPSet::containsSlow(UChar32 c, int32_t lo, int32_t hi) const {
+    if(trie!=NULL) {
+        return (UBool)UCPTRIE_FAST_GET(trie, UCPTRIE_8, c);
+    }
     return (UBool)(findCodePoint(c, lo, hi) & 1);
 }
 
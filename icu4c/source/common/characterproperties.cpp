@@ -338,3 +338,37 @@ u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode) {
     }
     return map;
 }
+
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValues(const UChar *s, int32_t length, UProperty which,
+                       int32_t *values, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap(which, pErrorCode));
+    // Property values are not negative.
+    return ucptrie_getStringValues(trie, s, length, reinterpret_cast<uint32_t *>(values), pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValuesUTF8(const char *s, int32_t length, UProperty which,
+                           int32_t *values, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap(which, pErrorCode));
+    return ucptrie_getStringValuesUTF8(trie, s, length,
+                                       reinterpret_cast<uint32_t *>(values), pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertySpans(const UChar *s, int32_t length, UProperty which,
+                      int32_t *limits, int32_t *values, int32_t capacity,
+                      UErrorCode *pErrorCode) {
+    const UCPTrie *trie = reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap(which, pErrorCode));
+    return ucptrie_getStringSpans(trie, s, length, limits,
+                                  reinterpret_cast<uint32_t *>(values), capacity, pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertySpansUTF8(const char *s, int32_t length, UProperty which,
+                          int32_t *limits, int32_t *values, int32_t capacity,
+                          UErrorCode *pErrorCode) {
+    const UCPTrie *trie = reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap(which, pErrorCode));
+    return ucptrie_getStringSpansUTF8(trie, s, length, limits,
+                                      reinterpret_cast<uint32_t *>(values), capacity, pErrorCode);
+}
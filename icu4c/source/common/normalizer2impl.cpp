@@ -40,12 +40,44 @@
 #include "uassert.h"
 #include "ucptrie_impl.h"
 #include "uset_imp.h"
+#include "usimd.h"
 #include "uvector.h"
 
 U_NAMESPACE_BEGIN
 
 namespace {
 
+// Block-at-a-time skipping of code units below the normalization thresholds.
+//     Can be turned off at build time with -DU_NORMALIZER2_BLOCK_SKIP=0,
+//     to compare performance without it (see simplenormperf).
+#ifndef U_NORMALIZER2_BLOCK_SKIP
+#   define U_NORMALIZER2_BLOCK_SKIP 1
+#endif
+
+/**
+ * Skips the rest of a run of code units below the minimum a block at a time.
+ * Returns src, or the first unit at or above the minimum.
+ */
+inline const UChar *skipBelow(const UChar *src, const UChar *limit, UChar minCP) {
+#if U_NORMALIZER2_BLOCK_SKIP
+    return src+usimd_u16PrefixBelow(src, (int32_t)(limit-src), minCP);
+#else
+    (void)limit;
+    (void)minCP;
+    return src;
+#endif
+}
+
+inline const uint8_t *skipBelow(const uint8_t *src, const uint8_t *limit, uint8_t minLead) {
+#if U_NORMALIZER2_BLOCK_SKIP
+    return src+usimd_u8PrefixBelow(src, (int32_t)(limit-src), minLead);
+#else
+    (void)limit;
+    (void)minLead;
+    return src;
+#endif
+}
+
 /**
  * UTF-8 lead byte for minNoMaybeCP.
  * Can be lower than the actual lead byte for c.
@@ -607,9 +639,11 @@ Normalizer2Impl::decompose(const UChar *src, const UChar *limit,
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
         for(prevSrc=src; src!=limit;) {
-            if( (c=*src)<minNoCP ||
-                isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if((c=*src)<minNoCP) {
+                // Skip the rest of a run of code units below the minimum a block at a time.
+                ++src;
+                src=skipBelow(src, limit, (UChar)minNoCP);
+            } else if(isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else if(!U16_IS_LEAD(c)) {
                 break;
@@ -732,9 +766,12 @@ UBool Normalizer2Impl::decompose(UChar32 c, uint16_t norm16,
     return buffer.append((const UChar *)mapping+1, length, TRUE, leadCC, trailCC, errorCode);
 }
 
+// Decomposes [src, limit[ into the buffer.
+// Unless stopAt is STOP_AT_LIMIT, stops at the first composition or
+// decomposition boundary and returns where it stopped.
 const uint8_t *
 Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
-                                UBool stopAtCompBoundary, UBool onlyContiguous,
+                                StopAt stopAt, UBool onlyContiguous,
                                 ReorderingBuffer &buffer, UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) {
         return nullptr;
@@ -747,21 +784,28 @@ Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
         UChar32 c = U_SENTINEL;
         if (norm16 >= limitNoNo) {
             if (isMaybeOrNonZeroCC(norm16)) {
-                // No boundaries around this character.
+                // No comp boundaries around this character.
+                uint8_t cc = getCCFromYesOrMaybe(norm16);
+                if (cc == 0 && stopAt == STOP_AT_DECOMP_BOUNDARY) {
+                    return prevSrc;
+                }
                 c = codePointFromValidUTF8(prevSrc, src);
-                if (!buffer.append(c, getCCFromYesOrMaybe(norm16), errorCode)) {
+                if (!buffer.append(c, cc, errorCode)) {
                     return nullptr;
                 }
+                if (stopAt == STOP_AT_DECOMP_BOUNDARY && buffer.getLastCC() <= 1) {
+                    return src;
+                }
                 continue;
             }
             // Maps to an isCompYesAndZeroCC.
-            if (stopAtCompBoundary) {
+            if (stopAt != STOP_AT_LIMIT) {
                 return prevSrc;
             }
             c = codePointFromValidUTF8(prevSrc, src);
             c = mapAlgorithmic(c, norm16);
             norm16 = getRawNorm16(c);
-        } else if (stopAtCompBoundary && norm16 < minNoNoCompNoMaybeCC) {
+        } else if (stopAt != STOP_AT_LIMIT && norm16 < minNoNoCompNoMaybeCC) {
             return prevSrc;
         }
         // norm16!=INERT guarantees that [prevSrc, src[ is valid UTF-8.
@@ -799,17 +843,141 @@ Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
             } else {
                 leadCC = 0;
             }
+            if (leadCC == 0 && stopAt == STOP_AT_DECOMP_BOUNDARY) {
+                return prevSrc;
+            }
             if (!buffer.append((const char16_t *)mapping+1, length, TRUE, leadCC, trailCC, errorCode)) {
                 return nullptr;
             }
         }
-        if (stopAtCompBoundary && norm16HasCompBoundaryAfter(norm16, onlyContiguous)) {
+        if ((stopAt == STOP_AT_COMP_BOUNDARY && norm16HasCompBoundaryAfter(norm16, onlyContiguous)) ||
+                (stopAt == STOP_AT_DECOMP_BOUNDARY && buffer.getLastCC() <= 1)) {
             return src;
         }
     }
     return src;
 }
 
+// Dual functionality:
+// sink!=nullptr: normalize
+// sink==nullptr: isNormalized/spanQuickCheckYes
+const uint8_t *
+Normalizer2Impl::decomposeUTF8(uint32_t options,
+                               const uint8_t *src, const uint8_t *limit,
+                               ByteSink *sink, Edits *edits, UErrorCode &errorCode) const {
+    U_ASSERT(limit != nullptr);
+    UnicodeString s16;
+    uint8_t minNoLead = leadByteForCP(minDecompNoCP);
+    const uint8_t *prevBoundary = src;
+    // only for quick check
+    uint8_t prevCC = 0;
+
+    for (;;) {
+        // Fast path: Scan over a sequence of characters below the minimum "no" code point,
+        // or with (decompYes && ccc==0) properties.
+        const uint8_t *fastStart = src;
+        const uint8_t *prevSrc;
+        uint16_t norm16 = 0;
+        for (;;) {
+            if (src == limit) {
+                if (prevBoundary != limit && sink != nullptr) {
+                    ByteSinkUtil::appendUnchanged(prevBoundary, limit,
+                                                  *sink, options, edits, errorCode);
+                }
+                return src;
+            }
+            if (*src < minNoLead) {
+                // Skip the rest of a run of bytes below the minimum a block at a time.
+                ++src;
+                src = skipBelow(src, limit, minNoLead);
+            } else {
+                prevSrc = src;
+                UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+                if (!isMostDecompYesAndZeroCC(norm16)) {
+                    break;
+                }
+            }
+        }
+
+        // The current character at [prevSrc, src[ decomposes, or it has ccc!=0,
+        // or it is one of the rare maybeYes characters with ccc==0.
+        if (prevSrc != fastStart) {
+            // The fast path looped over yes/0 characters before the current one.
+            if (sink != nullptr &&
+                    !ByteSinkUtil::appendUnchanged(prevBoundary, prevSrc,
+                                                   *sink, options, edits, errorCode)) {
+                break;
+            }
+            prevBoundary = prevSrc;
+            prevCC = 0;
+        }
+
+        // Medium-fast path: Quick check.
+        if (isMaybeOrNonZeroCC(norm16)) {
+            // Does not decompose.
+            uint8_t cc = getCCFromYesOrMaybe(norm16);
+            if (prevCC <= cc || cc == 0) {
+                prevCC = cc;
+                if (cc <= 1) {
+                    if (sink != nullptr &&
+                            !ByteSinkUtil::appendUnchanged(prevBoundary, src,
+                                                           *sink, options, edits, errorCode)) {
+                        break;
+                    }
+                    prevBoundary = src;
+                }
+                continue;
+            }
+        }
+        if (sink == nullptr) {
+            return prevBoundary;  // quick check: "no" or cc out of order
+        }
+
+        // Slow path: Decompose up to and including the current character,
+        // and then until the next boundary.
+        if (prevBoundary != prevSrc && norm16HasDecompBoundaryBefore(norm16)) {
+            if (!ByteSinkUtil::appendUnchanged(prevBoundary, prevSrc,
+                                               *sink, options, edits, errorCode)) {
+                break;
+            }
+            prevBoundary = prevSrc;
+        }
+        ReorderingBuffer buffer(*this, s16, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        decomposeShort(prevBoundary, src, STOP_AT_LIMIT, FALSE /* onlyContiguous */,
+                       buffer, errorCode);
+        if (buffer.getLastCC() > 1) {
+            src = decomposeShort(src, limit, STOP_AT_DECOMP_BOUNDARY, FALSE /* onlyContiguous */,
+                                 buffer, errorCode);
+        }
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        if ((src - prevBoundary) > INT32_MAX) {  // guard before buffer.equals()
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            break;
+        }
+        // A character that decomposes always changes the text;
+        // otherwise only reordering might have changed it.
+        if (isMaybeOrNonZeroCC(norm16) && buffer.equals(prevBoundary, src)) {
+            if (!ByteSinkUtil::appendUnchanged(prevBoundary, src,
+                                               *sink, options, edits, errorCode)) {
+                break;
+            }
+        } else {
+            if (!ByteSinkUtil::appendChange(prevBoundary, src, buffer.getStart(), buffer.length(),
+                                            *sink, edits, errorCode)) {
+                break;
+            }
+        }
+        prevBoundary = src;
+        prevCC = 0;
+    }
+    return src;
+}
+
 const UChar *
 Normalizer2Impl::getDecomposition(UChar32 c, UChar buffer[4], int32_t &length) const {
     uint16_t norm16;
@@ -1340,9 +1508,11 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
                 }
                 return TRUE;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if((c=*src)<minNoMaybeCP) {
+                // Skip the rest of a run of code units below the minimum a block at a time.
+                ++src;
+                src=skipBelow(src, limit, (UChar)minNoMaybeCP);
+            } else if(isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1601,9 +1771,11 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
             if(src==limit) {
                 return src;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if((c=*src)<minNoMaybeCP) {
+                // Skip the rest of a run of code units below the minimum a block at a time.
+                ++src;
+                src=skipBelow(src, limit, (UChar)minNoMaybeCP);
+            } else if(isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1753,7 +1925,9 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
                 return TRUE;
             }
             if (*src < minNoMaybeLead) {
+                // Skip the rest of a run of bytes below the minimum a block at a time.
                 ++src;
+                src = skipBelow(src, limit, minNoMaybeLead);
             } else {
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
@@ -1955,10 +2129,10 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
             break;
         }
         // We know there is not a boundary here.
-        decomposeShort(prevSrc, src, FALSE /* !stopAtCompBoundary */, onlyContiguous,
+        decomposeShort(prevSrc, src, STOP_AT_LIMIT, onlyContiguous,
                        buffer, errorCode);
         // Decompose until the next boundary.
-        src = decomposeShort(src, limit, TRUE /* stopAtCompBoundary */, onlyContiguous,
+        src = decomposeShort(src, limit, STOP_AT_COMP_BOUNDARY, onlyContiguous,
                              buffer, errorCode);
         if (U_FAILURE(errorCode)) {
             break;
@@ -2165,8 +2339,9 @@ Normalizer2Impl::makeFCD(const UChar *src, const UChar *limit,
         // count code units with lccc==0
         for(prevSrc=src; src!=limit;) {
             if((c=*src)<minLcccCP) {
-                prevFCD16=~c;
                 ++src;
+                src=skipBelow(src, limit, (UChar)minLcccCP);
+                prevFCD16=~*(src-1);
             } else if(!singleLeadMightHaveNonZeroFCD16(c)) {
                 prevFCD16=0;
                 ++src;
@@ -2300,6 +2475,120 @@ void Normalizer2Impl::makeFCDAndAppend(const UChar *src, const UChar *limit,
     }
 }
 
+// Returns the FCD value of the code point at [cpStart, cpLimit[
+// which has the norm16 value from the UTF-8 trie macros.
+uint16_t Normalizer2Impl::getFCD16FromNorm16(const uint8_t *cpStart, const uint8_t *cpLimit,
+                                             uint16_t norm16) const {
+    // Also avoids decoding ill-formed sequences, which yield norm16==INERT.
+    if (isMostDecompYesAndZeroCC(norm16)) {
+        return 0;
+    }
+    return getFCD16(codePointFromValidUTF8(cpStart, cpLimit));
+}
+
+// Dual functionality:
+// sink!=nullptr: normalize
+// sink==nullptr: isNormalized/spanQuickCheckYes
+const uint8_t *
+Normalizer2Impl::makeFCDUTF8(uint32_t options,
+                             const uint8_t *src, const uint8_t *limit,
+                             ByteSink *sink, Edits *edits, UErrorCode &errorCode) const {
+    U_ASSERT(limit != nullptr);
+    UnicodeString s16;
+    uint8_t minLcccLead = leadByteForCP(minLcccCP);
+    // Tracks the last FCD-safe boundary, before lccc=0 or after properly-ordered tccc<=1.
+    // Text from here to the current character has not been written to the sink yet.
+    const uint8_t *prevBoundary = src;
+    // FCD value of the character before the current one
+    // if that was not handled by the fast path.
+    uint16_t prevFCD16 = 0;
+
+    for (;;) {
+        // Fast path: Scan over a sequence of characters with lccc==0.
+        const uint8_t *fastStart = src;
+        const uint8_t *prevSrc;
+        uint16_t norm16 = 0;
+        uint16_t fcd16 = 0;
+        for (;;) {
+            if (src == limit) {
+                if (prevBoundary != limit && sink != nullptr) {
+                    ByteSinkUtil::appendUnchanged(prevBoundary, limit,
+                                                  *sink, options, edits, errorCode);
+                }
+                return src;
+            }
+            if (*src < minLcccLead) {
+                ++src;
+                src = skipBelow(src, limit, minLcccLead);
+            } else {
+                prevSrc = src;
+                UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+                if ((fcd16 = getFCD16FromNorm16(prevSrc, src, norm16)) > 0xff) {
+                    break;
+                }
+            }
+        }
+
+        // The current character at [prevSrc, src[ has a non-zero lead combining class.
+        if (prevSrc != fastStart) {
+            // The fast path looped over characters with lccc==0.
+            // There is a boundary before the last one of them,
+            // and also after it if its tccc<=1.
+            const uint8_t *p = prevSrc;
+            UCPTRIE_FAST_U8_PREV(normTrie, UCPTRIE_16, fastStart, p, norm16);
+            prevFCD16 = getFCD16FromNorm16(p, prevSrc, norm16);
+            if (prevFCD16 <= 1) {
+                p = prevSrc;
+            }
+            if (sink != nullptr &&
+                    !ByteSinkUtil::appendUnchanged(prevBoundary, p,
+                                                   *sink, options, edits, errorCode)) {
+                break;
+            }
+            prevBoundary = p;
+        }
+
+        // Check for proper order, and decompose locally if necessary.
+        if ((prevFCD16 & 0xff) <= (fcd16 >> 8)) {
+            // proper order: prev tccc <= current lccc
+            if ((fcd16 & 0xff) <= 1) {
+                if (sink != nullptr &&
+                        !ByteSinkUtil::appendUnchanged(prevBoundary, src,
+                                                       *sink, options, edits, errorCode)) {
+                    break;
+                }
+                prevBoundary = src;
+            }
+            prevFCD16 = fcd16;
+            continue;
+        }
+        if (sink == nullptr) {
+            return prevBoundary;  // quick check "no"
+        }
+
+        // The text does not fulfill the conditions for FCD.
+        // Decompose and reorder a limited piece of it, up to the next safe boundary.
+        src = findNextFCDBoundary(src, limit);
+        ReorderingBuffer buffer(*this, s16, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        decomposeShort(prevBoundary, src, STOP_AT_LIMIT, FALSE /* onlyContiguous */,
+                       buffer, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        // The reordering always changes the text.
+        if (!ByteSinkUtil::appendChange(prevBoundary, src, buffer.getStart(), buffer.length(),
+                                        *sink, edits, errorCode)) {
+            break;
+        }
+        prevBoundary = src;
+        prevFCD16 = 0;
+    }
+    return src;
+}
+
 const UChar *Normalizer2Impl::findPreviousFCDBoundary(const UChar *start, const UChar *p) const {
     while(start<p) {
         const UChar *codePointLimit = p;
@@ -2332,6 +2621,21 @@ const UChar *Normalizer2Impl::findNextFCDBoundary(const UChar *p, const UChar *l
     return p;
 }
 
+const uint8_t *Normalizer2Impl::findNextFCDBoundary(const uint8_t *p, const uint8_t *limit) const {
+    while (p < limit) {
+        const uint8_t *codePointStart = p;
+        uint16_t norm16;
+        UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, p, limit, norm16);
+        if (norm16HasDecompBoundaryBefore(norm16)) {
+            return codePointStart;
+        }
+        if (norm16HasDecompBoundaryAfter(norm16)) {
+            return p;
+        }
+    }
+    return p;
+}
+
 // CanonicalIterator data -------------------------------------------------- ***
 
 CanonIterData::CanonIterData(UErrorCode &errorCode) :
@@ -486,6 +486,13 @@ class U_COMMON_API Normalizer2Impl : public UObject {
 
     const UChar *decompose(const UChar *src, const UChar *limit,
                            ReorderingBuffer *buffer, UErrorCode &errorCode) const;
+    /**
+     * sink==nullptr: isNormalized()/spanQuickCheckYes()
+     * @return the limit of the normalized prefix (limit if sink!=nullptr)
+     */
+    const uint8_t *decomposeUTF8(uint32_t options,
+                                 const uint8_t *src, const uint8_t *limit,
+                                 ByteSink *sink, icu::Edits *edits, UErrorCode &errorCode) const;
     void decomposeAndAppend(const UChar *src, const UChar *limit,
                             UBool doDecompose,
                             UnicodeString &safeMiddle,
@@ -518,6 +525,13 @@ class U_COMMON_API Normalizer2Impl : public UObject {
                           UnicodeString &safeMiddle,
                           ReorderingBuffer &buffer,
                           UErrorCode &errorCode) const;
+    /**
+     * sink==nullptr: isNormalized()/spanQuickCheckYes()
+     * @return the limit of the normalized prefix (limit if sink!=nullptr)
+     */
+    const uint8_t *makeFCDUTF8(uint32_t options,
+                               const uint8_t *src, const uint8_t *limit,
+                               ByteSink *sink, icu::Edits *edits, UErrorCode &errorCode) const;
 
     UBool hasDecompBoundaryBefore(UChar32 c) const;
     UBool norm16HasDecompBoundaryBefore(uint16_t norm16) const;
@@ -655,8 +669,10 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     UBool decompose(UChar32 c, uint16_t norm16,
                     ReorderingBuffer &buffer, UErrorCode &errorCode) const;
 
+    /** Where the UTF-8 decomposeShort() stops before its limit. */
+    enum StopAt { STOP_AT_LIMIT, STOP_AT_DECOMP_BOUNDARY, STOP_AT_COMP_BOUNDARY };
     const uint8_t *decomposeShort(const uint8_t *src, const uint8_t *limit,
-                                  UBool stopAtCompBoundary, UBool onlyContiguous,
+                                  StopAt stopAt, UBool onlyContiguous,
                                   ReorderingBuffer &buffer, UErrorCode &errorCode) const;
 
     static int32_t combine(const uint16_t *list, UChar32 trail);
@@ -691,6 +707,9 @@ class U_COMMON_API Normalizer2Impl : public UObject {
 
     const UChar *findPreviousFCDBoundary(const UChar *start, const UChar *p) const;
     const UChar *findNextFCDBoundary(const UChar *p, const UChar *limit) const;
+    const uint8_t *findNextFCDBoundary(const uint8_t *p, const uint8_t *limit) const;
+    uint16_t getFCD16FromNorm16(const uint8_t *cpStart, const uint8_t *cpLimit,
+                                uint16_t norm16) const;
 
     void makeCanonIterDataFromNorm16(UChar32 start, UChar32 end, const uint16_t norm16,
                                      CanonIterData &newData, UErrorCode &errorCode) const;
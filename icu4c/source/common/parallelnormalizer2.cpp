@@ -0,0 +1,433 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  parallelnormalizer2.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Multi-threaded normalization of large strings, on top of any Normalizer2.
+*   The input is cut at normalization boundaries, where
+*   normalize(A+B)=normalize(A)+normalize(B), so that the concatenated
+*   piece results are identical to the sequential result.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "cpputils.h"
+#include "umutex.h"
+
+// The worker threads are created with the platform API rather than std::thread,
+// which would allocate its state with the global operator new and report
+// failures with exceptions.
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#ifndef WIN32_LEAN_AND_MEAN
+# define WIN32_LEAN_AND_MEAN
+#endif
+# define VC_EXTRALEAN
+# define NOUSER
+# define NOSERVICE
+# define NOIME
+# define NOMCX
+# ifndef NOMINMAX
+# define NOMINMAX
+# endif
+#include <windows.h>
+#define U_PARALLEL_NORMALIZER2_THREADS 1
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+#include <pthread.h>
+#define U_PARALLEL_NORMALIZER2_THREADS 1
+#else
+#define U_PARALLEL_NORMALIZER2_THREADS 0
+#endif
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Pieces are at least this long, so that the threading overhead
+// is small compared with the normalization work.
+constexpr int32_t MIN_PIECE_LENGTH = 0x10000;
+// More pieces than threads so that a thread that finishes early
+// (for example, on a run of ASCII) takes over some of the remaining work.
+constexpr int32_t PIECES_PER_THREAD = 4;
+constexpr int32_t MAX_STACK_PIECES = 64;
+constexpr int32_t MAX_STACK_THREADS = 16;
+
+// Surrogate code points and ill-formed UTF-8 (c<0) are never boundaries,
+// so that a cut point never separates the parts of a character.
+UBool isBoundaryBefore(const Normalizer2 &norm2, UChar32 c) {
+    return c>=0 && !U_IS_SURROGATE(c) && norm2.hasBoundaryBefore(c);
+}
+
+/**
+ * Sets cuts[0..numPieces] to piece boundaries near equal-sized cut points.
+ * Returns the number of pieces, which may be lower than the requested number
+ * if some cut points have no boundary before the next one.
+ */
+int32_t findCuts(const Normalizer2 &norm2, const UChar *s, int32_t length,
+                 int32_t numPieces, int32_t *cuts) {
+    int32_t count=0;
+    cuts[0]=0;
+    for(int32_t p=1; p<numPieces; ++p) {
+        int32_t i=(int32_t)(((int64_t)length*p)/numPieces);
+        if(i<=cuts[count]) {
+            continue;
+        }
+        int32_t boundary=length;
+        while(i<length) {
+            int32_t cpStart=i;
+            UChar32 c;
+            U16_NEXT(s, i, length, c);
+            if(isBoundaryBefore(norm2, c)) {
+                boundary=cpStart;
+                break;
+            }
+        }
+        if(boundary>=length) {
+            break;
+        }
+        cuts[++count]=boundary;
+    }
+    cuts[++count]=length;
+    return count;
+}
+
+int32_t findCuts(const Normalizer2 &norm2, const uint8_t *s, int32_t length,
+                 int32_t numPieces, int32_t *cuts) {
+    int32_t count=0;
+    cuts[0]=0;
+    for(int32_t p=1; p<numPieces; ++p) {
+        int32_t i=(int32_t)(((int64_t)length*p)/numPieces);
+        if(i<=cuts[count]) {
+            continue;
+        }
+        int32_t boundary=length;
+        while(i<length) {
+            int32_t cpStart=i;
+            UChar32 c;
+            U8_NEXT(s, i, length, c);
+            if(isBoundaryBefore(norm2, c)) {
+                boundary=cpStart;
+                break;
+            }
+        }
+        if(boundary>=length) {
+            break;
+        }
+        cuts[++count]=boundary;
+    }
+    cuts[++count]=length;
+    return count;
+}
+
+/** Handles one piece; implemented per operation. */
+class PieceWorker : public UMemory {
+public:
+    PieceWorker(int32_t n) : numPieces(n), nextPiece(0) {}
+    virtual ~PieceWorker() {}
+    virtual void handlePiece(int32_t piece) = 0;
+
+    /**
+     * Handles all pieces on up to numThreads threads, including the calling one.
+     * Each thread takes the next piece that has not been started yet.
+     * If fewer threads can be started, then the remaining pieces are
+     * handled by the threads that are running, including the calling one.
+     */
+    void run(int32_t numThreads);
+
+private:
+    void work() {
+        int32_t piece;
+        while((piece=umtx_atomic_inc(&nextPiece)-1)<numPieces) {
+            handlePiece(piece);
+        }
+    }
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    typedef HANDLE Thread;
+
+    static DWORD WINAPI threadMain(LPVOID worker) {
+        static_cast<PieceWorker *>(worker)->work();
+        return 0;
+    }
+
+    UBool startThread(Thread &thread) {
+        thread=CreateThread(nullptr, 0, threadMain, this, 0, nullptr);
+        return thread!=nullptr;
+    }
+
+    static void joinThread(Thread &thread) {
+        WaitForSingleObject(thread, INFINITE);
+        CloseHandle(thread);
+    }
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+    typedef pthread_t Thread;
+
+    static void *threadMain(void *worker) {
+        static_cast<PieceWorker *>(worker)->work();
+        return nullptr;
+    }
+
+    UBool startThread(Thread &thread) {
+        return pthread_create(&thread, nullptr, threadMain, this)==0;
+    }
+
+    static void joinThread(Thread &thread) {
+        pthread_join(thread, nullptr);
+    }
+#endif
+
+    int32_t numPieces;
+    u_atomic_int32_t nextPiece;
+};
+
+void PieceWorker::run(int32_t numThreads) {
+#if U_PARALLEL_NORMALIZER2_THREADS
+    if(numThreads>numPieces) {
+        numThreads=numPieces;
+    }
+    MaybeStackArray<Thread, MAX_STACK_THREADS> threads;
+    int32_t numStarted=0;
+    if(numThreads>1 &&
+            (numThreads-1<=threads.getCapacity() || threads.resize(numThreads-1)!=nullptr)) {
+        while(numStarted<numThreads-1 && startThread(threads[numStarted])) {
+            ++numStarted;
+        }
+    }
+    work();
+    for(int32_t t=0; t<numStarted; ++t) {
+        joinThread(threads[t]);
+    }
+#else
+    (void)numThreads;
+    work();
+#endif
+}
+
+class NormalizeWorker : public PieceWorker {
+public:
+    NormalizeWorker(const Normalizer2 &n2, const UnicodeString &s, const int32_t *c,
+                    int32_t n, UnicodeString *r, UErrorCode *e) :
+            PieceWorker(n), norm2(n2), src(s), cuts(c), results(r), errorCodes(e) {}
+    virtual void handlePiece(int32_t piece) U_OVERRIDE {
+        norm2.normalize(src.tempSubStringBetween(cuts[piece], cuts[piece+1]),
+                        results[piece], errorCodes[piece]);
+    }
+
+private:
+    const Normalizer2 &norm2;
+    const UnicodeString &src;
+    const int32_t *cuts;
+    UnicodeString *results;
+    UErrorCode *errorCodes;
+};
+
+class NormalizeUTF8Worker : public PieceWorker {
+public:
+    NormalizeUTF8Worker(const Normalizer2 &n2, StringPiece s, const int32_t *c,
+                        int32_t n, CharString *r, UErrorCode *e) :
+            PieceWorker(n), norm2(n2), src(s), cuts(c), results(r), errorCodes(e) {}
+    virtual void handlePiece(int32_t piece) U_OVERRIDE {
+        CharStringByteSink sink(results+piece);
+        norm2.normalizeUTF8(0, StringPiece(src.data()+cuts[piece], cuts[piece+1]-cuts[piece]),
+                            sink, nullptr, errorCodes[piece]);
+    }
+
+private:
+    const Normalizer2 &norm2;
+    StringPiece src;
+    const int32_t *cuts;
+    CharString *results;
+    UErrorCode *errorCodes;
+};
+
+class QuickCheckWorker : public PieceWorker {
+public:
+    QuickCheckWorker(const Normalizer2 &n2, const UnicodeString &s, const int32_t *c,
+                     int32_t n, UNormalizationCheckResult *r, UErrorCode *e) :
+            PieceWorker(n), norm2(n2), src(s), cuts(c), results(r), errorCodes(e) {}
+    virtual void handlePiece(int32_t piece) U_OVERRIDE {
+        results[piece]=norm2.quickCheck(src.tempSubStringBetween(cuts[piece], cuts[piece+1]),
+                                        errorCodes[piece]);
+    }
+
+private:
+    const Normalizer2 &norm2;
+    const UnicodeString &src;
+    const int32_t *cuts;
+    UNormalizationCheckResult *results;
+    UErrorCode *errorCodes;
+};
+
+}  // namespace
+
+ParallelNormalizer2::ParallelNormalizer2(const Normalizer2 &n2, int32_t threads) :
+        norm2(n2), numThreads(threads>1 ? threads : 1) {}
+
+ParallelNormalizer2::~ParallelNormalizer2() {}
+
+// Returns the number of pieces to ask findCuts() for; 1 for "do not split".
+static int32_t
+getNumPieces(int32_t numThreads, int32_t length) {
+    if(numThreads<=1) {
+        return 1;
+    }
+    int32_t numPieces=length/MIN_PIECE_LENGTH;
+    if(numThreads<numPieces/PIECES_PER_THREAD) {
+        numPieces=numThreads*PIECES_PER_THREAD;
+    }
+    return numPieces>1 ? numPieces : 1;
+}
+
+UnicodeString &
+ParallelNormalizer2::normalize(const UnicodeString &src, UnicodeString &dest,
+                               UErrorCode &errorCode) const {
+    uprv_checkCanGetBuffer(src, errorCode);
+    if(U_FAILURE(errorCode)) {
+        dest.setToBogus();
+        return dest;
+    }
+    if(&dest==&src) {
+        errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return dest;
+    }
+    int32_t numPieces=getNumPieces(numThreads, src.length());
+    MaybeStackArray<int32_t, MAX_STACK_PIECES+1> cuts;
+    if(numPieces>1) {
+        if(cuts.resize(numPieces+1)==nullptr) {
+            errorCode=U_MEMORY_ALLOCATION_ERROR;
+            return dest;
+        }
+        numPieces=findCuts(norm2, src.getBuffer(), src.length(), numPieces, cuts.getAlias());
+    }
+    if(numPieces<=1) {
+        return norm2.normalize(src, dest, errorCode);
+    }
+    LocalArray<UnicodeString> results(new UnicodeString[numPieces]);
+    MaybeStackArray<UErrorCode, MAX_STACK_PIECES> errorCodes;
+    if(results.isNull() || errorCodes.resize(numPieces)==nullptr) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return dest;
+    }
+    for(int32_t p=0; p<numPieces; ++p) {
+        errorCodes[p]=U_ZERO_ERROR;
+    }
+    NormalizeWorker(norm2, src, cuts.getAlias(), numPieces,
+                    results.getAlias(), errorCodes.getAlias()).run(numThreads);
+    for(int32_t p=0; p<numPieces; ++p) {
+        if(U_FAILURE(errorCodes[p])) {
+            errorCode=errorCodes[p];
+            return dest;
+        }
+    }
+    dest.remove();
+    for(int32_t p=0; p<numPieces; ++p) {
+        dest.append(results[p]);
+    }
+    return dest;
+}
+
+void
+ParallelNormalizer2::normalizeUTF8(StringPiece src, ByteSink &sink,
+                                   UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t numPieces=getNumPieces(numThreads, src.length());
+    MaybeStackArray<int32_t, MAX_STACK_PIECES+1> cuts;
+    if(numPieces>1) {
+        if(cuts.resize(numPieces+1)==nullptr) {
+            errorCode=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        numPieces=findCuts(norm2, reinterpret_cast<const uint8_t *>(src.data()), src.length(),
+                           numPieces, cuts.getAlias());
+    }
+    if(numPieces<=1) {
+        norm2.normalizeUTF8(0, src, sink, nullptr, errorCode);
+        return;
+    }
+    LocalArray<CharString> results(new CharString[numPieces]);
+    MaybeStackArray<UErrorCode, MAX_STACK_PIECES> errorCodes;
+    if(results.isNull() || errorCodes.resize(numPieces)==nullptr) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for(int32_t p=0; p<numPieces; ++p) {
+        errorCodes[p]=U_ZERO_ERROR;
+    }
+    NormalizeUTF8Worker(norm2, src, cuts.getAlias(), numPieces,
+                        results.getAlias(), errorCodes.getAlias()).run(numThreads);
+    for(int32_t p=0; p<numPieces; ++p) {
+        if(U_FAILURE(errorCodes[p])) {
+            errorCode=errorCodes[p];
+            return;
+        }
+    }
+    for(int32_t p=0; p<numPieces; ++p) {
+        sink.Append(results[p].data(), results[p].length());
+    }
+    sink.Flush();
+}
+
+UNormalizationCheckResult
+ParallelNormalizer2::quickCheck(const UnicodeString &s, UErrorCode &errorCode) const {
+    uprv_checkCanGetBuffer(s, errorCode);
+    if(U_FAILURE(errorCode)) {
+        return UNORM_MAYBE;
+    }
+    int32_t numPieces=getNumPieces(numThreads, s.length());
+    MaybeStackArray<int32_t, MAX_STACK_PIECES+1> cuts;
+    if(numPieces>1) {
+        if(cuts.resize(numPieces+1)==nullptr) {
+            errorCode=U_MEMORY_ALLOCATION_ERROR;
+            return UNORM_MAYBE;
+        }
+        numPieces=findCuts(norm2, s.getBuffer(), s.length(), numPieces, cuts.getAlias());
+    }
+    if(numPieces<=1) {
+        return norm2.quickCheck(s, errorCode);
+    }
+    MaybeStackArray<UNormalizationCheckResult, MAX_STACK_PIECES> results;
+    MaybeStackArray<UErrorCode, MAX_STACK_PIECES> errorCodes;
+    if(results.resize(numPieces)==nullptr || errorCodes.resize(numPieces)==nullptr) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return UNORM_MAYBE;
+    }
+    for(int32_t p=0; p<numPieces; ++p) {
+        errorCodes[p]=U_ZERO_ERROR;
+    }
+    QuickCheckWorker(norm2, s, cuts.getAlias(), numPieces,
+                     results.getAlias(), errorCodes.getAlias()).run(numThreads);
+    // "No" anywhere makes the whole string "no", otherwise "maybe" anywhere makes it "maybe".
+    UNormalizationCheckResult result=UNORM_YES;
+    for(int32_t p=0; p<numPieces; ++p) {
+        if(U_FAILURE(errorCodes[p])) {
+            errorCode=errorCodes[p];
+            return UNORM_MAYBE;
+        }
+        if(results[p]==UNORM_NO) {
+            return UNORM_NO;
+        } else if(results[p]==UNORM_MAYBE) {
+            result=UNORM_MAYBE;
+        }
+    }
+    return result;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
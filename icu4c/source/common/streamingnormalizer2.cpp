@@ -0,0 +1,244 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  streamingnormalizer2.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Incremental normalization of chunked input, on top of any Normalizer2.
+*   Only the text after the last normalization boundary in the input so far
+*   is held back, in a fixed-size buffer; everything else is normalized
+*   straight out of the caller's chunk.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/appendable.h"
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+#include "unicode/ustring.h"
+#include "unicode/utf8.h"
+#include "cmemory.h"
+#include "cpputils.h"
+
+U_NAMESPACE_BEGIN
+
+StreamingNormalizer2::StreamingNormalizer2(const Normalizer2 &n2) :
+        norm2(n2), pendingLength(0) {}
+
+StreamingNormalizer2::~StreamingNormalizer2() {}
+
+// Surrogate code points and ill-formed UTF-8 (c<0) never count as boundaries,
+// so that a character split across chunks is not normalized in two halves.
+UBool
+StreamingNormalizer2::isBoundaryBefore(UChar32 c) const {
+    return c>=0 && !U_IS_SURROGATE(c) && norm2.hasBoundaryBefore(c);
+}
+
+UBool
+StreamingNormalizer2::isBoundaryAfter(UChar32 c) const {
+    return c>=0 && !U_IS_SURROGATE(c) && norm2.hasBoundaryAfter(c);
+}
+
+// Returns the index of the first boundary in s[0..length[ that is before
+// a code point starting below maxIndex, or -1 if there is none.
+int32_t
+StreamingNormalizer2::firstBoundary(const UChar *s, int32_t length, int32_t maxIndex) const {
+    int32_t i=0;
+    while(i<maxIndex && i<length) {
+        int32_t cpStart=i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if(isBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+// Returns the start of the text in s[start..length[ that has to be held back:
+// - length if the text ends with a boundary
+// - the last boundary within the last PENDING_CAPACITY units
+//   (start itself must be a boundary)
+// - length if there is no boundary near enough to the end
+int32_t
+StreamingNormalizer2::lastBoundary(const UChar *s, int32_t start, int32_t length) const {
+    if(start==length) {
+        return length;
+    }
+    int32_t lowest=length-PENDING_CAPACITY;
+    if(lowest<=start) {
+        lowest=start;
+    }
+    int32_t i=length;
+    UChar32 c;
+    U16_PREV(s, start, i, c);
+    if(isBoundaryAfter(c)) {
+        return length;
+    }
+    while(i>=lowest) {
+        if(isBoundaryBefore(c) || i==start) {
+            return i;
+        }
+        U16_PREV(s, start, i, c);
+    }
+    return length;
+}
+
+int32_t
+StreamingNormalizer2::firstBoundary(const uint8_t *s, int32_t length, int32_t maxIndex) const {
+    int32_t i=0;
+    while(i<maxIndex && i<length) {
+        int32_t cpStart=i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if(isBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+int32_t
+StreamingNormalizer2::lastBoundary(const uint8_t *s, int32_t start, int32_t length) const {
+    if(start==length) {
+        return length;
+    }
+    int32_t lowest=length-PENDING_CAPACITY;
+    if(lowest<=start) {
+        lowest=start;
+    }
+    int32_t i=length;
+    UChar32 c;
+    U8_PREV(s, start, i, c);
+    if(isBoundaryAfter(c)) {
+        return length;
+    }
+    while(i>=lowest) {
+        if(isBoundaryBefore(c) || i==start) {
+            return i;
+        }
+        U8_PREV(s, start, i, c);
+    }
+    return length;
+}
+
+void
+StreamingNormalizer2::writeNormalized(const UChar *s, int32_t length,
+                                      Appendable &dest, UErrorCode &errorCode) {
+    if(length==0) {
+        return;
+    }
+    // buffer16 keeps its capacity from one call to the next.
+    norm2.normalize(UnicodeString(FALSE, s, length), buffer16, errorCode);
+    if(U_SUCCESS(errorCode)) {
+        dest.appendString(buffer16.getBuffer(), buffer16.length());
+    }
+}
+
+void
+StreamingNormalizer2::normalize(const UnicodeString &chunk, Appendable &dest,
+                                UErrorCode &errorCode) {
+    uprv_checkCanGetBuffer(chunk, errorCode);
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    const UChar *s=chunk.getBuffer();
+    int32_t length=chunk.length();
+    int32_t start=0;
+    if(pendingLength>0) {
+        // Complete the held-back segment with the start of the chunk.
+        int32_t room=PENDING_CAPACITY-pendingLength;
+        int32_t b=firstBoundary(s, length, room);
+        if(b<0 && length<=room) {
+            u_memcpy(pending16+pendingLength, s, length);
+            pendingLength+=length;
+            return;
+        }
+        if(b>=0) {
+            u_memcpy(pending16+pendingLength, s, b);
+            pendingLength+=b;
+            start=b;
+        }
+        // else the segment is too long for the buffer: normalize it in pieces.
+        writeNormalized(pending16, pendingLength, dest, errorCode);
+        pendingLength=0;
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+    }
+    int32_t limit=lastBoundary(s, start, length);
+    writeNormalized(s+start, limit-start, dest, errorCode);
+    if(U_SUCCESS(errorCode)) {
+        pendingLength=length-limit;
+        u_memcpy(pending16, s+limit, pendingLength);
+    }
+}
+
+void
+StreamingNormalizer2::finish(Appendable &dest, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    writeNormalized(pending16, pendingLength, dest, errorCode);
+    pendingLength=0;
+}
+
+void
+StreamingNormalizer2::normalizeUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    const uint8_t *s=reinterpret_cast<const uint8_t *>(chunk.data());
+    int32_t length=chunk.length();
+    int32_t start=0;
+    if(pendingLength>0) {
+        int32_t room=PENDING_CAPACITY-pendingLength;
+        int32_t b=firstBoundary(s, length, room);
+        if(b<0 && length<=room) {
+            uprv_memcpy(pending8+pendingLength, s, length);
+            pendingLength+=length;
+            return;
+        }
+        if(b>=0) {
+            uprv_memcpy(pending8+pendingLength, s, b);
+            pendingLength+=b;
+            start=b;
+        }
+        norm2.normalizeUTF8(0, StringPiece(pending8, pendingLength), sink, nullptr, errorCode);
+        pendingLength=0;
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+    }
+    int32_t limit=lastBoundary(s, start, length);
+    if(start<limit) {
+        norm2.normalizeUTF8(0, StringPiece(chunk.data()+start, limit-start), sink, nullptr, errorCode);
+    }
+    if(U_SUCCESS(errorCode)) {
+        pendingLength=length-limit;
+        uprv_memcpy(pending8, s+limit, pendingLength);
+    }
+}
+
+void
+StreamingNormalizer2::finishUTF8(ByteSink &sink, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    if(pendingLength>0) {
+        norm2.normalizeUTF8(0, StringPiece(pending8, pendingLength), sink, nullptr, errorCode);
+    }
+    pendingLength=0;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -22,6 +22,7 @@
 #include "unicode/utypes.h"
 #include "unicode/unistr.h"
 #include "unicode/uset.h"
+#include "unicode/ucptrie.h"
 #include "unicode/udata.h" /* UDataInfo */
 #include "unicode/utf16.h"
 #include "ucmndata.h" /* DataHeader */
@@ -29,7 +30,6 @@
 #include "umutex.h"
 #include "uassert.h"
 #include "cmemory.h"
-#include "utrie2.h"
 #include "ucase.h"
 
 struct UCaseProps {
@@ -38,7 +38,7 @@ struct UCaseProps {
     const uint16_t *exceptions;
     const uint16_t *unfold;
 
-    UTrie2 trie;
+    UCPTrie trie;
     uint8_t formatVersion[4];
 };
 
@@ -48,14 +48,6 @@ struct UCaseProps {
 
 /* set of property starts for UnicodeSet ------------------------------------ */
 
-static UBool U_CALLCONV
-_enumPropertyStartsRange(const void *context, UChar32 start, UChar32 /*end*/, uint32_t /*value*/) {
-    /* add the start code point to the USet */
-    const USetAdder *sa=(const USetAdder *)context;
-    sa->add(sa->set, start);
-    return TRUE;
-}
-
 U_CFUNC void U_EXPORT2
 ucase_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     if(U_FAILURE(*pErrorCode)) {
@@ -63,7 +55,12 @@ ucase_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the trie */
-    utrie2_enum(&ucase_props_singleton.trie, NULL, _enumPropertyStartsRange, sa);
+    UChar32 start = 0, end;
+    while ((end = ucptrie_getRange(&ucase_props_singleton.trie, start, UCPMAP_RANGE_NORMAL, 0,
+                                   nullptr, nullptr, nullptr)) >= 0) {
+        sa->add(sa->set, start);
+        start = end + 1;
+    }
 
     /* add code points with hardcoded properties, plus the ones following them */
 
@@ -77,7 +74,7 @@ ucase_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
 
 /* data access primitives --------------------------------------------------- */
 
-U_CFUNC const UTrie2 * U_EXPORT2
+U_CFUNC const UCPTrie * U_EXPORT2
 ucase_getTrie() {
     return &ucase_props_singleton.trie;
 }
@@ -130,7 +127,7 @@ static const uint8_t flagsOffset[256]={
 
 U_CAPI UChar32 U_EXPORT2
 ucase_tolower(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_IS_UPPER_OR_TITLE(props)) {
             c+=UCASE_GET_DELTA(props);
@@ -152,7 +149,7 @@ ucase_tolower(UChar32 c) {
 
 U_CAPI UChar32 U_EXPORT2
 ucase_toupper(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)==UCASE_LOWER) {
             c+=UCASE_GET_DELTA(props);
@@ -174,7 +171,7 @@ ucase_toupper(UChar32 c) {
 
 U_CAPI UChar32 U_EXPORT2
 ucase_totitle(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)==UCASE_LOWER) {
             c+=UCASE_GET_DELTA(props);
@@ -240,7 +237,7 @@ ucase_addCaseClosure(UChar32 c, const USetAdder *sa) {
         break;
     }
 
-    props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)!=UCASE_NONE) {
             /* add the one simple case mapping, no matter what type it is */
@@ -580,21 +577,21 @@ U_NAMESPACE_END
 /** @return UCASE_NONE, UCASE_LOWER, UCASE_UPPER, UCASE_TITLE */
 U_CAPI int32_t U_EXPORT2
 ucase_getType(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     return UCASE_GET_TYPE(props);
 }
 
 /** @return same as ucase_getType() and set bit 2 if c is case-ignorable */
 U_CAPI int32_t U_EXPORT2
 ucase_getTypeOrIgnorable(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     return UCASE_GET_TYPE_AND_IGNORABLE(props);
 }
 
 /** @return UCASE_NO_DOT, UCASE_SOFT_DOTTED, UCASE_ABOVE, UCASE_OTHER_ACCENT */
 static inline int32_t
 getDotType(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         return props&UCASE_DOT_MASK;
     } else {
@@ -610,7 +607,7 @@ ucase_isSoftDotted(UChar32 c) {
 
 U_CAPI UBool U_EXPORT2
 ucase_isCaseSensitive(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         return (UBool)((props&UCASE_SENSITIVE)!=0);
     } else {
@@ -1038,7 +1035,7 @@ ucase_toFullLower(UChar32 c,
     // The sign of the result has meaning, input must be non-negative so that it can be returned as is.
     U_ASSERT(c >= 0);
     UChar32 result=c;
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_IS_UPPER_OR_TITLE(props)) {
             result=c+UCASE_GET_DELTA(props);
@@ -1189,7 +1186,7 @@ toUpperOrTitle(UChar32 c,
     // The sign of the result has meaning, input must be non-negative so that it can be returned as is.
     U_ASSERT(c >= 0);
     UChar32 result=c;
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)==UCASE_LOWER) {
             result=c+UCASE_GET_DELTA(props);
@@ -1339,7 +1336,7 @@ ucase_toFullTitle(UChar32 c,
 /* return the simple case folding mapping for c */
 U_CAPI UChar32 U_EXPORT2
 ucase_fold(UChar32 c, uint32_t options) {
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_IS_UPPER_OR_TITLE(props)) {
             c+=UCASE_GET_DELTA(props);
@@ -1412,7 +1409,7 @@ ucase_toFullFolding(UChar32 c,
     // The sign of the result has meaning, input must be non-negative so that it can be returned as is.
     U_ASSERT(c >= 0);
     UChar32 result=c;
-    uint16_t props=UTRIE2_GET16(&ucase_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ucase_props_singleton.trie, UCPTRIE_16, c);
     if(!UCASE_HAS_EXCEPTION(props)) {
         if(UCASE_IS_UPPER_OR_TITLE(props)) {
             result=c+UCASE_GET_DELTA(props);
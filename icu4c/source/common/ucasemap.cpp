@@ -41,6 +41,7 @@
 #include "uassert.h"
 #include "ucase.h"
 #include "ucasemap_imp.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 
 U_NAMESPACE_USE
@@ -161,6 +162,25 @@ appendResult(int32_t cpLength, int32_t result, const UChar *s,
     return TRUE;
 }
 
+/**
+ * Appends the ASCII text s[0..length[ with the letters first..first+25 case-mapped,
+ * see usimd_u8MapASCIILetters().
+ * Only for when there are no Edits and no U_OMIT_UNCHANGED_TEXT.
+ */
+void
+appendMappedASCII(const uint8_t *s, int32_t length, uint8_t first, ByteSink &sink) {
+    char scratch[200];
+    while (length > 0) {
+        int32_t capacity;
+        char *buffer = sink.GetAppendBuffer(1, length, scratch, UPRV_LENGTHOF(scratch), &capacity);
+        int32_t n = length <= capacity ? length : capacity;
+        usimd_u8MapASCIILetters(reinterpret_cast<uint8_t *>(buffer), s, n, first);
+        sink.Append(buffer, n);
+        s += n;
+        length -= n;
+    }
+}
+
 // See unicode/utf8.h U8_APPEND_UNSAFE().
 inline uint8_t getTwoByteLead(UChar32 c) { return (uint8_t)((c >> 6) | 0xc0); }
 inline uint8_t getTwoByteTrail(UChar32 c) { return (uint8_t)((c & 0x3f) | 0x80); }
@@ -213,7 +233,11 @@ void toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    // Without Edits and with all text written, whole ASCII runs
+    // can be mapped in blocks.
+    UBool mapASCIIBlocks = latinToLower == LatinCase::TO_LOWER_NORMAL &&
+        edits == nullptr && (options & U_OMIT_UNCHANGED_TEXT) == 0;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
     for (;;) {
@@ -233,9 +257,19 @@ void toLower(int32_t caseLocale, uint32_t options,
                     c = lead;
                     break;
                 }
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    srcIndex += usimd_u8UnmappedPrefix(src + srcIndex, srcLimit - srcIndex, 0x41);
+                    continue;
+                }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
+                if (mapASCIIBlocks) {
+                    int32_t start = srcIndex - 1;
+                    srcIndex += usimd_asciiPrefixLength(src + srcIndex, srcLimit - srcIndex);
+                    appendMappedASCII(src + start, srcIndex - start, 0x41, sink);
+                    prev = srcIndex;
+                    continue;
+                }
                 char ascii = (char)(lead + d);
                 sink.Append(&ascii, 1);
                 if (edits != nullptr) {
@@ -278,7 +312,7 @@ void toLower(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -321,7 +355,11 @@ void toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    // Without Edits and with all text written, whole ASCII runs
+    // can be mapped in blocks.
+    UBool mapASCIIBlocks = latinToUpper == LatinCase::TO_UPPER_NORMAL &&
+        edits == nullptr && (options & U_OMIT_UNCHANGED_TEXT) == 0;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = 0;
     int32_t srcIndex = 0;
     for (;;) {
@@ -341,9 +379,19 @@ void toUpper(int32_t caseLocale, uint32_t options,
                     c = lead;
                     break;
                 }
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    srcIndex += usimd_u8UnmappedPrefix(src + srcIndex, srcLength - srcIndex, 0x61);
+                    continue;
+                }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
+                if (mapASCIIBlocks) {
+                    int32_t start = srcIndex - 1;
+                    srcIndex += usimd_asciiPrefixLength(src + srcIndex, srcLength - srcIndex);
+                    appendMappedASCII(src + start, srcIndex - start, 0x61, sink);
+                    prev = srcIndex;
+                    continue;
+                }
                 char ascii = (char)(lead + d);
                 sink.Append(&ascii, 1);
                 if (edits != nullptr) {
@@ -386,7 +434,7 @@ void toUpper(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -40,6 +40,7 @@
 #include "ucnv_imp.h"
 #include "ucnv_cnv.h"
 #include "ucnv_bld.h"
+#include "umutex.h"
 
 /* size of intermediate and preflighting buffers in ucnv_convert() */
 #define CHUNK_SIZE 1024
@@ -393,6 +394,273 @@ ucnv_close (UConverter * converter)
     UTRACE_EXIT();
 }
 
+/* per-thread converter pool ----------------------------------------------- */
+
+/*
+ * Maximum number of idle converters kept per thread.
+ * Define as 0 to disable pooling, for example on platforms without
+ * C++11 thread_local support; then ucnv_acquire() is ucnv_open()
+ * and ucnv_release() is ucnv_close().
+ */
+#ifndef UCNV_POOL_CAPACITY
+#   define UCNV_POOL_CAPACITY 8
+#endif
+
+#if UCNV_POOL_CAPACITY > 0
+
+namespace {
+
+/*
+ * Idle converters are matched by their ucnv_getName(), which includes
+ * name-based options like swaplfnl and the ISO-2022 locale and version.
+ * The requested names are mapped to these keys in a small table that is
+ * filled on pool misses, so that a pool hit needs no alias lookup.
+ */
+struct PoolNameEntry {
+    char name[UCNV_MAX_CONVERTER_NAME_LENGTH];
+    char key[UCNV_MAX_CONVERTER_NAME_LENGTH];
+};
+
+struct PoolIdleEntry {
+    UConverter *cnv;
+    char key[UCNV_MAX_CONVERTER_NAME_LENGTH];
+};
+
+class ConverterPool;
+
+/*
+ * All pools that hold idle converters, so that ucnv_cleanup() can close
+ * the converters of every thread before it releases the shared data.
+ */
+UMutex gPoolListMutex = U_MUTEX_INITIALIZER;
+ConverterPool *gPoolList = NULL;
+
+class ConverterPool {
+public:
+    ~ConverterPool() {
+        umtx_lock(&gPoolListMutex);
+        flush();
+        if (isLinked) {
+            *prevNext = next;
+            if (next != NULL) {
+                next->prevNext = prevNext;
+            }
+        }
+        umtx_unlock(&gPoolListMutex);
+    }
+
+    void flush() {
+        for (int32_t i = 0; i < idleCount; ++i) {
+            ucnv_close(idle[i].cnv);
+        }
+        idleCount = 0;
+    }
+
+    /* Returns the key for a requested name, or NULL if not known yet. */
+    const char *findKey(const char *name) const {
+        for (int32_t i = 0; i < nameCount; ++i) {
+            if (uprv_strcmp(names[i].name, name) == 0) {
+                return names[i].key;
+            }
+        }
+        return NULL;
+    }
+
+    void addName(const char *name, const char *key) {
+        if (uprv_strlen(name) >= UCNV_MAX_CONVERTER_NAME_LENGTH ||
+                uprv_strlen(key) >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
+            return;
+        }
+        PoolNameEntry &entry = names[nextName];
+        uprv_strcpy(entry.name, name);
+        uprv_strcpy(entry.key, key);
+        nextName = (nextName + 1) % UPRV_LENGTHOF(names);
+        if (nameCount < UPRV_LENGTHOF(names)) {
+            ++nameCount;
+        }
+    }
+
+    /* Removes and returns the most recently released idle converter for the key. */
+    UConverter *take(const char *key) {
+        for (int32_t i = idleCount; i > 0;) {
+            if (uprv_strcmp(idle[--i].key, key) == 0) {
+                UConverter *cnv = idle[i].cnv;
+                --idleCount;
+                for (; i < idleCount; ++i) {
+                    idle[i] = idle[i + 1];
+                }
+                return cnv;
+            }
+        }
+        return NULL;
+    }
+
+    /* Adds an idle converter, closing the least recently released one if the pool is full. */
+    void put(UConverter *cnv, const char *key) {
+        if (uprv_strlen(key) >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
+            ucnv_close(cnv);
+            return;
+        }
+        if (!isLinked) {
+            umtx_lock(&gPoolListMutex);
+            next = gPoolList;
+            if (next != NULL) {
+                next->prevNext = &next;
+            }
+            prevNext = &gPoolList;
+            gPoolList = this;
+            isLinked = TRUE;
+            umtx_unlock(&gPoolListMutex);
+            ucnv_enableCleanup();
+        }
+        if (idleCount == UCNV_POOL_CAPACITY) {
+            ucnv_close(idle[0].cnv);
+            --idleCount;
+            for (int32_t i = 0; i < idleCount; ++i) {
+                idle[i] = idle[i + 1];
+            }
+        }
+        idle[idleCount].cnv = cnv;
+        uprv_strcpy(idle[idleCount].key, key);
+        ++idleCount;
+    }
+
+    PoolNameEntry names[2 * UCNV_POOL_CAPACITY];
+    int32_t nameCount = 0;
+    int32_t nextName = 0;
+    PoolIdleEntry idle[UCNV_POOL_CAPACITY];
+    int32_t idleCount = 0;
+    int64_t hits = 0;
+    int64_t misses = 0;
+
+    /* Links in gPoolList, set by the first put(). */
+    UBool isLinked = FALSE;
+    ConverterPool *next = NULL;
+    ConverterPool **prevNext = NULL;
+};
+
+thread_local ConverterPool gPool;
+
+}  // namespace
+
+#endif  /* UCNV_POOL_CAPACITY > 0 */
+
+U_CAPI UConverter * U_EXPORT2
+ucnv_acquire(const char *converterName, UErrorCode *err)
+{
+    if (err == NULL || U_FAILURE(*err)) {
+        return NULL;
+    }
+#if UCNV_POOL_CAPACITY > 0
+    if (converterName != NULL) {
+        const char *key = gPool.findKey(converterName);
+        if (key != NULL) {
+            UConverter *cnv = gPool.take(key);
+            if (cnv != NULL) {
+                ++gPool.hits;
+                return cnv;
+            }
+        }
+        ++gPool.misses;
+        UConverter *cnv = ucnv_open(converterName, err);
+        if (key == NULL && U_SUCCESS(*err) && cnv->isPoolable) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            const char *name = ucnv_getName(cnv, &errorCode);
+            if (U_SUCCESS(errorCode)) {
+                gPool.addName(converterName, name);
+            }
+        }
+        return cnv;
+    }
+#endif
+    return ucnv_open(converterName, err);
+}
+
+#if UCNV_POOL_CAPACITY > 0
+/*
+ * Returns TRUE if the converter has the callbacks, substitution characters
+ * and fallback setting of a newly opened one, so that after ucnv_reset()
+ * it cannot be told apart from a new converter.
+ * Converters whose open function sets other substitution characters
+ * than those of the static data are never pooled.
+ */
+static UBool
+isUnmodified(const UConverter *cnv) {
+    const UConverterStaticData *staticData = cnv->sharedData->staticData;
+    return cnv->fromCharErrorBehaviour == UCNV_TO_U_DEFAULT_CALLBACK &&
+        cnv->fromUCharErrorBehaviour == UCNV_FROM_U_DEFAULT_CALLBACK &&
+        cnv->toUContext == NULL &&
+        cnv->fromUContext == NULL &&
+        !cnv->useFallback &&
+        cnv->subChars == (uint8_t *)cnv->subUChars &&
+        cnv->subCharLen == staticData->subCharLen &&
+        cnv->subChar1 == staticData->subChar1 &&
+        uprv_memcmp(cnv->subChars, staticData->subChar, staticData->subCharLen) == 0;
+}
+#endif
+
+U_CAPI void U_EXPORT2
+ucnv_release(UConverter *converter)
+{
+    if (converter == NULL) {
+        return;
+    }
+#if UCNV_POOL_CAPACITY > 0
+    /*
+     * Idle converters are keyed by name. A converter from a package
+     * or a file path reports the same name as the standard one, so it is never pooled.
+     */
+    if (!converter->isCopyLocal && converter->isPoolable && isUnmodified(converter)) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const char *key = ucnv_getName(converter, &errorCode);
+        if (U_SUCCESS(errorCode)) {
+            ucnv_reset(converter);
+            gPool.put(converter, key);
+            return;
+        }
+    }
+#endif
+    ucnv_close(converter);
+}
+
+U_CAPI void U_EXPORT2
+ucnv_flushPool()
+{
+#if UCNV_POOL_CAPACITY > 0
+    gPool.flush();
+#endif
+}
+
+U_CFUNC void
+ucnv_flushAllPools()
+{
+#if UCNV_POOL_CAPACITY > 0
+    umtx_lock(&gPoolListMutex);
+    for (ConverterPool *pool = gPoolList; pool != NULL; pool = pool->next) {
+        pool->flush();
+    }
+    umtx_unlock(&gPoolListMutex);
+#endif
+}
+
+U_CAPI void U_EXPORT2
+ucnv_getPoolStatistics(int32_t *pHits, int32_t *pMisses)
+{
+#if UCNV_POOL_CAPACITY > 0
+    /* The counts saturate rather than wrap around in long-running threads. */
+    int32_t hits = gPool.hits < INT32_MAX ? (int32_t)gPool.hits : INT32_MAX;
+    int32_t misses = gPool.misses < INT32_MAX ? (int32_t)gPool.misses : INT32_MAX;
+#else
+    int32_t hits = 0, misses = 0;
+#endif
+    if (pHits != NULL) {
+        *pHits = hits;
+    }
+    if (pMisses != NULL) {
+        *pMisses = misses;
+    }
+}
+
 /*returns a single Name from the list, will return NULL if out of bounds
  */
 U_CAPI const char*   U_EXPORT2
@@ -45,7 +45,9 @@
 #include "cmemory.h"
 #include "ucln_cmn.h"
 #include "ustr_cnv.h"
+#include "ustr_imp.h"
 
+#include <atomic>
 
 #if 0
 #include <stdio.h>
@@ -195,8 +197,39 @@ static struct {
 /*initializes some global variables */
 static UHashtable *SHARED_DATA_HASHTABLE = NULL;
 static UMutex cnvCacheMutex = U_MUTEX_INITIALIZER;  /* Mutex for synchronizing cnv cache access. */
-                                                    /*  Note:  the global mutex is used for      */
-                                                    /*         reference count updates.          */
+                                                    /*  Note:  reference counts are updated     */
+                                                    /*         atomically, without the mutex.   */
+
+/*
+ * Lock-free read index for the converter cache.
+ *
+ * SHARED_DATA_HASHTABLE remains the authoritative cache and is only accessed
+ * with cnvCacheMutex held. Each cached shared data is also entered into this
+ * fixed-capacity, open-addressing table, so that opening an already-loaded
+ * converter needs no mutex: Readers probe the table and atomically
+ * increment the reference counter of the entry they find.
+ *
+ * Slots are filled only with cnvCacheMutex held, and a slot is published by
+ * storing its hash value last. Stored hash values are odd;
+ * 0 marks an unused slot and CNV_CACHE_TOMBSTONE a flushed one.
+ * ucnv_flushCache() diverts new readers to the mutex path and waits until
+ * in-flight readers are done before it deletes any shared data.
+ * Converters that do not fit into the index are found via the mutex path.
+ */
+struct CnvCacheSlot {
+    icu::u_atomic_int32_t hash;
+    const char *name;
+    UConverterSharedData *sharedData;
+};
+
+#define CNV_CACHE_TOMBSTONE 2
+
+static CnvCacheSlot *gCacheIndex = NULL;
+static int32_t gCacheIndexMask = 0;
+static int32_t gCacheIndexUsed = 0;     /* Slots that are not unused, including tombstones. */
+static icu::u_atomic_int32_t gCacheIndexReady = ATOMIC_INT32_T_INITIALIZER(0);
+static icu::u_atomic_int32_t gCacheReaders = ATOMIC_INT32_T_INITIALIZER(0);
+static icu::u_atomic_int32_t gCacheFlushing = ATOMIC_INT32_T_INITIALIZER(0);
 
 static const char **gAvailableConverters = NULL;
 static uint16_t gAvailableConverterCount = 0;
@@ -242,10 +275,16 @@ ucnv_flushAvailableConverterCache() {
 /*                Not thread safe.                                            */
 /*                Not supported API.                                          */
 static UBool U_CALLCONV ucnv_cleanup(void) {
+    /* Pooled idle converters would otherwise keep their shared data alive. */
+    ucnv_flushAllPools();
     ucnv_flushCache();
     if (SHARED_DATA_HASHTABLE != NULL && uhash_count(SHARED_DATA_HASHTABLE) == 0) {
         uhash_close(SHARED_DATA_HASHTABLE);
         SHARED_DATA_HASHTABLE = NULL;
+        icu::umtx_storeRelease(gCacheIndexReady, 0);
+        uprv_free(gCacheIndex);
+        gCacheIndex = NULL;
+        gCacheIndexMask = gCacheIndexUsed = 0;
     }
 
     /* Isn't called from flushCache because other threads may have preexisting references to the table. */
@@ -426,6 +465,137 @@ getAlgorithmicTypeFromName(const char *realName)
 */
 #define UCNV_CACHE_LOAD_FACTOR 2
 
+/*
+ * UConverterSharedData is also visible to C code,
+ * so its referenceCounter is a plain integer there.
+ * In this file it is only accessed through these atomic helpers.
+ */
+static_assert(sizeof(icu::u_atomic_int32_t) == sizeof(uint32_t),
+              "UConverterSharedData.referenceCounter must fit an atomic int32_t");
+
+static inline icu::u_atomic_int32_t *
+ucnv_refCounter(UConverterSharedData *sharedData) {
+    return reinterpret_cast<icu::u_atomic_int32_t *>(&sharedData->referenceCounter);
+}
+
+static inline int32_t
+ucnv_getRefCount(UConverterSharedData *sharedData) {
+    return icu::umtx_loadAcquire(*ucnv_refCounter(sharedData));
+}
+
+static inline int32_t
+ucnv_hashConverterName(const char *name) {
+    return ustr_hashCharsN(name, (int32_t)uprv_strlen(name)) | 1;
+}
+
+/* Enter cached shared data into the lock-free index. cnvCacheMutex must be held. */
+static void
+ucnv_addToCacheIndex(UConverterSharedData *data) {
+    if (gCacheIndex == NULL) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        int32_t capacity = 64;
+        while (capacity < ucnv_io_countKnownConverters(&errorCode) * UCNV_CACHE_LOAD_FACTOR) {
+            capacity <<= 1;
+        }
+        gCacheIndex = (CnvCacheSlot *)uprv_malloc(capacity * sizeof(CnvCacheSlot));
+        if (gCacheIndex == NULL) {
+            return;
+        }
+        for (int32_t i = 0; i < capacity; ++i) {
+            icu::umtx_storeRelease(gCacheIndex[i].hash, 0);
+            gCacheIndex[i].name = NULL;
+            gCacheIndex[i].sharedData = NULL;
+        }
+        gCacheIndexMask = capacity - 1;
+        gCacheIndexUsed = 0;
+        icu::umtx_storeRelease(gCacheIndexReady, 1);
+    }
+
+    const char *name = data->staticData->name;
+    int32_t hash = ucnv_hashConverterName(name);
+    int32_t i = hash & gCacheIndexMask;
+    for (;;) {
+        int32_t slotHash = icu::umtx_loadAcquire(gCacheIndex[i].hash);
+        if (slotHash == CNV_CACHE_TOMBSTONE) {
+            /* Reuse: no reader still references the flushed entry. */
+            break;
+        } else if (slotHash == 0) {
+            /* Keep at least a quarter of the slots unused so that probing terminates quickly. */
+            if (gCacheIndexUsed >= ((gCacheIndexMask + 1) * 3) / 4) {
+                return;
+            }
+            ++gCacheIndexUsed;
+            break;
+        }
+        i = (i + 1) & gCacheIndexMask;
+    }
+    gCacheIndex[i].name = name;
+    gCacheIndex[i].sharedData = data;
+    icu::umtx_storeRelease(gCacheIndex[i].hash, hash);
+}
+
+/*
+ * Turn the index slot for the shared data into a tombstone.
+ * cnvCacheMutex must be held, and there must not be any readers (see ucnv_flushCache()).
+ */
+static void
+ucnv_removeFromCacheIndex(const UConverterSharedData *data) {
+    if (gCacheIndex == NULL) {
+        return;
+    }
+    int32_t hash = ucnv_hashConverterName(data->staticData->name);
+    int32_t i = hash & gCacheIndexMask;
+    int32_t slotHash;
+    while ((slotHash = icu::umtx_loadAcquire(gCacheIndex[i].hash)) != 0) {
+        if (slotHash == hash && gCacheIndex[i].sharedData == data) {
+            gCacheIndex[i].name = NULL;
+            gCacheIndex[i].sharedData = NULL;
+            icu::umtx_storeRelease(gCacheIndex[i].hash, CNV_CACHE_TOMBSTONE);
+            return;
+        }
+        i = (i + 1) & gCacheIndexMask;
+    }
+}
+
+/*
+ * Look up a converter name in the lock-free index, without cnvCacheMutex.
+ * @return the shared data with its reference counter incremented,
+ *         or NULL if the caller needs to take the mutex path
+ */
+static UConverterSharedData *
+ucnv_getCachedConverterData(const char *name) {
+    if (icu::umtx_loadAcquire(gCacheIndexReady) == 0) {
+        return NULL;
+    }
+    UConverterSharedData *result = NULL;
+    /*
+     * Announce this reader before checking for a concurrent ucnv_flushCache().
+     * This is a Dekker-style handshake: Each side increments its own counter,
+     * then loads the other side's. At least one side must see the other's
+     * increment, which requires store-load ordering. The acquire load alone
+     * does not provide that, even after the read-modify-write, so both sides
+     * place a sequentially consistent fence between the increment and the load.
+     * The acquire load then orders the following slot reads after the check.
+     */
+    icu::umtx_atomic_inc(&gCacheReaders);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (icu::umtx_loadAcquire(gCacheFlushing) == 0) {
+        int32_t hash = ucnv_hashConverterName(name);
+        int32_t i = hash & gCacheIndexMask;
+        int32_t slotHash;
+        while ((slotHash = icu::umtx_loadAcquire(gCacheIndex[i].hash)) != 0) {
+            if (slotHash == hash && uprv_strcmp(gCacheIndex[i].name, name) == 0) {
+                result = gCacheIndex[i].sharedData;
+                icu::umtx_atomic_inc(ucnv_refCounter(result));
+                break;
+            }
+            i = (i + 1) & gCacheIndexMask;
+        }
+    }
+    icu::umtx_atomic_dec(&gCacheReaders);
+    return result;
+}
+
 /* Puts the shared data in the static hashtable SHARED_DATA_HASHTABLE */
 /*   Will always be called with the cnvCacheMutex alrady being held   */
 /*     by the calling function.                                       */
@@ -441,9 +611,9 @@ ucnv_shareConverterData(UConverterSharedData * data)
 
     if (SHARED_DATA_HASHTABLE == NULL)
     {
-        SHARED_DATA_HASHTABLE = uhash_openSize(uhash_hashChars, uhash_compareChars, NULL,
+        SHARED_DATA_HASHTABLE = uhash_openSizeWithFlags(uhash_hashChars, uhash_compareChars, NULL,
                             ucnv_io_countKnownConverters(&err)*UCNV_CACHE_LOAD_FACTOR,
-                            &err);
+                            UHASH_GROUP_PROBING, &err);
         ucnv_enableCleanup();
 
         if (U_FAILURE(err))
@@ -471,6 +641,10 @@ ucnv_shareConverterData(UConverterSharedData * data)
             &err);
     UCNV_DEBUG_LOG("put", data->staticData->name,data);
 
+    if (U_SUCCESS(err)) {
+        ucnv_addToCacheIndex(data);
+    }
+
 }
 
 /*  Look up a converter name in the shared data cache.                    */
@@ -514,7 +688,7 @@ ucnv_deleteSharedConverterData(UConverterSharedData * deadSharedData)
     UTRACE_ENTRY_OC(UTRACE_UCNV_UNLOAD);
     UTRACE_DATA2(UTRACE_OPEN_CLOSE, "unload converter %s shared data %p", deadSharedData->staticData->name, deadSharedData);
 
-    if (deadSharedData->referenceCounter > 0) {
+    if (ucnv_getRefCount(deadSharedData) > 0) {
         UTRACE_EXIT_VALUE((int32_t)FALSE);
         return FALSE;
     }
@@ -571,7 +745,7 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
     {
         /* The data for this converter was already in the cache.            */
         /* Update the reference counter on the shared data: one more client */
-        mySharedConverterData->referenceCounter++;
+        icu::umtx_atomic_inc(ucnv_refCounter(mySharedConverterData));
     }
 
     return mySharedConverterData;
@@ -579,17 +753,22 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
 
 /**
  * Unload a non-algorithmic converter.
- * It must be sharedData->isReferenceCounted
- * and this function must be called inside umtx_lock(&cnvCacheMutex).
+ * It must be sharedData->isReferenceCounted.
+ * The reference counter is decremented atomically, without cnvCacheMutex.
+ * Cached shared data is only deleted by ucnv_flushCache();
+ * uncached shared data is deleted by whoever releases the last reference.
  */
 U_CAPI void
 ucnv_unload(UConverterSharedData *sharedData) {
     if(sharedData != NULL) {
-        if (sharedData->referenceCounter > 0) {
-            sharedData->referenceCounter--;
-        }
+        /*
+         * Read the flag before giving up the reference:
+         * Once the counter is 0, ucnv_flushCache() may delete cached shared data.
+         */
+        UBool isCached = sharedData->sharedDataCached;
+        int32_t count = icu::umtx_atomic_dec(ucnv_refCounter(sharedData));
 
-        if((sharedData->referenceCounter <= 0)&&(sharedData->sharedDataCached == FALSE)) {
+        if((count <= 0)&&(isCached == FALSE)) {
             ucnv_deleteSharedConverterData(sharedData);
         }
     }
@@ -599,9 +778,7 @@ U_CFUNC void
 ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData)
 {
     if(sharedData != NULL && sharedData->isReferenceCounted) {
-        umtx_lock(&cnvCacheMutex);
         ucnv_unload(sharedData);
-        umtx_unlock(&cnvCacheMutex);
     }
 }
 
@@ -609,9 +786,7 @@ U_CFUNC void
 ucnv_incrementRefCount(UConverterSharedData *sharedData)
 {
     if(sharedData != NULL && sharedData->isReferenceCounted) {
-        umtx_lock(&cnvCacheMutex);
-        sharedData->referenceCounter++;
-        umtx_unlock(&cnvCacheMutex);
+        icu::umtx_atomic_inc(ucnv_refCounter(sharedData));
     }
 }
 
@@ -749,6 +924,8 @@ ucnv_loadSharedData(const char *converterName,
     pArgs->locale = pPieces->locale;
     pArgs->options = pPieces->options;
 
+    pArgs->isStandard = TRUE;
+
     /* In case "name" is NULL we want to open the default converter. */
     if (converterName == NULL) {
 #if U_CHARSET_IS_UTF8
@@ -788,6 +965,8 @@ ucnv_loadSharedData(const char *converterName,
             * without updating the alias table, or when there is no alias table
             */
             pArgs->name = pPieces->cnvName;
+            /* For example, a file path. */
+            pArgs->isStandard = FALSE;
         } else if (internalErrorCode == U_AMBIGUOUS_ALIAS_WARNING) {
             *err = U_AMBIGUOUS_ALIAS_WARNING;
         }
@@ -805,16 +984,20 @@ ucnv_loadSharedData(const char *converterName,
     if (mySharedConverterData == NULL)
     {
         /* it is a data-based converter, get its shared data.               */
-        /* Hold the cnvCacheMutex through the whole process of checking the */
-        /*   converter data cache, and adding new entries to the cache      */
-        /*   to prevent other threads from modifying the cache during the   */
-        /*   process.                                                       */
+        /* Already-cached converters are found without locking.             */
+        /* Otherwise, hold the cnvCacheMutex through the whole process of   */
+        /*   checking the converter data cache, and adding new entries to   */
+        /*   the cache to prevent other threads from modifying the cache    */
+        /*   during the process.                                            */
         pArgs->nestedLoads=1;
         pArgs->pkg=NULL;
 
-        umtx_lock(&cnvCacheMutex);
-        mySharedConverterData = ucnv_load(pArgs, err);
-        umtx_unlock(&cnvCacheMutex);
+        mySharedConverterData = ucnv_getCachedConverterData(pArgs->name);
+        if (mySharedConverterData == NULL) {
+            umtx_lock(&cnvCacheMutex);
+            mySharedConverterData = ucnv_load(pArgs, err);
+            umtx_unlock(&cnvCacheMutex);
+        }
         if (U_FAILURE (*err) || (mySharedConverterData == NULL))
         {
             return NULL;
@@ -998,6 +1181,7 @@ ucnv_createConverterFromSharedData(UConverter *myUConverter,
     uprv_memset(myUConverter, 0, sizeof(UConverter));
     myUConverter->isCopyLocal = isCopyLocal;
     /*myUConverter->isExtraLocal = FALSE;*/ /* Set by the memset call */
+    myUConverter->isPoolable = pArgs->isStandard;
     myUConverter->sharedData = mySharedConverterData;
     myUConverter->options = pArgs->options;
     if(!pArgs->onlyTestIsLoadable) {
@@ -1055,13 +1239,23 @@ ucnv_flushCache ()
     *
     * Synchronization:  holding cnvCacheMutex will prevent any other thread from
     *                   accessing or modifying the hash table during the iteration.
+    *                   Setting gCacheFlushing sends new lock-free lookups to the
+    *                   mutex path, and waiting for gCacheReaders to drop to 0
+    *                   lets in-flight lookups finish.
     *                   The reference count of an entry may be decremented by
     *                   ucnv_close while the iteration is in process, but this is
     *                   benign.  It can't be incremented (in ucnv_createConverter())
-    *                   because the sequence of looking up in the cache + incrementing
-    *                   is protected by cnvCacheMutex.
+    *                   because both the lock-free lookup and the sequence of
+    *                   looking up in the cache + incrementing under cnvCacheMutex
+    *                   are blocked until the flush is done.
     */
     umtx_lock(&cnvCacheMutex);
+    icu::umtx_atomic_inc(&gCacheFlushing);
+    /* Pairs with the fence in ucnv_getCachedConverterData(). */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (icu::umtx_loadAcquire(gCacheReaders) != 0) {
+        /* Lock-free lookups are short and never block; just spin. */
+    }
     /*
      * double loop: A delta/extension-only converter has a pointer to its base table's
      * shared data; the first iteration of the outer loop may see the delta converter
@@ -1076,12 +1270,13 @@ ucnv_flushCache ()
         {
             mySharedData = (UConverterSharedData *) e->value.pointer;
             /*deletes only if reference counter == 0 */
-            if (mySharedData->referenceCounter == 0)
+            if (ucnv_getRefCount(mySharedData) == 0)
             {
                 tableDeletedNum++;
 
                 UCNV_DEBUG_LOG("del",mySharedData->staticData->name,mySharedData);
 
+                ucnv_removeFromCacheIndex(mySharedData);
                 uhash_removeElement(SHARED_DATA_HASHTABLE, e);
                 mySharedData->sharedDataCached = FALSE;
                 ucnv_deleteSharedConverterData (mySharedData);
@@ -1090,6 +1285,7 @@ ucnv_flushCache ()
             }
         }
     } while(++i == 1 && remaining > 0);
+    icu::umtx_atomic_dec(&gCacheFlushing);
     umtx_unlock(&cnvCacheMutex);
 
     UTRACE_DATA1(UTRACE_INFO, "ucnv_flushCache() exits with %d converters remaining", remaining);
@@ -52,7 +52,7 @@ typedef struct {
     int32_t size;               /* sizeof(UConverterLoadArgs) */
     int32_t nestedLoads;        /* count nested ucnv_load() calls */
     UBool onlyTestIsLoadable;   /* input: don't actually load */
-    UBool reserved0;            /* reserved - for good alignment of the pointers */
+    UBool isStandard;           /* output: name found in the alias table, or the default or UTF-8 converter; FALSE for a package or file path */
     int16_t reserved;           /* reserved - for good alignment of the pointers */
     uint32_t options;
     const char *pkg, *name, *locale;
@@ -127,6 +127,14 @@ ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData);
 U_CFUNC void
 ucnv_incrementRefCount(UConverterSharedData *sharedData);
 
+/**
+ * Closes the idle converters in the ucnv_acquire() pools of all threads.
+ * Called from ucnv_cleanup(); not thread safe with respect to
+ * ucnv_acquire() and ucnv_release() in other threads.
+ */
+U_CFUNC void
+ucnv_flushAllPools(void);
+
 /**
  * These are the default error handling callbacks for the charset conversion framework.
  * For performance reasons, they are only called to handle an error (not normally called for a reset or close).
@@ -44,6 +44,7 @@
 #include "cmemory.h"
 #include "ucnv_io.h"
 #include "uenumimp.h"
+#include "uinvchar.h"
 #include "ucln_cmn.h"
 
 /* Format of cnvalias.icu -----------------------------------------------------
@@ -115,6 +116,20 @@
  * and all strings lowercased. In the future, the options in section 7 may state
  * other types of normalization.
  *
+ * 10) When the table of contents lists 10 sections, this is an optional
+ * perfect-hash index over the normalized strings of the 3rd section, so that
+ * an alias can be found with one hash computation and one string comparison
+ * instead of a binary search. The formatVersion is not changed for this
+ * section; readers that do not know it skip it by its length in the TOC.
+ * Each normalized alias is hashed with ucnv_io_hashNormalizedName();
+ * the low bits of the hash select a bucket, and the bucket's displacement
+ * value selects the slot via ucnv_io_getHashSlot(). The slot contains
+ * the index into the 3rd section.
+ * See UCNV_IO_HASH_HEADER_LENGTH for the layout. This section is only written
+ * together with section 9. The hash is computed on the ASCII form of the
+ * names so that the index remains valid when the table is swapped to
+ * a different charset family; the swapper then only renumbers the slots.
+ *
  * Here is the concept of section 5 and 6. It's a 3D cube. Each tag
  * has a unique alias among all converters. That same alias can
  * be mentioned in other standards on different converters,
@@ -188,6 +203,7 @@ enum {
     tableOptionsIndex=7,
     stringTableIndex=8,
     normalizedStringTableIndex=9,
+    perfectHashTableIndex=10,
     offsetsCount,    /* length of the swapper's temporary offsets[] */
     minTocLength=8 /* min. tocLength in the file, does not count the tocLengthIndex! */
 };
@@ -267,6 +283,9 @@ static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     if (tableStart > 8) {
         gMainTable.normalizedStringTableSize = sectionSizes[9];
     }
+    if (tableStart > 9) {
+        gMainTable.perfectHashTableSize = sectionSizes[10];
+    }
 
     currOffset = tableStart * (sizeof(uint32_t)/sizeof(uint16_t)) + (sizeof(uint32_t)/sizeof(uint16_t));
     gMainTable.converterList = table + currOffset;
@@ -306,6 +325,24 @@ static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     currOffset += gMainTable.stringTableSize;
     gMainTable.normalizedStringTable = ((gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED)
         ? gMainTable.stringTable : (table + currOffset));
+
+    currOffset += gMainTable.normalizedStringTableSize;
+    if (gMainTable.perfectHashTableSize >= UCNV_IO_HASH_HEADER_LENGTH
+        && gMainTable.optionTable->stringNormalizationType == UCNV_IO_STD_NORMALIZED)
+    {
+        const uint16_t *hashTable = table + currOffset;
+        uint32_t bucketBits = hashTable[0], slotBits = hashTable[1];
+        /* A zero slotBits value marks an index that is disabled or does not fit the data. */
+        if (0 < slotBits && slotBits <= UCNV_IO_MAX_HASH_BITS && bucketBits <= UCNV_IO_MAX_HASH_BITS
+            && gMainTable.perfectHashTableSize ==
+                UCNV_IO_HASH_HEADER_LENGTH + ((uint32_t)1 << bucketBits) + ((uint32_t)1 << slotBits))
+        {
+            gMainTable.perfectHashTable = hashTable;
+        }
+    }
+    if (gMainTable.perfectHashTable == NULL) {
+        gMainTable.perfectHashTableSize = 0;
+    }
 }
 
 
@@ -453,6 +490,44 @@ ucnv_io_stripEBCDICForCompare(char *dst, const char *name) {
     return dst;
 }
 
+/*
+ * FNV-1a over the normalized name, with a final avalanche step
+ * so that the low bits are usable as the bucket index.
+ */
+static inline uint32_t
+hashNormalizedName(const char *name) {
+    uint32_t hash = 0x811c9dc5;
+    uint8_t c;
+    while ((c = (uint8_t)*name++) != 0) {
+#if U_CHARSET_FAMILY==U_EBCDIC_FAMILY
+        c = (uint8_t)uprv_ebcdicToLowercaseAscii((char)c);
+#endif
+        hash = (hash ^ c) * 0x01000193;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+static inline uint32_t
+getHashSlot(uint32_t hash, uint32_t displacement, uint32_t slotMask) {
+    hash ^= displacement * 0x9e3779b9;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash & slotMask;
+}
+
+U_CAPI uint32_t U_EXPORT2
+ucnv_io_hashNormalizedName(const char *name) {
+    return hashNormalizedName(name);
+}
+
+U_CAPI uint32_t U_EXPORT2
+ucnv_io_getHashSlot(uint32_t hash, uint32_t displacement, uint32_t slotMask) {
+    return getHashSlot(hash, displacement, slotMask);
+}
+
 /**
  * Do a fuzzy compare of two converter/alias names.
  * The comparison is case-insensitive, ignores leading zeroes if they are not
@@ -544,6 +619,53 @@ ucnv_compareNames(const char *name1, const char *name2) {
     }
 }
 
+/*
+ * map the index of a found alias to the converter number index for gConverterList
+ */
+static inline uint32_t
+getAliasConverterIndex(uint32_t aliasIndex, UBool *containsOption, UErrorCode *pErrorCode) {
+    uint16_t convIndex = gMainTable.untaggedConvArray[aliasIndex];
+
+    /* Since the gencnval tool folds duplicates into one entry,
+     * this alias in gAliasList is unique, but different standards
+     * may map an alias to different converters.
+     */
+    if (convIndex & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
+        *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
+    }
+    /* State whether the canonical converter name contains an option.
+    This information is contained in this list in order to maintain backward & forward compatibility. */
+    if (containsOption) {
+        UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
+        *containsOption = (UBool)((containsCnvOptionInfo
+            && ((convIndex & UCNV_CONTAINS_OPTION_BIT) != 0))
+            || !containsCnvOptionInfo);
+    }
+    return convIndex & UCNV_CONVERTER_INDEX_MASK;
+}
+
+/*
+ * search for a normalized alias in the perfect-hash index
+ * return the index into gMainTable.aliasList, or UINT32_MAX if not found
+ */
+static inline uint32_t
+findAliasByHash(const char *normalizedAlias) {
+    const uint16_t *hashTable = gMainTable.perfectHashTable;
+    uint32_t bucketMask = ((uint32_t)1 << hashTable[0]) - 1;
+    uint32_t slotMask = ((uint32_t)1 << hashTable[1]) - 1;
+    uint32_t hash = hashNormalizedName(normalizedAlias);
+    uint32_t displacement = hashTable[UCNV_IO_HASH_HEADER_LENGTH + (hash & bucketMask)];
+    uint32_t aliasIndex = hashTable[UCNV_IO_HASH_HEADER_LENGTH + bucketMask + 1 +
+                                    getHashSlot(hash, displacement, slotMask)];
+
+    /* The index is perfect for the known aliases; one comparison rejects any other name. */
+    if (aliasIndex < gMainTable.untaggedConvArraySize &&
+            uprv_strcmp(normalizedAlias, GET_NORMALIZED_STRING(gMainTable.aliasList[aliasIndex])) == 0) {
+        return aliasIndex;
+    }
+    return UINT32_MAX;
+}
+
 /*
  * search for an alias
  * return the converter number index for gConverterList
@@ -565,6 +687,14 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         /* Lower case and remove ignoreable characters. */
         ucnv_io_stripForCompare(strippedName, alias);
         alias = strippedName;
+
+        if (gMainTable.perfectHashTable != NULL) {
+            mid = findAliasByHash(alias);
+            if (mid == UINT32_MAX) {
+                return UINT32_MAX;
+            }
+            return getAliasConverterIndex(mid, containsOption, pErrorCode);
+        }
     }
 
     /* do a binary search for the alias */
@@ -591,22 +721,7 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         } else if (result > 0) {
             start = mid;
         } else {
-            /* Since the gencnval tool folds duplicates into one entry,
-             * this alias in gAliasList is unique, but different standards
-             * may map an alias to different converters.
-             */
-            if (gMainTable.untaggedConvArray[mid] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
-                *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
-            }
-            /* State whether the canonical converter name contains an option.
-            This information is contained in this list in order to maintain backward & forward compatibility. */
-            if (containsOption) {
-                UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
-                *containsOption = (UBool)((containsCnvOptionInfo
-                    && ((gMainTable.untaggedConvArray[mid] & UCNV_CONTAINS_OPTION_BIT) != 0))
-                    || !containsCnvOptionInfo);
-            }
-            return gMainTable.untaggedConvArray[mid] & UCNV_CONVERTER_INDEX_MASK;
+            return getAliasConverterIndex(mid, containsOption, pErrorCode);
         }
     }
 
@@ -1240,6 +1355,11 @@ ucnv_swapAliases(const UDataSwapper *ds,
                             2*(int32_t)(offsets[stringTableIndex]-offsets[converterListIndex]),
                             outTable+offsets[converterListIndex],
                             pErrorCode);
+            ds->swapArray16(ds,
+                            inTable+offsets[perfectHashTableIndex],
+                            2*(int32_t)toc[perfectHashTableIndex],
+                            outTable+offsets[perfectHashTableIndex],
+                            pErrorCode);
         } else {
             /* allocate the temporary table for sorting */
             count=toc[aliasListIndex];
@@ -1320,6 +1440,38 @@ ucnv_swapAliases(const UDataSwapper *ds,
                 }
             }
 
+            /*
+             * Swap the perfect-hash index. The hash codes do not depend on the
+             * charset family, but the slots must be mapped from the old to the
+             * new alias indexes.
+             */
+            if(U_SUCCESS(*pErrorCode)) {
+                const uint16_t *inHash=inTable+offsets[perfectHashTableIndex];
+                uint16_t *outHash=outTable+offsets[perfectHashTableIndex];
+                uint32_t hashLength=toc[perfectHashTableIndex], slotsStart=hashLength;
+                uint16_t value;
+
+                if(hashLength>=UCNV_IO_HASH_HEADER_LENGTH) {
+                    uint32_t bucketBits=ds->readUInt16(inHash[0]), slotBits=ds->readUInt16(inHash[1]);
+                    if(bucketBits<=UCNV_IO_MAX_HASH_BITS && slotBits<=UCNV_IO_MAX_HASH_BITS &&
+                        hashLength==UCNV_IO_HASH_HEADER_LENGTH+((uint32_t)1<<bucketBits)+((uint32_t)1<<slotBits)
+                    ) {
+                        slotsStart=UCNV_IO_HASH_HEADER_LENGTH+((uint32_t)1<<bucketBits);
+                    }
+                }
+                if(slotsStart<hashLength) {
+                    uint16_t *r=tempTable.resort;
+                    for(i=0; i<count; ++i) {
+                        r[tempTable.rows[i].sortIndex]=(uint16_t)i;
+                    }
+                    for(i=slotsStart; i<hashLength; ++i) {
+                        value=ds->readUInt16(inHash[i]);
+                        ds->writeUInt16(outHash+i, value<count ? r[value] : value);
+                    }
+                }
+                ds->swapArray16(ds, inHash, 2*(int32_t)slotsStart, outHash, pErrorCode);
+            }
+
             if(tempTable.rows!=rows) {
                 uprv_free(tempTable.rows);
             }
@@ -48,6 +48,7 @@ typedef struct UConverterAlias {
     const UConverterAliasOptions *optionTable;
     const uint16_t *stringTable;
     const uint16_t *normalizedStringTable;
+    const uint16_t *perfectHashTable;
 
     uint32_t converterListSize;
     uint32_t tagListSize;
@@ -58,8 +59,22 @@ typedef struct UConverterAlias {
     uint32_t optionTableSize;
     uint32_t stringTableSize;
     uint32_t normalizedStringTableSize;
+    uint32_t perfectHashTableSize;
 } UConverterAlias;
 
+/*
+ * Layout of the optional perfect-hash index of the alias table (section 10),
+ * in uint16_t units:
+ * [0] number of bits for the bucket count
+ * [1] number of bits for the slot count, 0 if the index is disabled
+ * then one displacement per bucket,
+ * then one aliasList index per slot, UCNV_IO_EMPTY_HASH_SLOT if unused.
+ * See ucnv_io_hashNormalizedName() and ucnv_io_getHashSlot().
+ */
+#define UCNV_IO_HASH_HEADER_LENGTH 2
+#define UCNV_IO_MAX_HASH_BITS 16
+#define UCNV_IO_EMPTY_HASH_SLOT 0xFFFF
+
 /**
  * \var ucnv_io_stripForCompare
  * Remove the underscores, dashes and spaces from the name, and convert
@@ -83,6 +98,27 @@ ucnv_io_stripASCIIForCompare(char *dst, const char *name);
 U_CAPI char * U_CALLCONV
 ucnv_io_stripEBCDICForCompare(char *dst, const char *name);
 
+/**
+ * Hash a converter name that has already been normalized with
+ * ucnv_io_stripForCompare(), for the perfect-hash index of the alias table.
+ * The hash code is the same for the ASCII and EBCDIC forms of a name.
+ * @param name The normalized, NUL-terminated name.
+ * @return the 32-bit hash code
+ */
+U_CAPI uint32_t U_EXPORT2
+ucnv_io_hashNormalizedName(const char *name);
+
+/**
+ * Map a name's hash code and its bucket's displacement to
+ * a slot in the perfect-hash index of the alias table.
+ * @param hash The hash code from ucnv_io_hashNormalizedName().
+ * @param displacement The displacement value of the bucket (hash & (bucketCount-1)).
+ * @param slotMask The slot count minus 1.
+ * @return the slot index
+ */
+U_CAPI uint32_t U_EXPORT2
+ucnv_io_getHashSlot(uint32_t hash, uint32_t displacement, uint32_t slotMask);
+
 /**
  * Map a converter alias name to a canonical converter name.
  * The alias is searched for case-insensitively, the converter name
@@ -22,9 +22,12 @@
 
 #include "unicode/ucnv.h"
 #include "unicode/uversion.h"
+#include "unicode/utf8.h"
+#include "unicode/utf16.h"
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "usimd.h"
 
 enum {
     UCNV_NEED_TO_WRITE_BOM=1
@@ -39,6 +42,206 @@ static void  U_CALLCONV
 _UTF16ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                            UErrorCode *pErrorCode);
 
+/* UTF-8 <-> UTF-16BE/LE without pivoting ---------------------------------- */
+
+/*
+ * Direct conversion between UTF-8 and UTF-16BE/LE for ucnv_convertEx().
+ * hi and lo are the offsets of the high and low bytes of a code unit.
+ *
+ * Only well-formed text without pending converter state is handled here.
+ * Partial characters, the BOM, illegal sequences and partial-character
+ * target overflows are left to the pivoting implementation
+ * by returning U_USING_DEFAULT_WARNING.
+ */
+static void
+_UTF16FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+               UConverterToUnicodeArgs *pToUArgs,
+               int32_t hi, int32_t lo,
+               UErrorCode *pErrorCode) {
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+    int32_t i, length;
+    UChar32 c;
+
+    if( pToUArgs->converter->toULength>0 ||
+        pFromUArgs->converter->fromUChar32!=0 ||
+        pFromUArgs->converter->fromUnicodeStatus==UCNV_NEED_TO_WRITE_BOM
+    ) {
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    /* stop before a truncated sequence at the end of the input */
+    length=(int32_t)(sourceLimit-source);
+    U8_TRUNCATE_IF_INCOMPLETE(source, 0, length);
+    sourceLimit=source+length;
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        /* convert a run of ASCII bytes */
+        length=(int32_t)(sourceLimit-source);
+        if(length>((targetLimit-target)>>1)) {
+            length=(int32_t)((targetLimit-target)>>1);
+        }
+        length=usimd_asciiPrefixLength(source, length);
+        for(i=0; i<length; ++i) {
+            target[hi]=0;
+            target[lo]=*source++;
+            target+=2;
+        }
+        if(source==sourceLimit) {
+            break;
+        }
+
+        i=0;
+        U8_NEXT(source, i, sourceLimit-source, c);
+        if(c<0) {
+            /* illegal sequence: callback handling in the pivoting implementation */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        if((targetLimit-target)<(c<=0xffff ? 2 : 4)) {
+            if(target==targetLimit) {
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            } else {
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+            }
+            break;
+        }
+        source+=i;
+        if(c<=0xffff) {
+            target[hi]=(uint8_t)(c>>8);
+            target[lo]=(uint8_t)c;
+            target+=2;
+        } else {
+            UChar lead=U16_LEAD(c), trail=U16_TRAIL(c);
+            target[hi]=(uint8_t)(lead>>8);
+            target[lo]=(uint8_t)lead;
+            target[2+hi]=(uint8_t)(trail>>8);
+            target[2+lo]=(uint8_t)trail;
+            target+=4;
+        }
+    }
+
+    if(U_SUCCESS(*pErrorCode) && source<(const uint8_t *)pToUArgs->sourceLimit) {
+        /* collect the truncated sequence in the pivoting implementation */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
+static void
+_UTF16ToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+             UConverterToUnicodeArgs *pToUArgs,
+             int32_t hi, int32_t lo,
+             UErrorCode *pErrorCode) {
+    UConverter *utf16=pToUArgs->converter;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+    int32_t i, length, sourceLength;
+    UChar32 c;
+    UChar trail;
+
+    if( utf16->mode<8 || utf16->toULength>0 || utf16->toUnicodeStatus!=0 ||
+        pFromUArgs->converter->fromUChar32!=0
+    ) {
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    /* conversion loop */
+    while((sourceLimit-source)>=2) {
+        c=((UChar32)source[hi]<<8)|source[lo];
+        if(c<=0x7f) {
+            if(target==targetLimit) {
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+                break;
+            }
+            *target++=(uint8_t)c;
+            source+=2;
+            continue;
+        } else if(!U16_IS_SURROGATE(c)) {
+            sourceLength=2;
+        } else if( U16_IS_SURROGATE_LEAD(c) && (sourceLimit-source)>=4 &&
+                   U16_IS_TRAIL(trail=(UChar)((source[2+hi]<<8)|source[2+lo]))
+        ) {
+            c=U16_GET_SUPPLEMENTARY(c, trail);
+            sourceLength=4;
+        } else {
+            /* unpaired or truncated surrogate: handle in the pivoting implementation */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        length=U8_LENGTH(c);
+        if((targetLimit-target)<length) {
+            if(target==targetLimit) {
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            } else {
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+            }
+            break;
+        }
+        i=0;
+        U8_APPEND_UNSAFE(target, i, c);
+        target+=i;
+        source+=sourceLength;
+    }
+
+    if(U_SUCCESS(*pErrorCode) && source<sourceLimit) {
+        /* collect the odd trailing byte in the pivoting implementation */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
+static void U_CALLCONV
+_UTF16BEFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                 UConverterToUnicodeArgs *pToUArgs,
+                 UErrorCode *pErrorCode) {
+    _UTF16FromUTF8(pFromUArgs, pToUArgs, 0, 1, pErrorCode);
+}
+
+static void U_CALLCONV
+_UTF16BEToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+               UConverterToUnicodeArgs *pToUArgs,
+               UErrorCode *pErrorCode) {
+    _UTF16ToUTF8(pFromUArgs, pToUArgs, 0, 1, pErrorCode);
+}
+
+static void U_CALLCONV
+_UTF16LEFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                 UConverterToUnicodeArgs *pToUArgs,
+                 UErrorCode *pErrorCode) {
+    _UTF16FromUTF8(pFromUArgs, pToUArgs, 1, 0, pErrorCode);
+}
+
+static void U_CALLCONV
+_UTF16LEToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+               UConverterToUnicodeArgs *pToUArgs,
+               UErrorCode *pErrorCode) {
+    _UTF16ToUTF8(pFromUArgs, pToUArgs, 1, 0, pErrorCode);
+}
+
 /* UTF-16BE ----------------------------------------------------------------- */
 
 #if U_IS_BIG_ENDIAN
@@ -629,8 +832,8 @@ static const UConverterImpl _UTF16BEImpl={
     NULL,
     ucnv_getNonSurrogateUnicodeSet,
 
-    NULL,
-    NULL
+    _UTF16BEToUTF8,
+    _UTF16BEFromUTF8
 };
 
 static const UConverterStaticData _UTF16BEStaticData={
@@ -1230,8 +1433,8 @@ static const UConverterImpl _UTF16LEImpl={
     NULL,
     ucnv_getNonSurrogateUnicodeSet,
 
-    NULL,
-    NULL
+    _UTF16LEToUTF8,
+    _UTF16LEFromUTF8
 };
 
 
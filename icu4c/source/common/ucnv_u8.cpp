@@ -33,6 +33,7 @@
 #include "ucnv_cnv.h"
 #include "cmemory.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* Prototypes --------------------------------------------------------------- */
 
@@ -94,6 +95,36 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8 (UConverterToUnicodeArgs * args,
         if (U8_IS_SINGLE(ch))        /* Simple case */
         {
             *(myTarget++) = (UChar) ch;
+
+            /* Widen a following run of ASCII bytes in bulk. */
+            int32_t count = (int32_t)(sourceLimit - mySource);
+            if (count > (targetLimit - myTarget))
+            {
+                count = (int32_t)(targetLimit - myTarget);
+            }
+            if (count > 0 && U8_IS_SINGLE(*mySource))
+            {
+                count = usimd_widenASCII(myTarget, mySource, count);
+                mySource += count;
+                myTarget += count;
+            }
+        }
+        else if ( /* handle U+0800..U+FFFF inline */
+                 0xe0 <= ch && ch < 0xf0 &&
+                 (sourceLimit - mySource) >= 2 &&
+                 U8_IS_VALID_LEAD3_AND_T1(ch, mySource[0]) &&
+                 U8_IS_TRAIL(mySource[1]))
+        {
+            *(myTarget++) = (UChar)(((ch & 0xf) << 12) | ((mySource[0] & 0x3f) << 6) | (mySource[1] & 0x3f));
+            mySource += 2;
+        }
+        else if ( /* handle U+0080..U+07FF inline */
+                 0xc2 <= ch && ch < 0xe0 &&
+                 mySource < sourceLimit &&
+                 U8_IS_TRAIL(*mySource))
+        {
+            *(myTarget++) = (UChar)(((ch & 0x1f) << 6) | (*mySource & 0x3f));
+            ++mySource;
         }
         else
         {
@@ -325,6 +356,19 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8 (UConverterFromUnicodeArgs * args
         if (ch < 0x80)        /* Single byte */
         {
             *(myTarget++) = (uint8_t) ch;
+
+            /* Narrow a following run of ASCII UChars in bulk. */
+            int32_t count = (int32_t)(sourceLimit - mySource);
+            if (count > (targetLimit - myTarget))
+            {
+                count = (int32_t)(targetLimit - myTarget);
+            }
+            if (count > 0 && *mySource < 0x80)
+            {
+                count = usimd_narrowASCII(myTarget, mySource, count);
+                mySource += count;
+                myTarget += count;
+            }
         }
         else if (ch < 0x800)  /* Double byte */
         {
@@ -723,9 +767,15 @@ ucnv_UTF8FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     while(count>0) {
         b=*source++;
         if(U8_IS_SINGLE(b)) {
-            /* convert ASCII */
+            /* convert ASCII, and copy a following run of ASCII bytes in bulk */
             *target++=b;
-            --count;
+            if(--count>0 && U8_IS_SINGLE(*source)) {
+                int32_t n=usimd_asciiPrefixLength(source, count);
+                uprv_memcpy(target, source, n);
+                source+=n;
+                target+=n;
+                count-=n;
+            }
             continue;
         } else {
             if(b>=0xe0) {
@@ -24,6 +24,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* control optimizations according to the platform */
 #define LATIN1_UNROLL_FROM_UNICODE 1
@@ -380,9 +381,19 @@ ucnv_Latin1FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         if(targetCapacity>0) {
             b=*source++;
             if(U8_IS_SINGLE(b)) {
-                /* convert ASCII */
+                /* convert ASCII, and copy a following run of ASCII bytes in bulk */
                 *target++=(uint8_t)b;
-                --targetCapacity;
+                if(--targetCapacity>0) {
+                    int32_t length=(int32_t)(sourceLimit-source);
+                    if(length>targetCapacity) {
+                        length=targetCapacity;
+                    }
+                    length=usimd_asciiPrefixLength(source, length);
+                    uprv_memcpy(target, source, length);
+                    source+=length;
+                    target+=length;
+                    targetCapacity-=length;
+                }
             } else if( /* handle U+0080..U+00FF inline */
                        b>=0xc2 && b<=0xc3 &&
                        (t1=(uint8_t)(*source-0x80)) <= 0x3f
@@ -422,6 +433,65 @@ ucnv_Latin1FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/*
+ * Convert Latin-1 to UTF-8 without pivoting through UTF-16.
+ * Latin-1 has no toUnicode state and never yields surrogates,
+ * so the only special case is a 2-byte sequence that does not fit
+ * into the target.
+ */
+static void U_CALLCONV
+ucnv_Latin1ToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+    int32_t length;
+    uint8_t b;
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        /* copy a run of ASCII bytes */
+        length=(int32_t)(sourceLimit-source);
+        if(length>(targetLimit-target)) {
+            length=(int32_t)(targetLimit-target);
+        }
+        length=usimd_asciiPrefixLength(source, length);
+        uprv_memcpy(target, source, length);
+        source+=length;
+        target+=length;
+        if(source==sourceLimit) {
+            break;
+        }
+
+        if((targetLimit-target)<2) {
+            if(target<targetLimit && *source>=0x80) {
+                /* partial-character target overflow: fall back to the pivoting implementation */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+            } else {
+                /* target is full */
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            }
+            break;
+        }
+
+        /* U+0080..U+00FF */
+        b=*source++;
+        *target++=(uint8_t)((b>>6)|0xc0);
+        *target++=(uint8_t)((b&0x3f)|0x80);
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 static void U_CALLCONV
 _Latin1GetUnicodeSet(const UConverter *cnv,
                      const USetAdder *sa,
@@ -457,7 +527,7 @@ static const UConverterImpl _Latin1Impl={
     NULL,
     _Latin1GetUnicodeSet,
 
-    NULL,
+    ucnv_Latin1ToUTF8,
     ucnv_Latin1FromUTF8
 };
 
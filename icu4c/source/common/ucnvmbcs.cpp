@@ -60,6 +60,7 @@
 #include "cstring.h"
 #include "umutex.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* control optimizations according to the platform */
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
@@ -431,6 +432,16 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode);
+
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +464,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,11 +490,12 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
-static const UConverterImpl _MBCSImpl={
+/* for MBCS tables that are not utf8Friendly, and without SI/SO output */
+static const UConverterImpl _MBCSUTF8Impl={
     UCNV_MBCS,
 
     ucnv_MBCSLoad,
@@ -504,7 +516,34 @@ static const UConverterImpl _MBCSImpl={
     ucnv_MBCSWriteSub,
     NULL,
     ucnv_MBCSGetUnicodeSet,
+
+    ucnv_MBCSToUTF8,
+    ucnv_MBCSFromUTF8
+};
+
+static const UConverterImpl _MBCSImpl={
+    UCNV_MBCS,
+
+    ucnv_MBCSLoad,
+    ucnv_MBCSUnload,
+
+    ucnv_MBCSOpen,
+    NULL,
+    NULL,
+
+    ucnv_MBCSToUnicodeWithOffsets,
+    ucnv_MBCSToUnicodeWithOffsets,
+    ucnv_MBCSFromUnicodeWithOffsets,
+    ucnv_MBCSFromUnicodeWithOffsets,
+    ucnv_MBCSGetNextUChar,
+
+    ucnv_MBCSGetStarters,
+    ucnv_MBCSGetName,
+    ucnv_MBCSWriteSub,
     NULL,
+    ucnv_MBCSGetUnicodeSet,
+
+    ucnv_MBCSToUTF8,
     NULL
 };
 
@@ -534,27 +573,117 @@ const UConverterSharedData _MBCSData={
  * the special callback functions below.
  * The values are start & end of Unicode & GB codes.
  *
+ * The ranges are sorted. GB 18030 assigns its four-byte sequences in
+ * code point order, so they are sorted by their GB codes as well.
+ * The supplementary range is last and ends each search.
+ *
  * Note that single surrogates are not mapped by GB 18030
  * as of the re-released mapping tables from 2000-nov-30.
  */
 static const uint32_t
 gb18030Ranges[14][4]={
-    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)},
-    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
     {0x0452, 0x1E3E, LINEAR(0x8130D330), LINEAR(0x8135F436)},
     {0x1E40, 0x200F, LINEAR(0x8135F438), LINEAR(0x8136A531)},
-    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
     {0x2643, 0x2E80, LINEAR(0x8137A839), LINEAR(0x8138FD38)},
-    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
-    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x361B, 0x3917, LINEAR(0x8230A633), LINEAR(0x8230F237)},
-    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x4160, 0x4336, LINEAR(0x8232C937), LINEAR(0x8232F837)},
-    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
     {0x44D7, 0x464B, LINEAR(0x8233A339), LINEAR(0x8233C931)},
-    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)}
+    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
+    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
+    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
+    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
+    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)},
+    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)}
+};
+
+/* index of the supplementary range in gb18030Ranges */
+#define GB18030_SUPPLEMENTARY_RANGE 13
+
+/* number of four-byte sequences with the same first two bytes */
+#define GB18030_LINEAR_BLOCK_LENGTH (126*10)
+
+/*
+ * Direct indexes into gb18030Ranges, so that a lookup starts at most a
+ * few rows before the matching one:
+ * For each block of 256 BMP code points, the first range that does not end before it.
+ */
+static const uint8_t
+gb18030FromUIndex[0x100]={
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12
+};
+
+/*
+ * For each block of four-byte sequences 81 30..84 39 xx xx with the same
+ * first two bytes, the first range that does not end before it.
+ * The BMP ranges end in block 84 31; the supplementary range starts with 90 30.
+ */
+static const uint8_t
+gb18030ToUIndex[40]={
+    0, 0, 0, 0, 0, 0, 1, 2, 2, 3,
+    3, 4, 4, 6, 7, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 10, 10, 10,
+    10, 11, 13, 13, 13, 13, 13, 13, 13, 13
 };
 
+/*
+ * @return the gb18030Ranges row that contains the code point, or NULL
+ */
+static inline const uint32_t *
+gb18030RangeFromU(UChar32 c) {
+    const uint32_t *range;
+    if((uint32_t)c<=0xffff) {
+        range=gb18030Ranges[gb18030FromUIndex[c>>8]];
+        while((uint32_t)c>range[1]) {
+            range+=4;
+        }
+    } else {
+        range=gb18030Ranges[GB18030_SUPPLEMENTARY_RANGE];
+        if((uint32_t)c>range[1]) {
+            return NULL;
+        }
+    }
+    return range[0]<=(uint32_t)c ? range : NULL;
+}
+
+/*
+ * @param linear the LINEAR_18030() value of a four-byte sequence
+ * @return the gb18030Ranges row that contains the sequence, or NULL
+ */
+static inline const uint32_t *
+gb18030RangeToU(uint32_t linear) {
+    const uint32_t *range;
+    uint32_t block=(linear-LINEAR_18030_BASE)/GB18030_LINEAR_BLOCK_LENGTH;
+    if(block<UPRV_LENGTHOF(gb18030ToUIndex)) {
+        range=gb18030Ranges[gb18030ToUIndex[block]];
+        while(linear>range[3]) {
+            range+=4;
+        }
+    } else {
+        range=gb18030Ranges[GB18030_SUPPLEMENTARY_RANGE];
+        if(linear>range[3]) {
+            return NULL;
+        }
+    }
+    return range[2]<=linear ? range : NULL;
+}
+
 /* bit flag for UConverter.options indicating GB 18030 special handling */
 #define _MBCS_OPTION_GB18030 0x8000
 
@@ -1127,34 +1256,29 @@ _extFromU(UConverter *cnv, const UConverterSharedData *sharedData,
 
     /* GB 18030 */
     if((cnv->options&_MBCS_OPTION_GB18030)!=0) {
-        const uint32_t *range;
-        int32_t i;
-
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[0]<=(uint32_t)cp && (uint32_t)cp<=range[1]) {
-                /* found the Unicode code point, output the four-byte sequence for it */
-                uint32_t linear;
-                char bytes[4];
-
-                /* get the linear value of the first GB 18030 code in this range */
-                linear=range[2]-LINEAR_18030_BASE;
-
-                /* add the offset from the beginning of the range */
-                linear+=((uint32_t)cp-range[0]);
-
-                /* turn this into a four-byte sequence */
-                bytes[3]=(char)(0x30+linear%10); linear/=10;
-                bytes[2]=(char)(0x81+linear%126); linear/=126;
-                bytes[1]=(char)(0x30+linear%10); linear/=10;
-                bytes[0]=(char)(0x81+linear);
-
-                /* output this sequence */
-                ucnv_fromUWriteBytes(cnv,
-                                     bytes, 4, (char **)target, (char *)targetLimit,
-                                     offsets, sourceIndex, pErrorCode);
-                return 0;
-            }
+        const uint32_t *range=gb18030RangeFromU(cp);
+        if(range!=NULL) {
+            /* found the Unicode code point, output the four-byte sequence for it */
+            uint32_t linear;
+            char bytes[4];
+
+            /* get the linear value of the first GB 18030 code in this range */
+            linear=range[2]-LINEAR_18030_BASE;
+
+            /* add the offset from the beginning of the range */
+            linear+=((uint32_t)cp-range[0]);
+
+            /* turn this into a four-byte sequence */
+            bytes[3]=(char)(0x30+linear%10); linear/=10;
+            bytes[2]=(char)(0x81+linear%126); linear/=126;
+            bytes[1]=(char)(0x30+linear%10); linear/=10;
+            bytes[0]=(char)(0x81+linear);
+
+            /* output this sequence */
+            ucnv_fromUWriteBytes(cnv,
+                                 bytes, 4, (char **)target, (char *)targetLimit,
+                                 offsets, sourceIndex, pErrorCode);
+            return 0;
         }
     }
 
@@ -1194,23 +1318,20 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
     if(length==4 && (cnv->options&_MBCS_OPTION_GB18030)!=0) {
         const uint32_t *range;
         uint32_t linear;
-        int32_t i;
 
         linear=LINEAR_18030(cnv->toUBytes[0], cnv->toUBytes[1], cnv->toUBytes[2], cnv->toUBytes[3]);
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[2]<=linear && linear<=range[3]) {
-                /* found the sequence, output the Unicode code point for it */
-                *pErrorCode=U_ZERO_ERROR;
+        range=gb18030RangeToU(linear);
+        if(range!=NULL) {
+            /* found the sequence, output the Unicode code point for it */
+            *pErrorCode=U_ZERO_ERROR;
 
-                /* add the linear difference between the input and start sequences to the start code point */
-                linear=range[0]+(linear-range[2]);
+            /* add the linear difference between the input and start sequences to the start code point */
+            linear=range[0]+(linear-range[2]);
 
-                /* output this code point */
-                ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
+            /* output this code point */
+            ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
 
-                return 0;
-            }
+            return 0;
         }
     }
 
@@ -1219,6 +1340,108 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
     return length;
 }
 
+/*
+ * GB 18030 four-byte sequences in the gb18030Ranges are not in the state table
+ * and would each go through the extension functions above.
+ * The conversion loops instead convert whole runs of them directly.
+ * These functions stop before anything else and before output that does not fit,
+ * and return the number of input units they consumed.
+ */
+static int32_t
+gb18030RunToU(const uint8_t *source, const uint8_t *sourceLimit,
+              UChar **target, const UChar *targetLimit,
+              int32_t **offsets, int32_t sourceIndex) {
+    const uint8_t *s=source;
+    UChar *t=*target;
+    int32_t *o=*offsets;
+
+    while(sourceLimit-s>=4) {
+        const uint32_t *range;
+        uint32_t linear;
+        UChar32 c;
+
+        if( (uint8_t)(s[0]-0x81)>0x7d || (uint8_t)(s[1]-0x30)>9 ||
+            (uint8_t)(s[2]-0x81)>0x7d || (uint8_t)(s[3]-0x30)>9
+        ) {
+            break;
+        }
+        linear=LINEAR_18030(s[0], s[1], s[2], s[3]);
+        if((range=gb18030RangeToU(linear))==NULL) {
+            break;
+        }
+        c=(UChar32)(range[0]+(linear-range[2]));
+        if(c<=0xffff) {
+            if(t>=targetLimit) {
+                break;
+            }
+            *t++=(UChar)c;
+            if(o!=NULL) {
+                *o++=sourceIndex;
+            }
+        } else {
+            if((targetLimit-t)<2) {
+                break;
+            }
+            *t++=U16_LEAD(c);
+            *t++=U16_TRAIL(c);
+            if(o!=NULL) {
+                *o++=sourceIndex;
+                *o++=sourceIndex;
+            }
+        }
+        s+=4;
+        sourceIndex+=4;
+    }
+
+    *target=t;
+    *offsets=o;
+    return (int32_t)(s-source);
+}
+
+static int32_t
+gb18030RunFromU(const UChar *source, const UChar *sourceLimit,
+                uint8_t **target, const uint8_t *targetLimit,
+                int32_t **offsets, int32_t sourceIndex) {
+    const UChar *s=source;
+    uint8_t *t=*target;
+    int32_t *o=*offsets;
+
+    while(s<sourceLimit && (targetLimit-t)>=4) {
+        const uint32_t *range;
+        uint32_t linear;
+        UChar32 c=*s;
+        int32_t length=1;
+
+        if(U16_IS_SURROGATE(c)) {
+            if(U16_IS_SURROGATE_LEAD(c) && (sourceLimit-s)>=2 && U16_IS_TRAIL(s[1])) {
+                c=U16_GET_SUPPLEMENTARY(c, s[1]);
+                length=2;
+            } else {
+                break;
+            }
+        }
+        if((range=gb18030RangeFromU(c))==NULL) {
+            break;
+        }
+        linear=range[2]-LINEAR_18030_BASE+((uint32_t)c-range[0]);
+        t[3]=(uint8_t)(0x30+linear%10); linear/=10;
+        t[2]=(uint8_t)(0x81+linear%126); linear/=126;
+        t[1]=(uint8_t)(0x30+linear%10); linear/=10;
+        t[0]=(uint8_t)(0x81+linear);
+        t+=4;
+        if(o!=NULL) {
+            o[0]=o[1]=o[2]=o[3]=sourceIndex;
+            o+=4;
+        }
+        s+=length;
+        sourceIndex+=length;
+    }
+
+    *target=t;
+    *offsets=o;
+    return (int32_t)(s-source);
+}
+
 /* EBCDIC swap LF<->NL ------------------------------------------------------ */
 
 /*
@@ -1866,6 +2089,12 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
             }
         }
     }
+    if( sharedData->impl==&_MBCSImpl &&
+        mbcsTable->outputType!=MBCS_OUTPUT_2_SISO && mbcsTable->outputType!=MBCS_OUTPUT_DBCS_ONLY
+    ) {
+        /* generic, stateless fromUTF8 for all other output types */
+        sharedData->impl=&_MBCSUTF8Impl;
+    }
 
     if(mbcsTable->outputType==MBCS_OUTPUT_DBCS_ONLY || mbcsTable->outputType==MBCS_OUTPUT_2_SISO) {
         /*
@@ -2652,6 +2881,24 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 break;
             }
 
+            if(byteIndex==1 && (cnv->options&_MBCS_OPTION_GB18030)!=0) {
+                /*
+                 * The optimized loop stopped after a lead byte.
+                 * Convert GB 18030 four-byte sequences in the algorithmic ranges directly.
+                 */
+                int32_t length=gb18030RunToU(source-1, sourceLimit,
+                                             &target, targetLimit,
+                                             &offsets, sourceIndex);
+                if(length>0) {
+                    source+=length-1;
+                    sourceIndex=nextSourceIndex=sourceIndex+length;
+                    byteIndex=0;
+                    state=0; /* GB 18030 is stateless */
+                    offset=0;
+                    continue;
+                }
+            }
+
             ++nextSourceIndex;
             bytes[byteIndex++]=*source++;
         } else /* byteIndex>0 */ {
@@ -4624,14 +4871,28 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                     } else {
                         /* a mapping was written to the target, continue */
 
-                        /* recalculate the targetCapacity after an extension mapping */
-                        targetCapacity=(int32_t)(pArgs->targetLimit-(char *)target);
-
                         /* normal end of conversion: prepare for a new character */
                         if(offsets!=NULL) {
                             prevSourceIndex=sourceIndex;
                             sourceIndex=nextSourceIndex;
                         }
+
+                        if((cnv->options&_MBCS_OPTION_GB18030)!=0) {
+                            /* convert a following run of code points in the GB 18030 ranges directly */
+                            int32_t runLength=gb18030RunFromU(source, sourceLimit,
+                                                              &target, (const uint8_t *)pArgs->targetLimit,
+                                                              &offsets, sourceIndex);
+                            if(runLength>0) {
+                                source+=runLength;
+                                nextSourceIndex+=runLength;
+                                if(offsets!=NULL) {
+                                    prevSourceIndex=sourceIndex=nextSourceIndex;
+                                }
+                            }
+                        }
+
+                        /* recalculate the targetCapacity after an extension mapping */
+                        targetCapacity=(int32_t)(pArgs->targetLimit-(char *)target);
                         continue;
                     }
                 }
@@ -5622,6 +5883,363 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/*
+ * Convert UTF-8 to any stateless MBCS table, for tables that do not have
+ * the utf8Friendly structures used by ucnv_SBCSFromUTF8() and ucnv_DBCSFromUTF8().
+ * Each code point is looked up in the regular fromUnicode trie.
+ *
+ * Only roundtrip mappings from the base table are handled here.
+ * Fallbacks, extension mappings (including the GB 18030 ranges),
+ * illegal sequences, partial characters and partial-character target
+ * overflows are left to the pivoting implementation
+ * by returning U_USING_DEFAULT_WARNING.
+ */
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    const uint16_t *table;
+    const uint8_t *bytes, *p;
+    uint32_t stage2Entry, value, asciiRoundtrips;
+    int32_t i, length;
+    uint8_t outputType;
+    UBool hasSupplementary;
+
+    UChar32 c;
+    uint8_t b;
+
+    utf8=pToUArgs->converter;
+    cnv=pFromUArgs->converter;
+    if(utf8->toULength>0 || cnv->fromUChar32!=0) {
+        /* no handling of partial characters here, fall back to pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    table=cnv->sharedData->mbcs.fromUnicodeTable;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        bytes=cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
+    } else {
+        bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
+    }
+    outputType=cnv->sharedData->mbcs.outputType;
+    hasSupplementary=(UBool)((cnv->sharedData->mbcs.unicodeMask&UCNV_HAS_SUPPLEMENTARY)!=0);
+    asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    /* stop before a truncated sequence at the end of the input */
+    length=(int32_t)(sourceLimit-source);
+    U8_TRUNCATE_IF_INCOMPLETE(source, 0, length);
+    sourceLimit=source+length;
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        b=*source;
+        if(U8_IS_SINGLE(b) && IS_ASCII_ROUNDTRIP(b, asciiRoundtrips)) {
+            ++source;
+            *target++=b;
+            continue;
+        }
+
+        i=0;
+        U8_NEXT(source, i, sourceLimit-source, c);
+        if(c<0 || (c>0xffff && !hasSupplementary)) {
+            /* illegal, or unassigned in the base table */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        /* look up the code point (same as in ucnv_MBCSFromUnicodeWithOffsets()) */
+        if(outputType==MBCS_OUTPUT_1) {
+            value=MBCS_SINGLE_RESULT_FROM_U(table, (const uint16_t *)bytes, c);
+            if(value<0xc00) {
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            value&=0xff;
+            length=1;
+        } else {
+            stage2Entry=MBCS_STAGE_2_FROM_U(table, c);
+            if(!MBCS_FROM_U_IS_ROUNDTRIP(stage2Entry, c)) {
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            switch(outputType) {
+            case MBCS_OUTPUT_2:
+                value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+                length= value<=0xff ? 1 : 2;
+                break;
+            case MBCS_OUTPUT_3:
+                p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+                value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+                if(value<=0xff) {
+                    length=1;
+                } else if(value<=0xffff) {
+                    length=2;
+                } else {
+                    length=3;
+                }
+                break;
+            case MBCS_OUTPUT_4:
+                value=MBCS_VALUE_4_FROM_STAGE_2(bytes, stage2Entry, c);
+                if(value<=0xff) {
+                    length=1;
+                } else if(value<=0xffff) {
+                    length=2;
+                } else if(value<=0xffffff) {
+                    length=3;
+                } else {
+                    length=4;
+                }
+                break;
+            case MBCS_OUTPUT_3_EUC:
+                value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+                /* EUC 16-bit fixed-length representation */
+                if(value<=0xff) {
+                    length=1;
+                } else if((value&0x8000)==0) {
+                    value|=0x8e8000;
+                    length=3;
+                } else if((value&0x80)==0) {
+                    value|=0x8f0080;
+                    length=3;
+                } else {
+                    length=2;
+                }
+                break;
+            case MBCS_OUTPUT_4_EUC:
+                p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+                value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+                /* EUC 16-bit fixed-length representation applied to the first two bytes */
+                if(value<=0xff) {
+                    length=1;
+                } else if(value<=0xffff) {
+                    length=2;
+                } else if((value&0x800000)==0) {
+                    value|=0x8e800000;
+                    length=4;
+                } else if((value&0x8000)==0) {
+                    value|=0x8f008000;
+                    length=4;
+                } else {
+                    length=3;
+                }
+                break;
+            default:
+                /* SI/SO and DBCS-only tables do not use this function */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                length=0;
+                break;
+            }
+            if(length==0) {
+                break;
+            }
+        }
+
+        if((targetLimit-target)<length) {
+            /* partial-character target overflow: fall back to the pivoting implementation */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        source+=i;
+        switch(length) {
+        /* each branch falls through to the next one */
+        case 4:
+            *target++=(uint8_t)(value>>24);
+            U_FALLTHROUGH;
+        case 3:
+            *target++=(uint8_t)(value>>16);
+            U_FALLTHROUGH;
+        case 2:
+            *target++=(uint8_t)(value>>8);
+            U_FALLTHROUGH;
+        case 1:
+            *target++=(uint8_t)value;
+            U_FALLTHROUGH;
+        default:
+            /* will never occur */
+            break;
+        }
+    }
+
+    if(U_SUCCESS(*pErrorCode) && source<(const uint8_t *)pToUArgs->sourceLimit) {
+        /* collect the truncated sequence in the pivoting implementation */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
+/* MBCS-to-UTF-8 conversion functions --------------------------------------- */
+
+/*
+ * Convert any MBCS table to UTF-8 without pivoting through UTF-16.
+ * Walks the full state table, including multi-byte and SI/SO state changes,
+ * and writes UTF-8 for the roundtrip results of the base table.
+ *
+ * Fallbacks, extension mappings, unassigned and illegal sequences,
+ * characters that are split across buffers and partial-character target
+ * overflows are left to the pivoting implementation
+ * (ucnv_MBCSToUnicodeWithOffsets() with _extToU() and callbacks)
+ * by stopping before the character and returning U_USING_DEFAULT_WARNING.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *cnv;
+    const uint8_t *source, *sourceLimit, *start;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+
+    uint32_t offset;
+    int32_t entry, length;
+    UChar32 c;
+    uint8_t state, action;
+    UBool asciiRoundtrips;
+
+    cnv=pToUArgs->converter;
+    if(cnv->toULength>0 || pFromUArgs->converter->fromUChar32!=0) {
+        /* no handling of partial characters here, fall back to pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiRoundtrips=FALSE;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+        asciiRoundtrips=(UBool)(cnv->sharedData->mbcs.asciiRoundtrips==0xffffffff);
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+
+    /* see ucnv_MBCSToUnicodeWithOffsets() */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        if(state==0 && asciiRoundtrips && U8_IS_SINGLE(*source)) {
+            /* all ASCII bytes map to themselves in the initial state: copy a run of them */
+            length=(int32_t)(sourceLimit-source);
+            if(length>(targetLimit-target)) {
+                length=(int32_t)(targetLimit-target);
+            }
+            length=usimd_asciiPrefixLength(source, length);
+            uprv_memcpy(target, source, length);
+            source+=length;
+            target+=length;
+            continue;
+        }
+
+        /* walk the state table through one complete byte sequence */
+        start=source;
+        offset=0;
+        entry=stateTable[state][*source];
+        while(MBCS_ENTRY_IS_TRANSITION(entry) && ++source<sourceLimit) {
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            entry=stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][*source];
+        }
+        if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            /* truncated sequence at the end of the input */
+            source=start;
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        ++source;
+
+        c=U_SENTINEL;
+        action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+        if(action==MBCS_STATE_VALID_DIRECT_16) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+        } else if(action==MBCS_STATE_VALID_16) {
+            c=unicodeCodeUnits[offset+MBCS_ENTRY_FINAL_VALUE_16(entry)];
+            if(c>=0xfffe) {
+                c=U_SENTINEL;
+            }
+        } else if(action==MBCS_STATE_VALID_16_PAIR) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset++];
+            if(c<0xd800) {
+                /* BMP code point below 0xd800 */
+            } else if(c<=0xdbff) {
+                /* roundtrip surrogate pair */
+                c=U16_GET_SUPPLEMENTARY(c, unicodeCodeUnits[offset]);
+            } else if(c==0xe000) {
+                /* roundtrip BMP code point above 0xd800 */
+                c=unicodeCodeUnits[offset];
+            } else {
+                c=U_SENTINEL;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_20) {
+            c=(UChar32)MBCS_ENTRY_FINAL_VALUE(entry)+0x10000;
+        } else if(action==MBCS_STATE_CHANGE_ONLY && cnv->sharedData->mbcs.dbcsOnlyState==0) {
+            /* SI/SO: state change without output */
+            state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry);
+            continue;
+        }
+
+        if(c<0 || U_IS_SURROGATE(c)) {
+            /* fallback, extension, unassigned or illegal: handle in the pivoting implementation */
+            source=start;
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        length=U8_LENGTH(c);
+        if((targetLimit-target)<length) {
+            /* partial-character target overflow: fall back to the pivoting implementation */
+            source=start;
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        length=0;
+        U8_APPEND_UNSAFE(target, length, c);
+        target+=length;
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->mode=state;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
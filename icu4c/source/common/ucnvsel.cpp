@@ -45,6 +45,7 @@
 #include "uenumimp.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "usimd.h"
 
 U_NAMESPACE_USE
 
@@ -664,12 +665,33 @@ static const UEnumeration defaultEncodings = {
 
 
 // internal fn to intersect two sets of masks
-// returns whether the mask has reduced to all zeros
-static UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len) {
-  int32_t i;
-  uint32_t oredDest = 0;
-  for (i = 0 ; i < len ; ++i) {
-    oredDest |= (dest[i] &= source1[i]);
+// returns whether the mask has reduced to all zeros;
+// sets *changed if any bit was cleared
+static inline UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len,
+                                   UBool *changed) {
+  int32_t i = 0;
+  uint32_t oredDest = 0, cleared = 0;
+#if U_SIMD_SSE2
+  __m128i oredDest4 = _mm_setzero_si128(), cleared4 = _mm_setzero_si128();
+  for (; (len - i) >= 4; i += 4) {
+    __m128i d = _mm_loadu_si128((const __m128i *)(dest + i));
+    __m128i s = _mm_loadu_si128((const __m128i *)(source1 + i));
+    cleared4 = _mm_or_si128(cleared4, _mm_andnot_si128(s, d));
+    d = _mm_and_si128(d, s);
+    oredDest4 = _mm_or_si128(oredDest4, d);
+    _mm_storeu_si128((__m128i *)(dest + i), d);
+  }
+  const __m128i zero = _mm_setzero_si128();
+  oredDest = _mm_movemask_epi8(_mm_cmpeq_epi8(oredDest4, zero)) != 0xffff;
+  cleared = _mm_movemask_epi8(_mm_cmpeq_epi8(cleared4, zero)) != 0xffff;
+#endif
+  for (; i < len ; ++i) {
+    uint32_t d = dest[i];
+    cleared |= d & ~source1[i];
+    oredDest |= (dest[i] = d & source1[i]);
+  }
+  if (cleared != 0) {
+    *changed = TRUE;
   }
   return oredDest == 0;
 }
@@ -688,6 +710,88 @@ static int16_t countOnes(uint32_t* mask, int32_t len) {
   return static_cast<int16_t>(totalOnes);
 }
 
+// The running intersection of the bit vectors of the code points seen so far.
+// Consecutive code points with the same bit vector (pvIndex) are skipped,
+// and once only one encoding remains, only its bit is tested.
+struct SelectionMask {
+  const uint32_t *pv;
+  uint32_t *mask;
+  int32_t columns;
+  int32_t lastPvIndex;
+  int32_t onlyColumn;  // >=0 if only one encoding remains
+  uint32_t onlyBit;
+  UBool isEmpty;
+};
+
+static void checkOnlyOne(SelectionMask &state) {
+  if (countOnes(state.mask, state.columns) == 1) {
+    int32_t col = 0;
+    while (state.mask[col] == 0) {
+      ++col;
+    }
+    state.onlyColumn = col;
+    state.onlyBit = state.mask[col];
+  }
+}
+
+static void initSelectionMask(SelectionMask &state, const UConverterSelector* sel, uint32_t *mask) {
+  state.pv = sel->pv;
+  state.mask = mask;
+  state.columns = (sel->encodingsCount+31)/32;
+  uprv_memset(mask, ~0, state.columns * 4);
+  // clear the unused bits so that they do not count as candidates
+  if ((sel->encodingsCount & 31) != 0) {
+    mask[state.columns - 1] = ((uint32_t)1 << (sel->encodingsCount & 31)) - 1;
+  }
+  state.lastPvIndex = -1;
+  state.onlyColumn = -1;
+  state.onlyBit = 0;
+  state.isEmpty = (UBool)(sel->encodingsCount == 0);
+  if (!state.isEmpty) {
+    checkOnlyOne(state);
+  }
+}
+
+// returns whether no encoding remains
+static inline UBool intersectPvIndex(SelectionMask &state, uint16_t pvIndex) {
+  if (pvIndex == state.lastPvIndex) {
+    return FALSE;
+  }
+  state.lastPvIndex = pvIndex;
+  if (state.onlyColumn >= 0) {
+    if ((state.pv[pvIndex + state.onlyColumn] & state.onlyBit) == 0) {
+      state.mask[state.onlyColumn] = 0;
+      state.isEmpty = TRUE;
+    }
+  } else {
+    UBool changed = FALSE;
+    if (intersectMasks(state.mask, state.pv + pvIndex, state.columns, &changed)) {
+      state.isEmpty = TRUE;
+    } else if (changed) {
+      checkOnlyOne(state);
+    }
+  }
+  return state.isEmpty;
+}
+
+static void selectUTF16(const UConverterSelector* sel, SelectionMask &state,
+                        const UChar *s, const UChar *limit) {
+  while (!state.isEmpty && (limit == NULL ? *s != 0 : s != limit)) {
+    UChar32 c;
+    uint16_t pvIndex;
+    UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
+    intersectPvIndex(state, pvIndex);
+  }
+}
+
+static void selectUTF8(const UConverterSelector* sel, SelectionMask &state,
+                       const char *s, const char *limit) {
+  while (!state.isEmpty && s != limit) {
+    uint16_t pvIndex;
+    UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
+    intersectPvIndex(state, pvIndex);
+  }
+}
 
 /* internal function! */
 static UEnumeration *selectForMask(const UConverterSelector* sel,
@@ -758,24 +862,11 @@ ucnvsel_selectForString(const UConverterSelector* sel,
     *status = U_MEMORY_ALLOCATION_ERROR;
     return NULL;
   }
-  uprv_memset(mask, ~0, columns *4);
+  SelectionMask state;
+  initSelectionMask(state, sel, mask);
 
   if(s!=NULL) {
-    const UChar *limit;
-    if (length >= 0) {
-      limit = s + length;
-    } else {
-      limit = NULL;
-    }
-    
-    while (limit == NULL ? *s != 0 : s != limit) {
-      UChar32 c;
-      uint16_t pvIndex;
-      UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
-      }
-    }
+    selectUTF16(sel, state, s, length >= 0 ? s + length : NULL);
   }
   return selectForMask(sel, mask, status);
 }
@@ -800,24 +891,191 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
     *status = U_MEMORY_ALLOCATION_ERROR;
     return NULL;
   }
-  uprv_memset(mask, ~0, columns *4);
+  SelectionMask state;
+  initSelectionMask(state, sel, mask);
 
   if (length < 0) {
     length = (int32_t)uprv_strlen(s);
   }
 
   if(s!=NULL) {
-    const char *limit = s + length;
-    
-    while (s != limit) {
-      uint16_t pvIndex;
-      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
-      }
-    }
+    selectUTF8(sel, state, s, s + length);
   }
   return selectForMask(sel, mask, status);
 }
 
+/* incremental selection ---------------------------------------------------- */
+
+struct UConverterSelection {
+  const UConverterSelector *sel;
+  SelectionMask state;
+  // an incomplete character at the end of the text appended so far
+  UChar pendingLead;
+  int8_t pendingLength;  // number of pendingBytes
+  char pendingBytes[4];
+};
+
+// Handle an incomplete character as if the text ended here.
+static void flushPending(UConverterSelection *selection) {
+  if (selection->pendingLead != 0) {
+    selectUTF16(selection->sel, selection->state,
+                &selection->pendingLead, &selection->pendingLead + 1);
+    selection->pendingLead = 0;
+  }
+  if (selection->pendingLength > 0) {
+    selectUTF8(selection->sel, selection->state,
+               selection->pendingBytes, selection->pendingBytes + selection->pendingLength);
+    selection->pendingLength = 0;
+  }
+}
+
+U_CAPI UConverterSelection * U_EXPORT2
+ucnvsel_openSelection(const UConverterSelector* sel, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  if (sel == NULL) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  UConverterSelection *selection =
+    (UConverterSelection *)uprv_malloc(sizeof(UConverterSelection));
+  int32_t columns = (sel->encodingsCount+31)/32;
+  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
+  if (selection == NULL || mask == NULL) {
+    uprv_free(selection);
+    uprv_free(mask);
+    *status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  selection->sel = sel;
+  initSelectionMask(selection->state, sel, mask);
+  selection->pendingLead = 0;
+  selection->pendingLength = 0;
+  return selection;
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_closeSelection(UConverterSelection *selection) {
+  if (selection != NULL) {
+    uprv_free(selection->state.mask);
+    uprv_free(selection);
+  }
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_appendString(UConverterSelection *selection,
+                     const UChar *s, int32_t length, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return;
+  }
+  if (selection == NULL || (s == NULL && length != 0)) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return;
+  }
+  if (selection->pendingLength > 0) {
+    flushPending(selection);
+  }
+  if (length < 0) {
+    length = u_strlen(s);
+  }
+  if (length == 0) {
+    return;
+  }
+  if (selection->pendingLead != 0) {
+    // complete a surrogate pair that was split between appends
+    UChar pair[2] = { selection->pendingLead, s[0] };
+    selection->pendingLead = 0;
+    if (U16_IS_TRAIL(s[0])) {
+      selectUTF16(selection->sel, selection->state, pair, pair + 2);
+      ++s;
+      --length;
+    } else {
+      selectUTF16(selection->sel, selection->state, pair, pair + 1);
+    }
+  }
+  if (length > 0 && U16_IS_LEAD(s[length - 1])) {
+    selection->pendingLead = s[--length];
+  }
+  selectUTF16(selection->sel, selection->state, s, s + length);
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_appendUTF8(UConverterSelection *selection,
+                   const char *s, int32_t length, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return;
+  }
+  if (selection == NULL || (s == NULL && length != 0)) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return;
+  }
+  if (selection->pendingLead != 0) {
+    flushPending(selection);
+  }
+  if (length < 0) {
+    length = (int32_t)uprv_strlen(s);
+  }
+  if (selection->pendingLength > 0) {
+    // complete a character that was split between appends
+    char buffer[8];
+    int32_t pendingLength = selection->pendingLength;
+    int32_t fill = length < 4 ? length : 4;
+    uprv_memcpy(buffer, selection->pendingBytes, pendingLength);
+    uprv_memcpy(buffer + pendingLength, s, fill);
+    int32_t bufferLength = pendingLength + fill;
+    int32_t completeLength = bufferLength;
+    U8_TRUNCATE_IF_INCOMPLETE(buffer, 0, completeLength);
+    if (completeLength == 0) {
+      // still incomplete, and all of s was used
+      uprv_memcpy(selection->pendingBytes, buffer, bufferLength);
+      selection->pendingLength = (int8_t)bufferLength;
+      return;
+    }
+    selection->pendingLength = 0;
+    const char *p = buffer;
+    uint16_t pvIndex;
+    UTRIE2_U8_NEXT16(selection->sel->trie, p, buffer + bufferLength, pvIndex);
+    if (!selection->state.isEmpty) {
+      intersectPvIndex(selection->state, pvIndex);
+    }
+    // Any remaining pending bytes were trail bytes of an ill-formed sequence,
+    // which do not restrict the selection either.
+    int32_t consumed = (int32_t)(p - buffer) - pendingLength;
+    if (consumed > 0) {
+      s += consumed;
+      length -= consumed;
+    }
+  }
+  int32_t completeLength = length;
+  U8_TRUNCATE_IF_INCOMPLETE(s, 0, completeLength);
+  if (completeLength < length) {
+    selection->pendingLength = (int8_t)(length - completeLength);
+    uprv_memcpy(selection->pendingBytes, s + completeLength, selection->pendingLength);
+  }
+  selectUTF8(selection->sel, selection->state, s, s + completeLength);
+}
+
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_finishSelection(UConverterSelection *selection, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  if (selection == NULL) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  flushPending(selection);
+  int32_t columns = selection->state.columns;
+  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
+  if (mask == NULL) {
+    *status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  uprv_memcpy(mask, selection->state.mask, columns * 4);
+  // start over for the next text
+  initSelectionMask(selection->state, selection->sel, selection->state.mask);
+  return selectForMask(selection->sel, mask, status);
+}
+
 #endif  // !UCONFIG_NO_CONVERSION
@@ -14,7 +14,9 @@
 #include "unicode/utf.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
+#include "unicode/ustring.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "uassert.h"
 #include "ucptrie_impl.h"
 
@@ -455,6 +457,219 @@ ucptrie_getRange(const UCPTrie *trie, UChar32 start,
                                     filter, context, pValue);
 }
 
+namespace {
+
+// Receives the value of each code point in a string, for ucptrie_getStringValues().
+class UnitValuesSink {
+public:
+    UnitValuesSink(uint32_t *values) : values(values) {}
+    inline void add(int32_t start, int32_t limit, uint32_t value) {
+        do {
+            values[start] = value;
+        } while (++start < limit);
+    }
+    int32_t finish(int32_t length, UErrorCode &) { return length; }
+private:
+    uint32_t *values;
+};
+
+// Receives the value of each code point in a string, for ucptrie_getStringSpans().
+class SpansSink {
+public:
+    SpansSink(int32_t *limits, uint32_t *values, int32_t capacity) :
+            limits(limits), values(values), capacity(capacity) {}
+    inline void add(int32_t start, int32_t /*limit*/, uint32_t value) {
+        if (count == 0 || value != spanValue) {
+            if (0 < count && count <= capacity) {
+                limits[count - 1] = start;
+            }
+            if (count < capacity) {
+                values[count] = value;
+            }
+            ++count;
+            spanValue = value;
+        }
+    }
+    int32_t finish(int32_t length, UErrorCode &errorCode) {
+        if (0 < count && count <= capacity) {
+            limits[count - 1] = length;
+        } else if (count > capacity) {
+            errorCode = U_BUFFER_OVERFLOW_ERROR;
+        }
+        return count;
+    }
+private:
+    int32_t *limits;
+    uint32_t *values;
+    int32_t capacity;
+    int32_t count = 0;
+    uint32_t spanValue = 0;
+};
+
+// The trie type and value width are template parameters,
+// so that the loops have no per-code point dispatch.
+template<typename Data, UChar32 fastMax, typename Sink>
+void getValues(const UCPTrie *trie, const Data *data,
+               const UChar *s, int32_t length, Sink &sink) {
+    const uint16_t *index = trie->index;
+    int32_t i = 0;
+    while (i < length) {
+        int32_t start = i;
+        UChar32 c = s[i++];
+        uint32_t value;
+        if (c <= 0x7f) {
+            // linear ASCII
+            value = data[c];
+        } else if (c <= fastMax && !(fastMax == 0xffff && U16_IS_SURROGATE(c))) {
+            value = data[index[c >> UCPTRIE_FAST_SHIFT] + (c & UCPTRIE_FAST_DATA_MASK)];
+        } else {
+            UChar c2;
+            if (U16_IS_LEAD(c) && i < length && U16_IS_TRAIL(c2 = s[i])) {
+                ++i;
+                c = U16_GET_SUPPLEMENTARY(c, c2);
+            }
+            value = data[_UCPTRIE_CP_INDEX(trie, fastMax, c)];
+        }
+        sink.add(start, i, value);
+    }
+}
+
+template<typename Data, UChar32 fastMax, typename Sink>
+void getValues(const UCPTrie *trie, const Data *data,
+               const uint8_t *s, int32_t length, Sink &sink) {
+    int32_t i = 0;
+    while (i < length) {
+        int32_t start = i;
+        UChar32 c = s[i];
+        uint32_t value;
+        if (c <= 0x7f) {
+            // linear ASCII
+            ++i;
+            value = data[c];
+        } else {
+            U8_NEXT_OR_FFFD(s, i, length, c);
+            value = data[_UCPTRIE_CP_INDEX(trie, fastMax, c)];
+        }
+        sink.add(start, i, value);
+    }
+}
+
+template<typename Unit, typename Sink>
+int32_t getStringValues(const UCPTrie *trie, const Unit *s, int32_t length, Sink &sink,
+                        UErrorCode &errorCode) {
+    bool isFast = trie->type == UCPTRIE_TYPE_FAST;
+    switch (trie->valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        if (isFast) {
+            getValues<uint16_t, 0xffff>(trie, trie->data.ptr16, s, length, sink);
+        } else {
+            getValues<uint16_t, UCPTRIE_SMALL_MAX>(trie, trie->data.ptr16, s, length, sink);
+        }
+        break;
+    case UCPTRIE_VALUE_BITS_32:
+        if (isFast) {
+            getValues<uint32_t, 0xffff>(trie, trie->data.ptr32, s, length, sink);
+        } else {
+            getValues<uint32_t, UCPTRIE_SMALL_MAX>(trie, trie->data.ptr32, s, length, sink);
+        }
+        break;
+    case UCPTRIE_VALUE_BITS_8:
+        if (isFast) {
+            getValues<uint8_t, 0xffff>(trie, trie->data.ptr8, s, length, sink);
+        } else {
+            getValues<uint8_t, UCPTRIE_SMALL_MAX>(trie, trie->data.ptr8, s, length, sink);
+        }
+        break;
+    default:
+        // Unreachable if the trie is properly initialized.
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return sink.finish(length, errorCode);
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringValues(const UCPTrie *trie, const UChar *s, int32_t length,
+                        uint32_t *values, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if ((s == nullptr || values == nullptr) && length != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length < 0) {
+        if (length < -1) {
+            *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        length = u_strlen(s);
+    }
+    UnitValuesSink sink(values);
+    return getStringValues(trie, s, length, sink, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringValuesUTF8(const UCPTrie *trie, const char *s, int32_t length,
+                            uint32_t *values, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if ((s == nullptr || values == nullptr) && length != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length < 0) {
+        if (length < -1) {
+            *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        length = (int32_t)uprv_strlen(s);
+    }
+    UnitValuesSink sink(values);
+    return getStringValues(trie, reinterpret_cast<const uint8_t *>(s), length, sink, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringSpans(const UCPTrie *trie, const UChar *s, int32_t length,
+                       int32_t *limits, uint32_t *values, int32_t capacity,
+                       UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if ((s == nullptr && length != 0) || length < -1 || capacity < 0 ||
+            ((limits == nullptr || values == nullptr) && capacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length < 0) {
+        length = u_strlen(s);
+    }
+    SpansSink sink(limits, values, capacity);
+    return getStringValues(trie, s, length, sink, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringSpansUTF8(const UCPTrie *trie, const char *s, int32_t length,
+                           int32_t *limits, uint32_t *values, int32_t capacity,
+                           UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if ((s == nullptr && length != 0) || length < -1 || capacity < 0 ||
+            ((limits == nullptr || values == nullptr) && capacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length < 0) {
+        length = (int32_t)uprv_strlen(s);
+    }
+    SpansSink sink(limits, values, capacity);
+    return getStringValues(trie, reinterpret_cast<const uint8_t *>(s), length, sink, *pErrorCode);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucptrie_toBinary(const UCPTrie *trie,
                  void *data, int32_t capacity,
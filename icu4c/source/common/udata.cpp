@@ -280,7 +280,8 @@ static void U_CALLCONV DataCacheElement_deleter(void *pDCEl) {
 
 static void U_CALLCONV udata_initHashTable(UErrorCode &err) {
     U_ASSERT(gCommonDataCache == NULL);
-    gCommonDataCache = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &err);
+    gCommonDataCache = uhash_openSizeWithFlags(uhash_hashChars, uhash_compareChars, NULL,
+                                               0, UHASH_GROUP_PROBING, &err);
     if (U_FAILURE(err)) {
        return;
     }
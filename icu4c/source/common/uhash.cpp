@@ -18,6 +18,7 @@
 #include "cmemory.h"
 #include "uassert.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* This hashtable is implemented as a double hash.  All elements are
  * stored in a single array with no secondary storage for collision
@@ -63,6 +64,16 @@
  * PRIMES table, so that when the primeIndex is incremented or
  * decremented during rehashing, it brings the ratio of count / length
  * back into the desired range (between low and high water ratios).
+ *
+ * With UHASH_GROUP_PROBING, the table instead uses open addressing
+ * over a power-of-2 length, in groups of GROUP_SIZE elements.  A
+ * parallel array holds one control byte per element: CONTROL_EMPTY,
+ * CONTROL_DELETED, or the low 7 bits of the hashcode of a full slot.
+ * The hashcode selects the first group to look at, and _uhash_find()
+ * compares the control bytes of a whole group with one SIMD compare
+ * before it compares any keys.  The element array keeps the same
+ * hashcode values as in double hashing, so iteration and removal do
+ * not depend on the probing scheme.
  */
 
 /********************************************************************
@@ -101,6 +112,26 @@ static const float RESIZE_POLICY_RATIO_TABLE[6] = {
     0.0F, 1.0F  /* U_FIXED: Never change size */
 };
 
+/* Group probing: The length is 1<<primeIndex, at least one group.
+ * The fuller groups are, the longer probe sequences get, but each
+ * step costs only one group compare, so the tables can be fuller
+ * than with double hashing.
+ */
+#define GROUP_SIZE 16
+#define GROUP_MIN_INDEX 4   /* 16 elements */
+#define GROUP_MAX_INDEX 30
+#define GROUP_DEFAULT_INDEX 7   /* 128 elements */
+
+static const float GROUP_RESIZE_POLICY_RATIO_TABLE[6] = {
+    /* low, high water ratio */
+    0.0F, 0.875F, /* U_GROW: Grow on demand, do not shrink */
+    0.2F, 0.875F, /* U_GROW_AND_SHRINK: Grow and shrink on demand */
+    0.0F, 1.0F    /* U_FIXED: Never change size */
+};
+
+#define CONTROL_EMPTY   0x80
+#define CONTROL_DELETED 0xfe
+
 /*
   Invariants for hashcode values:
 
@@ -139,6 +170,27 @@ static const float RESIZE_POLICY_RATIO_TABLE[6] = {
  * PRIVATE Implementation
  ********************************************************************/
 
+/**
+ * Sets the control byte for a group-probing element that has just
+ * been given the hashcode.  A deleted element in a group that still
+ * has an empty element can become empty again, because lookups stop
+ * at that group anyway.
+ */
+static void
+_uhash_setControl(UHashtable *hash, UHashElement *e, int32_t hashcode) {
+    int32_t i = (int32_t)(e - hash->elements);
+    uint8_t *control = hash->control;
+    if (!IS_EMPTY_OR_DELETED(hashcode)) {
+        control[i] = (uint8_t)(hashcode & 0x7f);
+    } else if (hashcode == HASH_EMPTY ||
+               usimd_matchBytes16(control + (i & ~(GROUP_SIZE - 1)), CONTROL_EMPTY) != 0) {
+        control[i] = CONTROL_EMPTY;
+        e->hashcode = HASH_EMPTY;
+    } else {
+        control[i] = CONTROL_DELETED;
+    }
+}
+
 static UHashTok
 _uhash_setElement(UHashtable *hash, UHashElement* e,
                   int32_t hashcode,
@@ -173,6 +225,9 @@ _uhash_setElement(UHashtable *hash, UHashElement* e,
         e->value = value;
     }
     e->hashcode = hashcode;
+    if (hash->control != NULL) {
+        _uhash_setControl(hash, e, hashcode);
+    }
     return oldValue;
 }
 
@@ -193,8 +248,10 @@ _uhash_internalSetResizePolicy(UHashtable *hash, enum UHashResizePolicy policy)
     U_ASSERT(hash != NULL);
     U_ASSERT(((int32_t)policy) >= 0);
     U_ASSERT(((int32_t)policy) < 3);
-    hash->lowWaterRatio  = RESIZE_POLICY_RATIO_TABLE[policy * 2];
-    hash->highWaterRatio = RESIZE_POLICY_RATIO_TABLE[policy * 2 + 1];
+    const float *ratios =
+        hash->groupProbing ? GROUP_RESIZE_POLICY_RATIO_TABLE : RESIZE_POLICY_RATIO_TABLE;
+    hash->lowWaterRatio  = ratios[policy * 2];
+    hash->highWaterRatio = ratios[policy * 2 + 1];
 }
 
 /**
@@ -204,7 +261,8 @@ _uhash_internalSetResizePolicy(UHashtable *hash, enum UHashResizePolicy policy)
  * U_MEMORY_ALLOCATION_ERROR and all array storage is freed.  In
  * either case the previous array pointer is overwritten.
  *
- * Caller must ensure primeIndex is in range 0..PRIME_LENGTH-1.
+ * Caller must ensure primeIndex is in range 0..PRIME_LENGTH-1,
+ * or GROUP_MIN_INDEX..GROUP_MAX_INDEX with group probing.
  */
 static void
 _uhash_allocate(UHashtable *hash,
@@ -216,19 +274,30 @@ _uhash_allocate(UHashtable *hash,
 
     if (U_FAILURE(*status)) return;
 
-    U_ASSERT(primeIndex >= 0 && primeIndex < PRIMES_LENGTH);
-
     hash->primeIndex = static_cast<int8_t>(primeIndex);
-    hash->length = PRIMES[primeIndex];
-
-    p = hash->elements = (UHashElement*)
-        uprv_malloc(sizeof(UHashElement) * hash->length);
+    if (hash->groupProbing) {
+        U_ASSERT(primeIndex >= GROUP_MIN_INDEX && primeIndex <= GROUP_MAX_INDEX);
+        hash->length = (int32_t)1 << primeIndex;
+        /* The control bytes follow the elements in the same block. */
+        p = hash->elements = (UHashElement*)
+            uprv_malloc((sizeof(UHashElement) + 1) * hash->length);
+    } else {
+        U_ASSERT(primeIndex >= 0 && primeIndex < PRIMES_LENGTH);
+        hash->length = PRIMES[primeIndex];
+        p = hash->elements = (UHashElement*)
+            uprv_malloc(sizeof(UHashElement) * hash->length);
+    }
 
     if (hash->elements == NULL) {
         *status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
 
+    if (hash->groupProbing) {
+        hash->control = (uint8_t *)(hash->elements + hash->length);
+        uprv_memset(hash->control, CONTROL_EMPTY, hash->length);
+    }
+
     emptytok.pointer = NULL; /* Only one of these two is needed */
     emptytok.integer = 0;    /* but we don't know which one. */
 
@@ -251,6 +320,7 @@ _uhash_init(UHashtable *result,
               UKeyComparator *keyComp,
               UValueComparator *valueComp,
               int32_t primeIndex,
+              UBool groupProbing,
               UErrorCode *status)
 {
     if (U_FAILURE(*status)) return NULL;
@@ -263,6 +333,8 @@ _uhash_init(UHashtable *result,
     result->keyDeleter      = NULL;
     result->valueDeleter    = NULL;
     result->allocated       = FALSE;
+    result->groupProbing    = groupProbing;
+    result->control         = NULL;
     _uhash_internalSetResizePolicy(result, U_GROW);
 
     _uhash_allocate(result, primeIndex, status);
@@ -279,6 +351,7 @@ _uhash_create(UHashFunction *keyHash,
               UKeyComparator *keyComp,
               UValueComparator *valueComp,
               int32_t primeIndex,
+              UBool groupProbing,
               UErrorCode *status) {
     UHashtable *result;
 
@@ -290,7 +363,7 @@ _uhash_create(UHashFunction *keyHash,
         return NULL;
     }
 
-    _uhash_init(result, keyHash, keyComp, valueComp, primeIndex, status);
+    _uhash_init(result, keyHash, keyComp, valueComp, primeIndex, groupProbing, status);
     result->allocated       = TRUE;
 
     if (U_FAILURE(*status)) {
@@ -330,6 +403,10 @@ _uhash_create(UHashFunction *keyHash,
  * hash) is relatively prime to the table length.
  */
 static UHashElement*
+_uhash_findInGroups(const UHashtable *hash, UHashTok key,
+                    int32_t hashcode);
+
+static UHashElement*
 _uhash_find(const UHashtable *hash, UHashTok key,
             int32_t hashcode) {
 
@@ -339,6 +416,10 @@ _uhash_find(const UHashtable *hash, UHashTok key,
     int32_t tableHash;
     UHashElement *elements = hash->elements;
 
+    if (hash->control != NULL) {
+        return _uhash_findInGroups(hash, key, hashcode);
+    }
+
     hashcode &= 0x7FFFFFFF; /* must be positive */
     startIndex = theIndex = (hashcode ^ 0x4000000) % hash->length;
 
@@ -382,6 +463,67 @@ _uhash_find(const UHashtable *hash, UHashTok key,
     return &(elements[theIndex]);
 }
 
+/**
+ * _uhash_find() with group probing.
+ *
+ * The hashcode, multiplied to mix its bits, selects the first group.
+ * Each group is checked with one compare of its control bytes against
+ * the low 7 bits of the hashcode; only matching elements have their
+ * hashcodes and keys compared.  Groups are visited in triangular-number
+ * steps, which reach every group once because the number of groups
+ * is a power of 2.  The search stops at the first group with an empty
+ * element, since an insertion would have used that element.
+ */
+static UHashElement*
+_uhash_findInGroups(const UHashtable *hash, UHashTok key,
+                    int32_t hashcode) {
+
+    UHashElement *elements = hash->elements;
+    const uint8_t *control = hash->control;
+    uint32_t numGroups = (uint32_t)hash->length / GROUP_SIZE;
+    int32_t firstDeleted = -1;
+    uint32_t group, step;
+    uint8_t h7;
+
+    hashcode &= 0x7FFFFFFF; /* must be positive */
+    h7 = (uint8_t)(hashcode & 0x7f);
+    group = (uint32_t)(((uint64_t)((uint32_t)hashcode * 0x9e3779b1u) * numGroups) >> 32);
+
+    for (step = 1; step <= numGroups; ++step) {
+        int32_t start = (int32_t)(group * GROUP_SIZE);
+        uint32_t match = usimd_matchBytes16(control + start, h7);
+        while (match != 0) {
+            int32_t i = start + usimd_lowestBitIndex(match);
+            if (elements[i].hashcode == hashcode &&
+                    (*hash->keyComparator)(key, elements[i].key)) {
+                return &(elements[i]);
+            }
+            match &= match - 1;
+        }
+        if (firstDeleted < 0) {
+            uint32_t deleted = usimd_matchBytes16(control + start, CONTROL_DELETED);
+            if (deleted != 0) {
+                firstDeleted = start + usimd_lowestBitIndex(deleted);
+            }
+        }
+        uint32_t empty = usimd_matchBytes16(control + start, CONTROL_EMPTY);
+        if (empty != 0) {
+            if (firstDeleted >= 0) {
+                return &(elements[firstDeleted]);
+            }
+            return &(elements[start + usimd_lowestBitIndex(empty)]);
+        }
+        group = (group + step) & (numGroups - 1);
+    }
+
+    if (firstDeleted >= 0) {
+        return &(elements[firstDeleted]);
+    }
+    /* Full table, see _uhash_find(). */
+    U_ASSERT(FALSE);
+    return NULL; /* Never happens if uhash_put() behaves */
+}
+
 /**
  * Attempt to grow or shrink the data arrays in order to make the
  * count fit between the high and low water marks.  hash_put() and
@@ -395,16 +537,20 @@ static void
 _uhash_rehash(UHashtable *hash, UErrorCode *status) {
 
     UHashElement *old = hash->elements;
+    uint8_t *oldControl = hash->control;
     int32_t oldLength = hash->length;
+    int32_t oldPrimeIndex = hash->primeIndex;
     int32_t newPrimeIndex = hash->primeIndex;
+    int32_t minIndex = hash->groupProbing ? GROUP_MIN_INDEX : 0;
+    int32_t limitIndex = hash->groupProbing ? GROUP_MAX_INDEX + 1 : PRIMES_LENGTH;
     int32_t i;
 
     if (hash->count > hash->highWaterMark) {
-        if (++newPrimeIndex >= PRIMES_LENGTH) {
+        if (++newPrimeIndex >= limitIndex) {
             return;
         }
     } else if (hash->count < hash->lowWaterMark) {
-        if (--newPrimeIndex < 0) {
+        if (--newPrimeIndex < minIndex) {
             return;
         }
     } else {
@@ -415,7 +561,9 @@ _uhash_rehash(UHashtable *hash, UErrorCode *status) {
 
     if (U_FAILURE(*status)) {
         hash->elements = old;
+        hash->control = oldControl;
         hash->length = oldLength;
+        hash->primeIndex = static_cast<int8_t>(oldPrimeIndex);
         return;
     }
 
@@ -427,6 +575,9 @@ _uhash_rehash(UHashtable *hash, UErrorCode *status) {
             e->key = old[i].key;
             e->value = old[i].value;
             e->hashcode = old[i].hashcode;
+            if (hash->control != NULL) {
+                hash->control[e - hash->elements] = (uint8_t)(e->hashcode & 0x7f);
+            }
             ++hash->count;
         }
     }
@@ -541,7 +692,7 @@ uhash_open(UHashFunction *keyHash,
            UValueComparator *valueComp,
            UErrorCode *status) {
 
-    return _uhash_create(keyHash, keyComp, valueComp, DEFAULT_PRIME_INDEX, status);
+    return _uhash_create(keyHash, keyComp, valueComp, DEFAULT_PRIME_INDEX, FALSE, status);
 }
 
 U_CAPI UHashtable* U_EXPORT2
@@ -557,7 +708,33 @@ uhash_openSize(UHashFunction *keyHash,
         ++i;
     }
 
-    return _uhash_create(keyHash, keyComp, valueComp, i, status);
+    return _uhash_create(keyHash, keyComp, valueComp, i, FALSE, status);
+}
+
+U_CAPI UHashtable* U_EXPORT2
+uhash_openSizeWithFlags(UHashFunction *keyHash,
+                        UKeyComparator *keyComp,
+                        UValueComparator *valueComp,
+                        int32_t size,
+                        uint32_t flags,
+                        UErrorCode *status) {
+
+    if ((flags & UHASH_GROUP_PROBING) == 0) {
+        return size > 0 ?
+            uhash_openSize(keyHash, keyComp, valueComp, size, status) :
+            uhash_open(keyHash, keyComp, valueComp, status);
+    }
+
+    /* Find the smallest index i for which 1<<i >= size. */
+    int32_t i = GROUP_MIN_INDEX;
+    if (size <= 0) {
+        i = GROUP_DEFAULT_INDEX;
+    } else {
+        while (i<GROUP_MAX_INDEX && ((int32_t)1<<i)<size) {
+            ++i;
+        }
+    }
+    return _uhash_create(keyHash, keyComp, valueComp, i, TRUE, status);
 }
 
 U_CAPI UHashtable* U_EXPORT2
@@ -567,7 +744,7 @@ uhash_init(UHashtable *fillinResult,
            UValueComparator *valueComp,
            UErrorCode *status) {
 
-    return _uhash_init(fillinResult, keyHash, keyComp, valueComp, DEFAULT_PRIME_INDEX, status);
+    return _uhash_init(fillinResult, keyHash, keyComp, valueComp, DEFAULT_PRIME_INDEX, FALSE, status);
 }
 
 U_CAPI UHashtable* U_EXPORT2
@@ -583,7 +760,7 @@ uhash_initSize(UHashtable *fillinResult,
     while (i<(PRIMES_LENGTH-1) && PRIMES[i]<size) {
         ++i;
     }
-    return _uhash_init(fillinResult, keyHash, keyComp, valueComp, i, status);
+    return _uhash_init(fillinResult, keyHash, keyComp, valueComp, i, FALSE, status);
 }
 
 U_CAPI void U_EXPORT2
@@ -601,6 +778,7 @@ uhash_close(UHashtable *hash) {
         }
         uprv_free(hash->elements);
         hash->elements = NULL;
+        hash->control = NULL;
     }
     if (hash->allocated) {
         uprv_free(hash);
@@ -159,7 +159,8 @@ struct UHashtable {
                              * 0 <= count <= length.  In practice we
                              * never let count == length (see code). */
     int32_t     length;     /* The physical size of the arrays hashes, keys
-                             * and values.  Must be prime. */
+                             * and values.  Must be prime,
+                             * or a power of 2 with group probing. */
 
     /* Rehashing thresholds */
 
@@ -169,8 +170,15 @@ struct UHashtable {
     float       lowWaterRatio;  /* 0..1; low water as a fraction of length */
 
     int8_t      primeIndex;     /* Index into our prime table for length.
-                                 * length == PRIMES[primeIndex] */
+                                 * length == PRIMES[primeIndex]
+                                 * With group probing: length == 1<<primeIndex */
     UBool       allocated; /* Was this UHashtable allocated? */
+
+    /* Group probing (see UHASH_GROUP_PROBING) */
+
+    UBool       groupProbing;
+    uint8_t     *control;   /* One control byte per element, or NULL.
+                             * Shares the memory block of the elements. */
 };
 typedef struct UHashtable UHashtable;
 
@@ -214,6 +222,39 @@ uhash_openSize(UHashFunction *keyHash,
                int32_t size,
                UErrorCode *status);
 
+/**
+ * uhash_openSizeWithFlags() flag:
+ * Use open addressing over a power-of-2 number of elements in groups of 16,
+ * with one control byte per element that holds 7 bits of its hash code.
+ * A lookup compares the control bytes of a whole group at once
+ * (with SSE2 where available), and compares keys only for matching bytes.
+ * Without this flag, the table uses double hashing over a prime number
+ * of elements.
+ * Either way, the table has the same behavior through the uhash_... API,
+ * except that the iteration order differs.
+ */
+#define UHASH_GROUP_PROBING 1
+
+/**
+ * Initialize a new UHashtable with a given initial size and options.
+ * @param keyHash A pointer to the key hashing function.  Must not be
+ * NULL.
+ * @param keyComp A pointer to the function that compares keys.  Must
+ * not be NULL.
+ * @param size The initial capacity of this hash table; 0 for the default.
+ * @param flags Bit set of options: 0 or UHASH_GROUP_PROBING.
+ * @param status A pointer to an UErrorCode to receive any errors.
+ * @return A pointer to a UHashtable, or 0 if an error occurred.
+ * @see uhash_openSize
+ */
+U_CAPI UHashtable* U_EXPORT2
+uhash_openSizeWithFlags(UHashFunction *keyHash,
+                        UKeyComparator *keyComp,
+                        UValueComparator *valueComp,
+                        int32_t size,
+                        uint32_t flags,
+                        UErrorCode *status);
+
 /**
  * Initialize an existing UHashtable.
  * @param keyHash A pointer to the key hashing function.  Must not be
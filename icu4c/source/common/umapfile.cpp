@@ -48,6 +48,8 @@
 
 #   define IS_MAP(map) ((map)!=0)
 
+#   include <errno.h>
+#   include <stdint.h>
 #   include <unistd.h>
 #   include <sys/mman.h>
 #   include <sys/stat.h>
@@ -526,3 +528,272 @@
 #else
 #   error MAP_IMPLEMENTATION is set incorrectly
 #endif
+
+/*----------------------------------------------------------------------------*
+ *                                                                            *
+ *   Whole-file mapping for arbitrary files (for example, text files),        *
+ *   independent of UDataMemory and the ICU data file format.                 *
+ *                                                                            *
+ *----------------------------------------------------------------------------*/
+#if MAP_IMPLEMENTATION==MAP_NONE
+    U_CFUNC UBool
+    uprv_mapWholeFile(UMappedFile *pFile, const char *path, UErrorCode *status) {
+        (void)path;
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+        if(U_SUCCESS(*status)) {
+            *status=U_UNSUPPORTED_ERROR; /* no file access */
+        }
+        return FALSE;
+    }
+
+    U_CFUNC void uprv_unmapWholeFile(UMappedFile *pFile) {
+        (void)pFile;
+    }
+
+    U_CFUNC void uprv_releaseWholeFileRange(UMappedFile *pFile, int64_t start, int64_t limit) {
+        (void)pFile;
+        (void)start;
+        (void)limit;
+    }
+#elif MAP_IMPLEMENTATION==MAP_WIN32
+    U_CFUNC UBool
+    uprv_mapWholeFile(UMappedFile *pFile, const char *path, UErrorCode *status) {
+        HANDLE file;
+        HANDLE map;
+        LARGE_INTEGER size;
+
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+        if(U_FAILURE(*status)) {
+            return FALSE;
+        }
+
+        /* open the input file */
+#if U_PLATFORM_HAS_WINUWP_API == 0
+        file=CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL|FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+#else
+        wchar_t utf16Path[MAX_PATH];
+        int32_t pathUtf16Len = 0;
+        u_strFromUTF8(reinterpret_cast<UChar*>(utf16Path), static_cast<int32_t>(UPRV_LENGTHOF(utf16Path)), &pathUtf16Len, path, -1, status);
+        if (U_FAILURE(*status)) {
+            return FALSE;
+        }
+        if (*status == U_STRING_NOT_TERMINATED_WARNING) {
+            *status = U_BUFFER_OVERFLOW_ERROR;
+            return FALSE;
+        }
+        file = CreateFile2(utf16Path, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, NULL);
+#endif
+        if(file==INVALID_HANDLE_VALUE) {
+            *status=HRESULT_FROM_WIN32(GetLastError())==E_OUTOFMEMORY ?
+                U_MEMORY_ALLOCATION_ERROR : U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        if(!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            *status=U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        if(size.QuadPart==0) {
+            /* An empty file cannot be mapped, but it is a valid, empty text. */
+            CloseHandle(file);
+            return TRUE;
+        }
+        if((uint64_t)size.QuadPart>(uint64_t)SIZE_MAX) {
+            CloseHandle(file);
+            *status=U_INDEX_OUTOFBOUNDS_ERROR;
+            return FALSE;
+        }
+
+#if U_PLATFORM_HAS_WINUWP_API == 0
+        map=CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+#else
+        map=CreateFileMappingFromApp(file, NULL, PAGE_READONLY, 0, NULL);
+#endif
+        CloseHandle(file);
+        if(map==NULL) {
+            *status=HRESULT_FROM_WIN32(GetLastError())==E_OUTOFMEMORY ?
+                U_MEMORY_ALLOCATION_ERROR : U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        pFile->data=(const char *)MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+        if(pFile->data==NULL) {
+            CloseHandle(map);
+            *status=U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        pFile->length=size.QuadPart;
+        pFile->map=map;
+        return TRUE;
+    }
+
+    U_CFUNC void
+    uprv_unmapWholeFile(UMappedFile *pFile) {
+        if(pFile->map!=NULL) {
+            UnmapViewOfFile(pFile->data);
+            CloseHandle(pFile->map);
+        }
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+    }
+
+    U_CFUNC void
+    uprv_releaseWholeFileRange(UMappedFile *pFile, int64_t start, int64_t limit) {
+        /* Unmodified pages of a read-only file view are trimmed from the working set as needed. */
+        (void)pFile;
+        (void)start;
+        (void)limit;
+    }
+#elif MAP_IMPLEMENTATION==MAP_POSIX || MAP_IMPLEMENTATION==MAP_390DLL
+    U_CFUNC UBool
+    uprv_mapWholeFile(UMappedFile *pFile, const char *path, UErrorCode *status) {
+        int fd;
+        struct stat mystat;
+        void *data;
+
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+        if(U_FAILURE(*status)) {
+            return FALSE;
+        }
+
+        fd=open(path, O_RDONLY);
+        if(fd==-1) {
+            *status=U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        if(fstat(fd, &mystat)!=0 || mystat.st_size<0) {
+            close(fd);
+            *status=U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        if(mystat.st_size==0) {
+            /* An empty file cannot be mapped, but it is a valid, empty text. */
+            close(fd);
+            return TRUE;
+        }
+        if((uint64_t)mystat.st_size>(uint64_t)SIZE_MAX) {
+            close(fd);
+            *status=U_INDEX_OUTOFBOUNDS_ERROR;
+            return FALSE;
+        }
+
+#if U_PLATFORM != U_PF_HPUX && MAP_IMPLEMENTATION==MAP_POSIX
+        data=mmap(0, (size_t)mystat.st_size, PROT_READ, MAP_SHARED,  fd, 0);
+#else
+        data=mmap(0, (size_t)mystat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+#endif
+        close(fd); /* no longer needed */
+        if(data==MAP_FAILED) {
+            *status= errno==ENOMEM ? U_MEMORY_ALLOCATION_ERROR : U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+#if defined(POSIX_MADV_SEQUENTIAL)
+        posix_madvise(data, (size_t)mystat.st_size, POSIX_MADV_SEQUENTIAL);
+#endif
+        pFile->data=(const char *)data;
+        pFile->length=mystat.st_size;
+        pFile->map=data;
+        return TRUE;
+    }
+
+    U_CFUNC void
+    uprv_unmapWholeFile(UMappedFile *pFile) {
+        if(pFile->map!=NULL) {
+            munmap(pFile->map, (size_t)pFile->length);
+        }
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+    }
+
+    U_CFUNC void
+    uprv_releaseWholeFileRange(UMappedFile *pFile, int64_t start, int64_t limit) {
+        if(pFile->map==NULL) {
+            return;
+        }
+        /* Only release whole pages inside the range. */
+        int64_t pageSize=sysconf(_SC_PAGESIZE);
+        if(pageSize<=0) {
+            return;
+        }
+        start=(start+pageSize-1)/pageSize*pageSize;
+        limit=limit/pageSize*pageSize;
+        if(start<limit) {
+            char *p=(char *)pFile->map+start;
+#if defined(__linux__) && defined(MADV_DONTNEED)
+            /* Linux drops the pages right away; they are read again from the file if needed. */
+            madvise(p, (size_t)(limit-start), MADV_DONTNEED);
+#elif defined(POSIX_MADV_DONTNEED)
+            posix_madvise(p, (size_t)(limit-start), POSIX_MADV_DONTNEED);
+#endif
+        }
+    }
+#elif MAP_IMPLEMENTATION==MAP_STDIO
+    U_CFUNC UBool
+    uprv_mapWholeFile(UMappedFile *pFile, const char *path, UErrorCode *status) {
+        FILE *file;
+        long fileLength;
+        void *p=NULL;
+
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+        if(U_FAILURE(*status)) {
+            return FALSE;
+        }
+
+        file=fopen(path, "rb");
+        if(file==NULL) {
+            *status=U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        if(fseek(file, 0, SEEK_END)!=0 || (fileLength=ftell(file))<0 || fseek(file, 0, SEEK_SET)!=0) {
+            fclose(file);
+            *status=U_FILE_ACCESS_ERROR;
+            return FALSE;
+        }
+        if(fileLength>0) {
+            p=uprv_malloc(fileLength);
+            if(p==NULL) {
+                fclose(file);
+                *status=U_MEMORY_ALLOCATION_ERROR;
+                return FALSE;
+            }
+            if((size_t)fileLength!=fread(p, 1, fileLength, file)) {
+                uprv_free(p);
+                fclose(file);
+                *status=U_FILE_ACCESS_ERROR;
+                return FALSE;
+            }
+        }
+        fclose(file);
+        pFile->data=(const char *)p;
+        pFile->length=fileLength;
+        pFile->map=p;
+        return TRUE;
+    }
+
+    U_CFUNC void
+    uprv_unmapWholeFile(UMappedFile *pFile) {
+        uprv_free(pFile->map);
+        pFile->data=NULL;
+        pFile->length=0;
+        pFile->map=NULL;
+    }
+
+    U_CFUNC void
+    uprv_releaseWholeFileRange(UMappedFile *pFile, int64_t start, int64_t limit) {
+        /* The file was read into memory, which stays allocated until it is unmapped. */
+        (void)pFile;
+        (void)start;
+        (void)limit;
+    }
+#endif
@@ -32,6 +32,33 @@
 U_CFUNC UBool uprv_mapFile(UDataMemory *pdm, const char *path, UErrorCode *status);
 U_CFUNC void  uprv_unmapFile(UDataMemory *pData);
 
+/**
+ * A read-only view of a whole file of any kind, for example a text file.
+ * @see uprv_mapWholeFile
+ */
+typedef struct UMappedFile {
+    const char *data;   /* The file contents; NULL if the file is empty. */
+    int64_t     length; /* The file length in bytes. */
+    void       *map;    /* Platform-specific handle or memory block. */
+} UMappedFile;
+
+/**
+ * Maps a whole file read-only, with a hint that it will be read mostly sequentially.
+ * Unlike uprv_mapFile(), this works for files of any length that fits into the
+ * address space, including empty files, and it sets an error code on failure
+ * (U_FILE_ACCESS_ERROR if the file cannot be opened or mapped).
+ * Where memory mapping is not available, the file is read into memory.
+ */
+U_CFUNC UBool uprv_mapWholeFile(UMappedFile *pFile, const char *path, UErrorCode *status);
+U_CFUNC void  uprv_unmapWholeFile(UMappedFile *pFile);
+
+/**
+ * Hints that bytes [start, limit[ of a file from uprv_mapWholeFile() will not be
+ * needed soon, so that the system can reclaim their memory.
+ * They can still be read, but may have to be read from the file again.
+ */
+U_CFUNC void  uprv_releaseWholeFileRange(UMappedFile *pFile, int64_t start, int64_t limit);
+
 /* MAP_NONE: no memory mapping, no file access at all */
 #define MAP_NONE        0
 #define MAP_WIN32       1
@@ -35,6 +35,7 @@
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class ByteSink;
 
 /**
@@ -223,10 +224,10 @@ class U_COMMON_API Normalizer2 : public UObject {
      * Normalizes a UTF-8 string and optionally records how source substrings
      * relate to changed and unchanged result substrings.
      *
-     * Currently implemented completely only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * Otherwise currently converts to & from UTF-16 and does not support edits.
+     * Implemented completely for the standard Normalizer2 instances
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD modes)
+     * and for a FilteredNormalizer2 wrapping one of them.
+     * Otherwise converts to & from UTF-16 and does not support edits.
      *
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT and U_EDITS_NO_RESET.
      * @param src       Source UTF-8 string.
@@ -379,11 +380,10 @@ class U_COMMON_API Normalizer2 : public UObject {
      * resolves to "yes" or "no" to provide a definitive result,
      * at the cost of doing more work in those cases.
      *
-     * This works for all normalization modes,
-     * but it is currently optimized for UTF-8 only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * For other modes it currently converts to UTF-16 and calls isNormalized().
+     * This works for all normalization modes.
+     * It is optimized for UTF-8 for the standard Normalizer2 instances
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD modes).
+     * For other implementations it converts to UTF-16 and calls isNormalized().
      *
      * @param s UTF-8 input string
      * @param errorCode Standard ICU error code. Its input value must
@@ -541,10 +541,10 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
      * Normalizes a UTF-8 string and optionally records how source substrings
      * relate to changed and unchanged result substrings.
      *
-     * Currently implemented completely only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * Otherwise currently converts to & from UTF-16 and does not support edits.
+     * Implemented completely for the standard Normalizer2 instances
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD modes)
+     * and for a FilteredNormalizer2 wrapping one of them.
+     * Otherwise converts to & from UTF-16 and does not support edits.
      *
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT and U_EDITS_NO_RESET.
      * @param src       Source UTF-8 string.
@@ -674,11 +674,10 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
      * resolves to "yes" or "no" to provide a definitive result,
      * at the cost of doing more work in those cases.
      *
-     * This works for all normalization modes,
-     * but it is currently optimized for UTF-8 only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * For other modes it currently converts to UTF-16 and calls isNormalized().
+     * This works for all normalization modes.
+     * It is optimized for UTF-8 for the standard Normalizer2 instances
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD modes).
+     * For other implementations it converts to UTF-16 and calls isNormalized().
      *
      * @param s UTF-8 input string
      * @param errorCode Standard ICU error code. Its input value must
@@ -768,6 +767,220 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
     const UnicodeSet &set;
 };
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Incremental normalization of text that arrives in pieces ("chunks"),
+ * such as from a file or network stream, with any Normalizer2 instance.
+ *
+ * Each call normalizes and writes out the new text up to the last
+ * normalization boundary in it, and holds back only the text after that,
+ * which may still change depending on the next chunk.
+ * Chunks may end in the middle of a character
+ * (in the middle of a UTF-8 sequence or a surrogate pair).
+ * When the input ends, call finish() or finishUTF8() to write out the rest.
+ *
+ * For well-formed text in the
+ * <a href="http://www.unicode.org/reports/tr15/#Stream_Safe_Text_Format">Stream-Safe Text Format</a>
+ * the concatenated output is the same as the normalization of
+ * the concatenated input.
+ * The held-back text is stored in a fixed-size buffer: A run of text without
+ * a boundary that is longer than this buffer is normalized in pieces.
+ * Memory use therefore does not depend on the length of the input.
+ *
+ * One object handles either UTF-16 or UTF-8 text;
+ * do not mix calls for the two between reset() calls.
+ * The object aliases the Normalizer2 which must not be deleted while the object is used.
+ * An object is not thread-safe.
+ *
+ * @draft ICU 63
+ */
+class U_COMMON_API StreamingNormalizer2 : public UObject {
+public:
+    /**
+     * Constructs a streaming normalizer for the given normalizer.
+     * @param n2 Normalizer2 instance, aliased
+     * @draft ICU 63
+     */
+    explicit StreamingNormalizer2(const Normalizer2 &n2);
+
+    /**
+     * Destructor.
+     * @draft ICU 63
+     */
+    ~StreamingNormalizer2();
+
+    /**
+     * Normalizes the next UTF-16 chunk and appends the stable part
+     * of the result to dest.
+     * @param chunk next piece of the input text
+     * @param dest destination for the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 63
+     */
+    void normalize(const UnicodeString &chunk, Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes and appends the held-back UTF-16 text to dest,
+     * and resets this object for new input.
+     * @param dest destination for the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 63
+     */
+    void finish(Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next UTF-8 chunk and writes the stable part
+     * of the result to the sink.
+     * Ill-formed byte sequences are passed through like in Normalizer2::normalizeUTF8().
+     * @param chunk next piece of the input text
+     * @param sink destination for the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 63
+     */
+    void normalizeUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Normalizes and writes the held-back UTF-8 text to the sink,
+     * and resets this object for new input.
+     * @param sink destination for the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 63
+     */
+    void finishUTF8(ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Discards any held-back text and prepares for new input.
+     * @draft ICU 63
+     */
+    void reset() { pendingLength = 0; }
+
+private:
+    StreamingNormalizer2(const StreamingNormalizer2 &) = delete;
+    StreamingNormalizer2 &operator=(const StreamingNormalizer2 &) = delete;
+
+    UBool isBoundaryBefore(UChar32 c) const;
+    UBool isBoundaryAfter(UChar32 c) const;
+
+    int32_t firstBoundary(const UChar *s, int32_t length, int32_t maxIndex) const;
+    int32_t lastBoundary(const UChar *s, int32_t start, int32_t length) const;
+    int32_t firstBoundary(const uint8_t *s, int32_t length, int32_t maxIndex) const;
+    int32_t lastBoundary(const uint8_t *s, int32_t start, int32_t length) const;
+
+    void writeNormalized(const UChar *s, int32_t length, Appendable &dest, UErrorCode &errorCode);
+
+    enum { PENDING_CAPACITY = 256 };
+
+    const Normalizer2 &norm2;
+    /** Reused for each piece of normalized UTF-16 output. */
+    UnicodeString buffer16;
+    int32_t pendingLength;
+    UChar pending16[PENDING_CAPACITY];
+    char pending8[PENDING_CAPACITY];
+};
+
+/**
+ * Multi-threaded normalization of large strings with any Normalizer2 instance.
+ *
+ * The input is split into pieces at normalization boundaries
+ * (characters for which hasBoundaryBefore() is true) near equal-sized cut points.
+ * The pieces are handled by up to the given number of threads,
+ * each taking the next unprocessed piece until there are none left,
+ * and the results are concatenated in order.
+ * The result is identical to that of the wrapped Normalizer2.
+ *
+ * Inputs shorter than 128k code units, and all inputs with a thread count of 1,
+ * are normalized on the calling thread without splitting.
+ *
+ * An instance of this class is unmodifiable/immutable and may be used by
+ * several threads at once. It aliases the Normalizer2 which must not be
+ * deleted while this object is used.
+ *
+ * @draft ICU 63
+ */
+class U_COMMON_API ParallelNormalizer2 : public UObject {
+public:
+    /**
+     * Constructs a parallel normalizer for the given normalizer.
+     * @param n2 Normalizer2 instance, aliased
+     * @param numThreads maximum number of threads used per call,
+     *                   including the calling thread; values below 1 are treated as 1
+     * @draft ICU 63
+     */
+    ParallelNormalizer2(const Normalizer2 &n2, int32_t numThreads);
+
+    /**
+     * Destructor.
+     * @draft ICU 63
+     */
+    ~ParallelNormalizer2();
+
+    /**
+     * Writes the normalized form of the source string to the destination string
+     * (replacing its contents) and returns the destination string.
+     * Same result as Normalizer2::normalize().
+     * The source and destination strings must be different objects.
+     * @param src source string
+     * @param dest destination string; its contents is replaced with normalized src
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return dest
+     * @draft ICU 63
+     */
+    UnicodeString &
+    normalize(const UnicodeString &src, UnicodeString &dest, UErrorCode &errorCode) const;
+
+    /**
+     * Normalizes a UTF-8 string and writes the result to the sink.
+     * Same result as Normalizer2::normalizeUTF8() with options 0 and without Edits.
+     * @param src       Source UTF-8 string.
+     * @param sink      A ByteSink to which the normalized UTF-8 result string is written.
+     *                  sink.Flush() is called at the end.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 63
+     */
+    void
+    normalizeUTF8(StringPiece src, ByteSink &sink, UErrorCode &errorCode) const;
+
+    /**
+     * Tests if the string is normalized.
+     * Same result as Normalizer2::quickCheck().
+     * @param s input string
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return UNormalizationCheckResult
+     * @draft ICU 63
+     */
+    UNormalizationCheckResult
+    quickCheck(const UnicodeString &s, UErrorCode &errorCode) const;
+
+private:
+    ParallelNormalizer2(const ParallelNormalizer2 &) = delete;
+    ParallelNormalizer2 &operator=(const ParallelNormalizer2 &) = delete;
+
+    const Normalizer2 &norm2;
+    int32_t numThreads;
+};
+#endif  /* U_HIDE_DRAFT_API */
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
@@ -2754,6 +2754,103 @@ u_getIntPropertyMaxValue(UProperty which);
 U_CAPI const UCPMap * U_EXPORT2
 u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode);
 
+/**
+ * Writes the value of an enumerated/catalog/int-valued property
+ * for each code unit of a UTF-16 string.
+ * All code units of a code point get the same value.
+ * The values are the same as from u_getIntPropertyValue() for the code points
+ * as iterated by U16_NEXT(): An unpaired surrogate gets the value of the surrogate code point.
+ *
+ * This is much faster than calling u_getIntPropertyValue() or u_charType() for each code point.
+ * It uses the map from u_getIntPropertyMap().
+ *
+ * @param s a UTF-16 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param which UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param values receives one value per code unit of s; must have room for that many values
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of values written, which is the length of s
+ * @see u_getIntPropertyValue
+ * @see u_getIntPropertySpans
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValues(const UChar *s, int32_t length, UProperty which,
+                       int32_t *values, UErrorCode *pErrorCode);
+
+/**
+ * Writes the value of an enumerated/catalog/int-valued property
+ * for each byte of a UTF-8 string.
+ * All bytes of a code point get the same value.
+ * The values are the same as from u_getIntPropertyValue() for the code points
+ * as iterated by U8_NEXT_OR_FFFD(): Each ill-formed sequence gets the value of U+FFFD.
+ *
+ * @param s a UTF-8 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param which UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param values receives one value per byte of s; must have room for that many values
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of values written, which is the length of s
+ * @see u_getIntPropertyValues
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertyValuesUTF8(const char *s, int32_t length, UProperty which,
+                           int32_t *values, UErrorCode *pErrorCode);
+
+/**
+ * Divides a UTF-16 string into spans of code points with the same value
+ * of an enumerated/catalog/int-valued property.
+ * Span i covers the code units from limits[i-1] (0 for the first span) to before limits[i],
+ * and all of its code points have the property value values[i].
+ * Adjacent spans have different values.
+ * The values are the same as from u_getIntPropertyValues().
+ *
+ * For example, with UCHAR_GENERAL_CATEGORY, each span has one u_charType() value.
+ *
+ * @param s a UTF-16 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param which UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param limits receives the span limits; can be NULL if capacity==0
+ * @param values receives the span values; can be NULL if capacity==0
+ * @param capacity the number of spans that fit into limits and values
+ * @param pErrorCode an in/out ICU UErrorCode;
+ *                   U_BUFFER_OVERFLOW_ERROR if there are more than capacity spans,
+ *                   in which case the first capacity spans are written
+ * @return the number of spans in s (0 if s is empty)
+ * @see u_getIntPropertyValues
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertySpans(const UChar *s, int32_t length, UProperty which,
+                      int32_t *limits, int32_t *values, int32_t capacity,
+                      UErrorCode *pErrorCode);
+
+/**
+ * Divides a UTF-8 string into spans of code points with the same value
+ * of an enumerated/catalog/int-valued property.
+ * Span i covers the bytes from limits[i-1] (0 for the first span) to before limits[i],
+ * and all of its code points have the property value values[i].
+ * The values are the same as from u_getIntPropertyValuesUTF8().
+ *
+ * @param s a UTF-8 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param which UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param limits receives the span limits; can be NULL if capacity==0
+ * @param values receives the span values; can be NULL if capacity==0
+ * @param capacity the number of spans that fit into limits and values
+ * @param pErrorCode an in/out ICU UErrorCode;
+ *                   U_BUFFER_OVERFLOW_ERROR if there are more than capacity spans,
+ *                   in which case the first capacity spans are written
+ * @return the number of spans in s (0 if s is empty)
+ * @see u_getIntPropertySpans
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+u_getIntPropertySpansUTF8(const char *s, int32_t length, UProperty which,
+                          int32_t *limits, int32_t *values, int32_t capacity,
+                          UErrorCode *pErrorCode);
+
 #endif  // U_HIDE_DRAFT_API
 
 /**
@@ -569,6 +569,74 @@ ucnv_safeClone(const UConverter *cnv,
 U_STABLE void  U_EXPORT2
 ucnv_close(UConverter * converter);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Returns a converter for the given name from a small pool of idle converters
+ * that belongs to the calling thread, or opens a new one like ucnv_open().
+ * A pooled converter is in its initial (reset) state.
+ *
+ * This is much cheaper than ucnv_open() or ucnv_safeClone() for code that
+ * uses a converter only briefly, for example once per request in a server,
+ * because it avoids the converter name lookup and the memory allocation.
+ * Return the converter with ucnv_release() when done.
+ *
+ * Only converters with the default callbacks, substitution characters
+ * and fallback setting are pooled; ucnv_release() closes other ones,
+ * so that ucnv_open() is the better choice for such converters.
+ *
+ * @param converterName name of the converter, as for ucnv_open()
+ * @param err outgoing error status
+ * @return the converter, or NULL if an error occurred
+ * @see ucnv_release
+ * @see ucnv_open
+ * @draft ICU 63
+ */
+U_CAPI UConverter * U_EXPORT2
+ucnv_acquire(const char *converterName, UErrorCode *err);
+
+/**
+ * Resets a converter from ucnv_acquire() or ucnv_open() and keeps it in
+ * the calling thread's pool for a later ucnv_acquire().
+ * A converter whose callbacks, substitution characters or fallback setting
+ * were changed is closed instead, as is one from ucnv_openPackage()
+ * or one opened by a name that is not in the alias table (such as a file path).
+ * When the pool is full, the least recently released idle converter is closed.
+ * The pool keeps a small, fixed number of idle converters.
+ * They are closed when the thread exits, with ucnv_flushPool(),
+ * or by u_cleanup() for all threads.
+ *
+ * @param converter the converter; NULL is ignored
+ * @see ucnv_acquire
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucnv_release(UConverter *converter);
+
+/**
+ * Closes all idle converters in the calling thread's pool.
+ *
+ * @see ucnv_acquire
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucnv_flushPool(void);
+
+/**
+ * Returns the number of ucnv_acquire() calls in the calling thread that were
+ * served from its pool (hits) and that had to open a converter (misses).
+ * The counts stop at INT32_MAX.
+ *
+ * @param pHits receives the number of hits; can be NULL
+ * @param pMisses receives the number of misses; can be NULL
+ * @see ucnv_acquire
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucnv_getPoolStatistics(int32_t *pHits, int32_t *pMisses);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 #if U_SHOW_CPLUSPLUS_API
 
 U_NAMESPACE_BEGIN
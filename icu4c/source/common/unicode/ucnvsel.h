@@ -184,6 +184,107 @@ U_STABLE UEnumeration * U_EXPORT2
 ucnvsel_selectForUTF8(const UConverterSelector* sel,
                       const char *s, int32_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * @{
+ * The state of an incremental selection with a converter selector.
+ * @draft ICU 63
+ */
+struct UConverterSelection;
+typedef struct UConverterSelection UConverterSelection;
+/** @} */
+
+/**
+ * Open an incremental selection, for selecting converters for text
+ * that is supplied in pieces with ucnvsel_appendString() and ucnvsel_appendUTF8().
+ * The result is the same as with ucnvsel_selectForString() or ucnvsel_selectForUTF8()
+ * on the concatenated text, even if a character is split between pieces.
+ *
+ * @param sel a selector; must remain valid while the selection is used
+ * @param status an in/out ICU UErrorCode
+ * @return the new selection
+ *
+ * @draft ICU 63
+ */
+U_CAPI UConverterSelection * U_EXPORT2
+ucnvsel_openSelection(const UConverterSelector* sel, UErrorCode *status);
+
+/**
+ * Closes an incremental selection.
+ *
+ * @param selection the selection to close
+ *
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_closeSelection(UConverterSelection *selection);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterSelectionPointer
+ * "Smart pointer" class, closes a UConverterSelection via ucnvsel_closeSelection().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 63
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterSelectionPointer, UConverterSelection, ucnvsel_closeSelection);
+
+U_NAMESPACE_END
+
+#endif
+
+/**
+ * Append a piece of UTF-16 text to an incremental selection.
+ *
+ * @param selection the selection
+ * @param s UTF-16 string
+ * @param length length of the string, or -1 if NUL-terminated
+ * @param status an in/out ICU UErrorCode
+ *
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_appendString(UConverterSelection *selection,
+                     const UChar *s, int32_t length, UErrorCode *status);
+
+/**
+ * Append a piece of UTF-8 text to an incremental selection.
+ *
+ * @param selection the selection
+ * @param s UTF-8 string
+ * @param length length of the string, or -1 if NUL-terminated
+ * @param status an in/out ICU UErrorCode
+ *
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_appendUTF8(UConverterSelection *selection,
+                   const char *s, int32_t length, UErrorCode *status);
+
+/**
+ * Returns the converters that can map all characters in the text appended
+ * since the selection was opened or last finished, ignoring the excluded code points,
+ * and resets the selection for new text.
+ *
+ * @param selection the selection
+ * @param status an in/out ICU UErrorCode
+ * @return an enumeration containing encoding names.
+ *         The returned encoding names and their order will be the same as
+ *         supplied when building the selector.
+ *
+ * @draft ICU 63
+ */
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_finishSelection(UConverterSelection *selection, UErrorCode *status);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif  /* !UCONFIG_NO_CONVERSION */
 
 #endif  /* __ICU_UCNV_SEL_H__ */
@@ -317,6 +317,106 @@ ucptrie_getRange(const UCPTrie *trie, UChar32 start,
                  UCPMapRangeOption option, uint32_t surrogateValue,
                  UCPMapValueFilter *filter, const void *context, uint32_t *pValue);
 
+/**
+ * Writes the trie value for each code unit of a UTF-16 string.
+ * All code units of a code point get the same value.
+ * The values are the same as from ucptrie_get() for the code points
+ * as iterated by U16_NEXT(): An unpaired surrogate gets the value of the surrogate code point.
+ *
+ * This is much faster than calling ucptrie_get() for each code point,
+ * and it works for all trie types and value widths.
+ *
+ * @param trie the trie
+ * @param s a UTF-16 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param values receives one value per code unit of s; must have room for that many values
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of values written, which is the length of s
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringValues(const UCPTrie *trie, const UChar *s, int32_t length,
+                        uint32_t *values, UErrorCode *pErrorCode);
+
+/**
+ * Writes the trie value for each byte of a UTF-8 string.
+ * All bytes of a code point get the same value.
+ * The values are the same as from ucptrie_get() for the code points
+ * as iterated by U8_NEXT_OR_FFFD(): Each ill-formed sequence gets the value of U+FFFD.
+ *
+ * @param trie the trie
+ * @param s a UTF-8 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param values receives one value per byte of s; must have room for that many values
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of values written, which is the length of s
+ * @see ucptrie_getStringValues
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringValuesUTF8(const UCPTrie *trie, const char *s, int32_t length,
+                            uint32_t *values, UErrorCode *pErrorCode);
+
+/**
+ * Divides a UTF-16 string into spans of code points with the same trie value.
+ * Span i covers the code units from limits[i-1] (0 for the first span) to before limits[i],
+ * and all of its code points have the value values[i].
+ * Adjacent spans have different values.
+ * The values are the same as from ucptrie_getStringValues().
+ *
+ * Example:
+ * \code
+ * int32_t limits[64];
+ * uint32_t values[64];
+ * int32_t count = ucptrie_getStringSpans(trie, s, length, limits, values, 64, &errorCode);
+ * int32_t start = 0;
+ * for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+ *     // Work with the span s[start..limits[i]-1] and its value.
+ *     start = limits[i];
+ * }
+ * \endcode
+ *
+ * @param trie the trie
+ * @param s a UTF-16 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param limits receives the span limits; can be NULL if capacity==0
+ * @param values receives the span values; can be NULL if capacity==0
+ * @param capacity the number of spans that fit into limits and values
+ * @param pErrorCode an in/out ICU UErrorCode;
+ *                   U_BUFFER_OVERFLOW_ERROR if there are more than capacity spans,
+ *                   in which case the first capacity spans are written
+ * @return the number of spans in s (0 if s is empty)
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringSpans(const UCPTrie *trie, const UChar *s, int32_t length,
+                       int32_t *limits, uint32_t *values, int32_t capacity,
+                       UErrorCode *pErrorCode);
+
+/**
+ * Divides a UTF-8 string into spans of code points with the same trie value.
+ * Span i covers the bytes from limits[i-1] (0 for the first span) to before limits[i],
+ * and all of its code points have the value values[i].
+ * The values are the same as from ucptrie_getStringValuesUTF8().
+ *
+ * @param trie the trie
+ * @param s a UTF-8 string
+ * @param length the length of s, or -1 if it is NUL-terminated
+ * @param limits receives the span limits; can be NULL if capacity==0
+ * @param values receives the span values; can be NULL if capacity==0
+ * @param capacity the number of spans that fit into limits and values
+ * @param pErrorCode an in/out ICU UErrorCode;
+ *                   U_BUFFER_OVERFLOW_ERROR if there are more than capacity spans,
+ *                   in which case the first capacity spans are written
+ * @return the number of spans in s (0 if s is empty)
+ * @see ucptrie_getStringSpans
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+ucptrie_getStringSpansUTF8(const UCPTrie *trie, const char *s, int32_t length,
+                           int32_t *limits, uint32_t *values, int32_t capacity,
+                           UErrorCode *pErrorCode);
+
 /**
  * Writes a memory-mappable form of the trie into 32-bit aligned memory.
  * Inverse of ucptrie_openFromBinary().
@@ -569,6 +569,26 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
      */
     UnicodeFunctor *freeze();
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Freeze the set (make it immutable), like freeze(),
+     * with options for the data structures built for fast lookups.
+     * A frozen set will not be modified. (It remains frozen.)
+     *
+     * With USET_FREEZE_CODE_POINT_TRIE, freezing builds a code point trie
+     * for faster lookups of code points in mixed BMP blocks and of supplementary
+     * code points. For a large set like [:L:] this takes several milliseconds,
+     * about a thousand times as long as freeze() without it.
+     * Copies and clones of the frozen set copy the trie.
+     * @param options USET_FREEZE_CODE_POINT_TRIE or 0
+     * @return this set.
+     * @see freeze
+     * @see isFrozen
+     * @draft ICU 63
+     */
+    UnicodeFunctor *freeze(uint32_t options);
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Clone the set and make the clone mutable.
      * See the ICU4J Freezable interface for details.
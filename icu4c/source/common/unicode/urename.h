@@ -264,7 +264,11 @@
 #define u_getISOComment U_ICU_ENTRY_POINT_RENAME(u_getISOComment)
 #define u_getIntPropertyMaxValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyMaxValue)
 #define u_getIntPropertyMinValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyMinValue)
+#define u_getIntPropertySpans U_ICU_ENTRY_POINT_RENAME(u_getIntPropertySpans)
+#define u_getIntPropertySpansUTF8 U_ICU_ENTRY_POINT_RENAME(u_getIntPropertySpansUTF8)
 #define u_getIntPropertyValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValue)
+#define u_getIntPropertyValues U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValues)
+#define u_getIntPropertyValuesUTF8 U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValuesUTF8)
 #define u_getMainProperties U_ICU_ENTRY_POINT_RENAME(u_getMainProperties)
 #define u_getNumericValue U_ICU_ENTRY_POINT_RENAME(u_getNumericValue)
 #define u_getPropertyEnum U_ICU_ENTRY_POINT_RENAME(u_getPropertyEnum)
@@ -596,6 +600,7 @@
 #define ucnv_MBCSIsLeadByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsLeadByte)
 #define ucnv_MBCSSimpleGetNextUChar U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSSimpleGetNextUChar)
 #define ucnv_MBCSToUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSToUnicodeWithOffsets)
+#define ucnv_acquire U_ICU_ENTRY_POINT_RENAME(ucnv_acquire)
 #define ucnv_bld_countAvailableConverters U_ICU_ENTRY_POINT_RENAME(ucnv_bld_countAvailableConverters)
 #define ucnv_bld_getAvailableConverter U_ICU_ENTRY_POINT_RENAME(ucnv_bld_getAvailableConverter)
 #define ucnv_canCreateConverter U_ICU_ENTRY_POINT_RENAME(ucnv_canCreateConverter)
@@ -626,6 +631,7 @@
 #define ucnv_extSimpleMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extSimpleMatchToU)
 #define ucnv_fixFileSeparator U_ICU_ENTRY_POINT_RENAME(ucnv_fixFileSeparator)
 #define ucnv_flushCache U_ICU_ENTRY_POINT_RENAME(ucnv_flushCache)
+#define ucnv_flushPool U_ICU_ENTRY_POINT_RENAME(ucnv_flushPool)
 #define ucnv_fromAlgorithmic U_ICU_ENTRY_POINT_RENAME(ucnv_fromAlgorithmic)
 #define ucnv_fromUChars U_ICU_ENTRY_POINT_RENAME(ucnv_fromUChars)
 #define ucnv_fromUCountPending U_ICU_ENTRY_POINT_RENAME(ucnv_fromUCountPending)
@@ -650,6 +656,7 @@
 #define ucnv_getNextUChar U_ICU_ENTRY_POINT_RENAME(ucnv_getNextUChar)
 #define ucnv_getNonSurrogateUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_getNonSurrogateUnicodeSet)
 #define ucnv_getPlatform U_ICU_ENTRY_POINT_RENAME(ucnv_getPlatform)
+#define ucnv_getPoolStatistics U_ICU_ENTRY_POINT_RENAME(ucnv_getPoolStatistics)
 #define ucnv_getStandard U_ICU_ENTRY_POINT_RENAME(ucnv_getStandard)
 #define ucnv_getStandardName U_ICU_ENTRY_POINT_RENAME(ucnv_getStandardName)
 #define ucnv_getStarters U_ICU_ENTRY_POINT_RENAME(ucnv_getStarters)
@@ -660,6 +667,8 @@
 #define ucnv_incrementRefCount U_ICU_ENTRY_POINT_RENAME(ucnv_incrementRefCount)
 #define ucnv_io_countKnownConverters U_ICU_ENTRY_POINT_RENAME(ucnv_io_countKnownConverters)
 #define ucnv_io_getConverterName U_ICU_ENTRY_POINT_RENAME(ucnv_io_getConverterName)
+#define ucnv_io_getHashSlot U_ICU_ENTRY_POINT_RENAME(ucnv_io_getHashSlot)
+#define ucnv_io_hashNormalizedName U_ICU_ENTRY_POINT_RENAME(ucnv_io_hashNormalizedName)
 #define ucnv_io_stripASCIIForCompare U_ICU_ENTRY_POINT_RENAME(ucnv_io_stripASCIIForCompare)
 #define ucnv_io_stripEBCDICForCompare U_ICU_ENTRY_POINT_RENAME(ucnv_io_stripEBCDICForCompare)
 #define ucnv_isAmbiguous U_ICU_ENTRY_POINT_RENAME(ucnv_isAmbiguous)
@@ -672,6 +681,7 @@
 #define ucnv_openPackage U_ICU_ENTRY_POINT_RENAME(ucnv_openPackage)
 #define ucnv_openStandardNames U_ICU_ENTRY_POINT_RENAME(ucnv_openStandardNames)
 #define ucnv_openU U_ICU_ENTRY_POINT_RENAME(ucnv_openU)
+#define ucnv_release U_ICU_ENTRY_POINT_RENAME(ucnv_release)
 #define ucnv_reset U_ICU_ENTRY_POINT_RENAME(ucnv_reset)
 #define ucnv_resetFromUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetFromUnicode)
 #define ucnv_resetToUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetToUnicode)
@@ -693,9 +703,14 @@
 #define ucnv_unload U_ICU_ENTRY_POINT_RENAME(ucnv_unload)
 #define ucnv_unloadSharedDataIfReady U_ICU_ENTRY_POINT_RENAME(ucnv_unloadSharedDataIfReady)
 #define ucnv_usesFallback U_ICU_ENTRY_POINT_RENAME(ucnv_usesFallback)
+#define ucnvsel_appendString U_ICU_ENTRY_POINT_RENAME(ucnvsel_appendString)
+#define ucnvsel_appendUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_appendUTF8)
 #define ucnvsel_close U_ICU_ENTRY_POINT_RENAME(ucnvsel_close)
+#define ucnvsel_closeSelection U_ICU_ENTRY_POINT_RENAME(ucnvsel_closeSelection)
+#define ucnvsel_finishSelection U_ICU_ENTRY_POINT_RENAME(ucnvsel_finishSelection)
 #define ucnvsel_open U_ICU_ENTRY_POINT_RENAME(ucnvsel_open)
 #define ucnvsel_openFromSerialized U_ICU_ENTRY_POINT_RENAME(ucnvsel_openFromSerialized)
+#define ucnvsel_openSelection U_ICU_ENTRY_POINT_RENAME(ucnvsel_openSelection)
 #define ucnvsel_selectForString U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForString)
 #define ucnvsel_selectForUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8)
 #define ucnvsel_serialize U_ICU_ENTRY_POINT_RENAME(ucnvsel_serialize)
@@ -766,12 +781,18 @@
 #define ucol_swap U_ICU_ENTRY_POINT_RENAME(ucol_swap)
 #define ucol_swapInverseUCA U_ICU_ENTRY_POINT_RENAME(ucol_swapInverseUCA)
 #define ucol_tertiaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_tertiaryOrder)
+#define ucptrie_getStringSpans U_ICU_ENTRY_POINT_RENAME(ucptrie_getStringSpans)
+#define ucptrie_getStringSpansUTF8 U_ICU_ENTRY_POINT_RENAME(ucptrie_getStringSpansUTF8)
+#define ucptrie_getStringValues U_ICU_ENTRY_POINT_RENAME(ucptrie_getStringValues)
+#define ucptrie_getStringValuesUTF8 U_ICU_ENTRY_POINT_RENAME(ucptrie_getStringValuesUTF8)
+#define ucsdet_appendText U_ICU_ENTRY_POINT_RENAME(ucsdet_appendText)
 #define ucsdet_close U_ICU_ENTRY_POINT_RENAME(ucsdet_close)
 #define ucsdet_detect U_ICU_ENTRY_POINT_RENAME(ucsdet_detect)
 #define ucsdet_detectAll U_ICU_ENTRY_POINT_RENAME(ucsdet_detectAll)
 #define ucsdet_enableInputFilter U_ICU_ENTRY_POINT_RENAME(ucsdet_enableInputFilter)
 #define ucsdet_getAllDetectableCharsets U_ICU_ENTRY_POINT_RENAME(ucsdet_getAllDetectableCharsets)
 #define ucsdet_getConfidence U_ICU_ENTRY_POINT_RENAME(ucsdet_getConfidence)
+#define ucsdet_getConfidenceThreshold U_ICU_ENTRY_POINT_RENAME(ucsdet_getConfidenceThreshold)
 #define ucsdet_getDetectableCharsets U_ICU_ENTRY_POINT_RENAME(ucsdet_getDetectableCharsets)
 #define ucsdet_getLanguage U_ICU_ENTRY_POINT_RENAME(ucsdet_getLanguage)
 #define ucsdet_getName U_ICU_ENTRY_POINT_RENAME(ucsdet_getName)
@@ -779,6 +800,7 @@
 #define ucsdet_isInputFilterEnabled U_ICU_ENTRY_POINT_RENAME(ucsdet_isInputFilterEnabled)
 #define ucsdet_open U_ICU_ENTRY_POINT_RENAME(ucsdet_open)
 #define ucsdet_setDeclaredEncoding U_ICU_ENTRY_POINT_RENAME(ucsdet_setDeclaredEncoding)
+#define ucsdet_setConfidenceThreshold U_ICU_ENTRY_POINT_RENAME(ucsdet_setConfidenceThreshold)
 #define ucsdet_setDetectableCharset U_ICU_ENTRY_POINT_RENAME(ucsdet_setDetectableCharset)
 #define ucsdet_setText U_ICU_ENTRY_POINT_RENAME(ucsdet_setText)
 #define ucurr_countCurrencies U_ICU_ENTRY_POINT_RENAME(ucurr_countCurrencies)
@@ -957,6 +979,7 @@
 #define uhash_nextElement U_ICU_ENTRY_POINT_RENAME(uhash_nextElement)
 #define uhash_open U_ICU_ENTRY_POINT_RENAME(uhash_open)
 #define uhash_openSize U_ICU_ENTRY_POINT_RENAME(uhash_openSize)
+#define uhash_openSizeWithFlags U_ICU_ENTRY_POINT_RENAME(uhash_openSizeWithFlags)
 #define uhash_put U_ICU_ENTRY_POINT_RENAME(uhash_put)
 #define uhash_puti U_ICU_ENTRY_POINT_RENAME(uhash_puti)
 #define uhash_remove U_ICU_ENTRY_POINT_RENAME(uhash_remove)
@@ -1593,6 +1616,7 @@
 #define uset_containsString U_ICU_ENTRY_POINT_RENAME(uset_containsString)
 #define uset_equals U_ICU_ENTRY_POINT_RENAME(uset_equals)
 #define uset_freeze U_ICU_ENTRY_POINT_RENAME(uset_freeze)
+#define uset_freezeWithOptions U_ICU_ENTRY_POINT_RENAME(uset_freezeWithOptions)
 #define uset_getItem U_ICU_ENTRY_POINT_RENAME(uset_getItem)
 #define uset_getItemCount U_ICU_ENTRY_POINT_RENAME(uset_getItemCount)
 #define uset_getSerializedRange U_ICU_ENTRY_POINT_RENAME(uset_getSerializedRange)
@@ -1699,7 +1723,9 @@
 #define utext_openConstUnicodeString U_ICU_ENTRY_POINT_RENAME(utext_openConstUnicodeString)
 #define utext_openReplaceable U_ICU_ENTRY_POINT_RENAME(utext_openReplaceable)
 #define utext_openUChars U_ICU_ENTRY_POINT_RENAME(utext_openUChars)
+#define utext_openUTF16File U_ICU_ENTRY_POINT_RENAME(utext_openUTF16File)
 #define utext_openUTF8 U_ICU_ENTRY_POINT_RENAME(utext_openUTF8)
+#define utext_openUTF8File U_ICU_ENTRY_POINT_RENAME(utext_openUTF8File)
 #define utext_openUnicodeString U_ICU_ENTRY_POINT_RENAME(utext_openUnicodeString)
 #define utext_previous32 U_ICU_ENTRY_POINT_RENAME(utext_previous32)
 #define utext_previous32From U_ICU_ENTRY_POINT_RENAME(utext_previous32From)
@@ -244,6 +244,65 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status);
 U_STABLE UText * U_EXPORT2
 utext_openUChars(UText *ut, const UChar *s, int64_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Open a read-only UText for a UTF-8 text file.
+ * The file is memory-mapped where the platform supports it, and it is converted
+ * to UTF-16 in small chunks only as the text is accessed,
+ * so that even very large files can be processed with little memory.
+ *
+ * Native indexes are byte offsets in the file.
+ * A UTF-8 signature byte sequence (BOM) is not removed;
+ * it is part of the text as U+FEFF.
+ * Invalid UTF-8 is handled as for utext_openUTF8().
+ *
+ * The file must not be modified while the UText (or any clone of it) is open.
+ * Clones, including deep clones, share the same read-only view of the file.
+ *
+ * @param ut     Pointer to a UText struct.  If NULL, a new UText will be created.
+ *               If non-NULL, must refer to an initialized UText struct, which will then
+ *               be reset to reference the specified file.
+ * @param path   The path of the file.  Must not be NULL.
+ * @param status Errors are returned here.
+ *               U_FILE_ACCESS_ERROR if the file cannot be opened or mapped.
+ * @return       A pointer to the UText.  If a pre-allocated UText was provided, it
+ *               will always be used and returned.
+ * @see utext_openUTF8
+ * @draft ICU 63
+ */
+U_CAPI UText * U_EXPORT2
+utext_openUTF8File(UText *ut, const char *path, UErrorCode *status);
+
+/**
+ * Open a read-only UText for a UTF-16 text file.
+ * The file is memory-mapped where the platform supports it.
+ * If its byte order is the platform's, the UText accesses the mapped text directly;
+ * otherwise it converts the text in small chunks only as it is accessed.
+ *
+ * The byte order is determined by the byte order mark (BOM) at the start of the file,
+ * as for the "UTF-16" converter: without a BOM, the file is read as big-endian.
+ * The BOM is not removed; it is part of the text as U+FEFF.
+ * Native indexes are the indexes of the 16-bit code units, that is, half of the byte offsets.
+ * An odd byte at the end of the file is ignored.
+ *
+ * The file must not be modified while the UText (or any clone of it) is open.
+ * Clones, including deep clones, share the same read-only view of the file.
+ *
+ * @param ut     Pointer to a UText struct.  If NULL, a new UText will be created.
+ *               If non-NULL, must refer to an initialized UText struct, which will then
+ *               be reset to reference the specified file.
+ * @param path   The path of the file.  Must not be NULL.
+ * @param status Errors are returned here.
+ *               U_FILE_ACCESS_ERROR if the file cannot be opened or mapped.
+ * @return       A pointer to the UText.  If a pre-allocated UText was provided, it
+ *               will always be used and returned.
+ * @see utext_openUChars
+ * @draft ICU 63
+ */
+U_CAPI UText * U_EXPORT2
+utext_openUTF16File(UText *ut, const char *path, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 #if U_SHOW_CPLUSPLUS_API
 /**
@@ -112,10 +112,12 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
 
-    fHashtable = uhash_open(
+    fHashtable = uhash_openSizeWithFlags(
             &ucache_hashKeys,
             &ucache_compareKeys,
             NULL,
+            0,
+            UHASH_GROUP_PROBING,
             &status);
     if (U_FAILURE(status)) {
         return;
@@ -2176,6 +2176,10 @@ void UnicodeSet::setPattern(const UnicodeString& newPat) {
 }
 
 UnicodeFunctor *UnicodeSet::freeze() {
+    return freeze(0);
+}
+
+UnicodeFunctor *UnicodeSet::freeze(uint32_t options) {
     if(!isFrozen() && !isBogus()) {
         // Do most of what compact() does before freezing because
         // compact() will not work when the set is frozen.
@@ -2212,7 +2216,7 @@ UnicodeFunctor *UnicodeSet::freeze() {
         }
         if (stringSpan == NULL) {
             // No span-relevant strings: Optimize for code point spans.
-            bmpSet=new BMPSet(list, len);
+            bmpSet=new BMPSet(list, len, options);
             if (bmpSet == NULL) { // Check for memory allocation error.
                 setToBogus();
             }
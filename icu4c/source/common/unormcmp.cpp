@@ -30,6 +30,7 @@
 #include "normalizer2impl.h"
 #include "ucase.h"
 #include "uprops.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 
 U_NAMESPACE_USE
@@ -548,7 +549,9 @@ UBool _normalize(const Normalizer2 *n2, const UChar *s, int32_t length,
      */
     if(spanQCYes<str.length()) {
         UnicodeString unnormalized=str.tempSubString(spanQCYes);
-        normalized.setTo(FALSE, str.getBuffer(), spanQCYes);
+        // Copy rather than alias the prefix so that a stack buffer
+        // provided by the caller is used as long as the result fits.
+        normalized.setTo(str.getBuffer(), spanQCYes);
         n2->normalizeSecondAndAppend(normalized, unnormalized, *pErrorCode);
         if (U_SUCCESS(*pErrorCode)) {
             return TRUE;
@@ -571,7 +574,40 @@ unorm_compare(const UChar *s1, int32_t length1,
         return 0;
     }
 
-    UnicodeString fcd1, fcd2;
+    /*
+     * Skip the common prefix of ASCII characters.
+     * They are starters that do not decompose, and they case-fold
+     * one-to-one without context, to ASCII characters, so neither
+     * normalization nor case folding of the rest of the strings
+     * interacts with them.
+     * With the Turkic option, I does not fold to i, so only skip identical ones.
+     */
+    UBool foldASCII=(options&U_COMPARE_IGNORE_CASE)!=0 &&
+                    (options&U_FOLD_CASE_EXCLUDE_SPECIAL_I)==0;
+    int32_t prefix=usimd_asciiEqualPrefix(s1, length1, s2, length2, foldASCII, FALSE);
+    if(prefix>0) {
+        s1+=prefix;
+        s2+=prefix;
+        if(length1>=0) { length1-=prefix; }
+        if(length2>=0) { length2-=prefix; }
+    }
+    if((foldASCII || (options&U_COMPARE_IGNORE_CASE)==0) && length1!=0 && length2!=0) {
+        // If the next characters are both ASCII, then they differ
+        // (after folding), which yields the result.
+        UChar32 c1=*s1, c2=*s2;
+        if(0<c1 && c1<=0x7f && 0<c2 && c2<=0x7f) {
+            if(foldASCII) {
+                c1=usimd_asciiFoldCase(c1);
+                c2=usimd_asciiFoldCase(c2);
+            }
+            return c1-c2;
+        }
+    }
+
+    // Normalize short strings into stack buffers.
+    UChar stackBuffer1[256], stackBuffer2[256];
+    UnicodeString fcd1(stackBuffer1, 0, UPRV_LENGTHOF(stackBuffer1));
+    UnicodeString fcd2(stackBuffer2, 0, UPRV_LENGTHOF(stackBuffer2));
     int32_t normOptions=(int32_t)(options>>UNORM_COMPARE_NORM_OPTIONS_SHIFT);
     options|=_COMPARE_EQUIV;
 
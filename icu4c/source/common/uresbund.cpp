@@ -271,7 +271,8 @@ static UBool U_CALLCONV ures_cleanup(void)
 /** INTERNAL: Initializes the cache for resources */
 static void U_CALLCONV createCache(UErrorCode &status) {
     U_ASSERT(cache == NULL);
-    cache = uhash_open(hashEntry, compareEntries, NULL, &status);
+    cache = uhash_openSizeWithFlags(hashEntry, compareEntries, NULL,
+                                    0, UHASH_GROUP_PROBING, &status);
     ucln_common_registerCleanup(UCLN_COMMON_URES, ures_cleanup);
 }
      
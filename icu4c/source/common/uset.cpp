@@ -60,6 +60,11 @@ uset_freeze(USet *set) {
     ((UnicodeSet*) set)->UnicodeSet::freeze();
 }
 
+U_CAPI void U_EXPORT2
+uset_freezeWithOptions(USet *set, uint32_t options) {
+    ((UnicodeSet*) set)->UnicodeSet::freeze(options);
+}
+
 U_CAPI USet * U_EXPORT2
 uset_cloneAsThawed(const USet *set) {
     return (USet*) (((UnicodeSet*) set)->UnicodeSet::cloneAsThawed());
@@ -0,0 +1,715 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  usimd.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Block-at-a-time helpers for the ASCII and "below some threshold"
+*   fast paths in string conversion, normalization, case mapping
+*   and UnicodeSet spans.
+*
+*   Each helper processes as many leading units as it can and returns
+*   that count; the caller continues with its regular per-code point loop
+*   at the first unit the helper did not handle.
+*
+*   With SSE2 (always available on x86-64) the helpers work on
+*   16 bytes or 8 UChars at a time.
+*   Otherwise they test 4 or 8 bytes at a time with plain integer
+*   operations on unaligned loads (via uprv_memcpy), which compilers
+*   turn into single word loads.
+*   Define U_SIMD_SSE2 to 0 to force the portable code.
+*/
+
+#ifndef __USIMD_H__
+#define __USIMD_H__
+
+#include "unicode/utypes.h"
+#include "cmemory.h"
+
+#ifndef U_SIMD_SSE2
+#   if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define U_SIMD_SSE2 1
+#   else
+#       define U_SIMD_SSE2 0
+#   endif
+#endif
+
+#if U_SIMD_SSE2
+#   include <emmintrin.h>
+#endif
+
+/**
+ * Returns the number of leading bytes in s[0..length[ that are ASCII (<0x80).
+ * @internal
+ */
+static inline int32_t
+usimd_asciiPrefixLength(const uint8_t *s, int32_t length) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    while((length-i)>=16) {
+        int mask=_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s+i)));
+        if(mask!=0) {
+            while(s[i]<0x80) { ++i; }
+            return i;
+        }
+        i+=16;
+    }
+#else
+    while((length-i)>=4) {
+        uint32_t w;
+        uprv_memcpy(&w, s+i, 4);
+        if((w&0x80808080)!=0) {
+            break;
+        }
+        i+=4;
+    }
+#endif
+    while(i<length && s[i]<0x80) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the number of leading bytes in s[0..length[ that are less than limit.
+ * limit must be at least 1.
+ * @internal
+ */
+static inline int32_t
+usimd_u8PrefixBelow(const uint8_t *s, int32_t length, uint8_t limit) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    // b>=limit iff b-(limit-1) with unsigned saturation is not zero.
+    const __m128i lim1=_mm_set1_epi8((char)(limit-1));
+    const __m128i zero=_mm_setzero_si128();
+    while((length-i)>=16) {
+        __m128i v=_mm_subs_epu8(_mm_loadu_si128((const __m128i *)(s+i)), lim1);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero))!=0xffff) {
+            break;
+        }
+        i+=16;
+    }
+#else
+    while((length-i)>=4 &&
+            s[i]<limit && s[i+1]<limit && s[i+2]<limit && s[i+3]<limit) {
+        i+=4;
+    }
+#endif
+    while(i<length && s[i]<limit) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the number of leading UChars in s[0..length[ that are less than limit.
+ * limit must be at least 1.
+ * @internal
+ */
+static inline int32_t
+usimd_u16PrefixBelow(const UChar *s, int32_t length, UChar limit) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    // u>=limit iff u-(limit-1) with unsigned saturation is not zero.
+    const __m128i lim1=_mm_set1_epi16((short)(limit-1));
+    const __m128i zero=_mm_setzero_si128();
+    while((length-i)>=8) {
+        __m128i v=_mm_subs_epu16(_mm_loadu_si128((const __m128i *)(s+i)), lim1);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(v, zero))!=0xffff) {
+            break;
+        }
+        i+=8;
+    }
+#else
+    while((length-i)>=4 &&
+            s[i]<limit && s[i+1]<limit && s[i+2]<limit && s[i+3]<limit) {
+        i+=4;
+    }
+#endif
+    while(i<length && s[i]<limit) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Maps A-Z to a-z and returns any other code unit or code point unchanged.
+ * @internal
+ */
+static inline UChar32
+usimd_asciiFoldCase(UChar32 c) {
+    return (uint32_t)(c-0x41)<26 ? (c|0x20) : c;
+}
+
+/**
+ * Returns the number of leading positions i where s1[i] and s2[i] are
+ * both non-NUL ASCII (U+0001..U+007F) and equal, or, with foldCase,
+ * equal after mapping A-Z to a-z.
+ * A length of -1 means NUL-terminated.
+ * With maxLengths, non-negative lengths are only upper bounds
+ * (strncmp style), and a string may end at a NUL before its length.
+ * Such strings are read only one unit at a time, so that no unit
+ * after the terminating NUL is read.
+ * @internal
+ */
+static inline int32_t
+usimd_asciiEqualPrefix(const UChar *s1, int32_t length1,
+                       const UChar *s2, int32_t length2,
+                       UBool foldCase, UBool maxLengths) {
+    int32_t i=0;
+    int32_t length;
+    if(length1>=0 && length2>=0) {
+        length=length1<=length2 ? length1 : length2;
+    } else if(length1>=0) {
+        length=length1;
+    } else if(length2>=0) {
+        length=length2;
+    } else {
+        length=INT32_MAX;
+    }
+#if U_SIMD_SSE2
+    if(length1>=0 && length2>=0 && !maxLengths) {
+        const __m128i zero=_mm_setzero_si128();
+        const __m128i high=_mm_set1_epi16((short)0xff80);
+        const __m128i beforeA=_mm_set1_epi16(0x40), afterZ=_mm_set1_epi16(0x5b);
+        const __m128i caseBit=_mm_set1_epi16(foldCase ? 0x20 : 0);
+        while((length-i)>=8) {
+            __m128i v1=_mm_loadu_si128((const __m128i *)(s1+i));
+            __m128i v2=_mm_loadu_si128((const __m128i *)(s2+i));
+            // Signed compares: units >=0x8000 are negative and never in A..Z.
+            __m128i upper1=_mm_and_si128(_mm_cmpgt_epi16(v1, beforeA), _mm_cmplt_epi16(v1, afterZ));
+            __m128i upper2=_mm_and_si128(_mm_cmpgt_epi16(v2, beforeA), _mm_cmplt_epi16(v2, afterZ));
+            __m128i eq=_mm_cmpeq_epi16(_mm_or_si128(v1, _mm_and_si128(upper1, caseBit)),
+                                       _mm_or_si128(v2, _mm_and_si128(upper2, caseBit)));
+            // Equal after folding implies that v2 is ASCII if v1 is.
+            __m128i ascii1=_mm_cmpeq_epi16(_mm_and_si128(v1, high), zero);
+            __m128i nul1=_mm_cmpeq_epi16(v1, zero);
+            if(_mm_movemask_epi8(_mm_andnot_si128(nul1, _mm_and_si128(eq, ascii1)))!=0xffff) {
+                break;
+            }
+            i+=8;
+        }
+    }
+#else
+    (void)maxLengths;
+#endif
+    while(i<length) {
+        UChar32 c1=s1[i], c2=s2[i];
+        if(c1==0 || c1>0x7f || c2==0 || c2>0x7f) {
+            break;
+        }
+        if(foldCase) {
+            c1=usimd_asciiFoldCase(c1);
+            c2=usimd_asciiFoldCase(c2);
+        }
+        if(c1!=c2) {
+            break;
+        }
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the number of leading bytes in s[0..length[ that are ASCII
+ * but not in first..first+25.
+ * With first='A' (lowercasing) or first='a' (uppercasing), these are
+ * the bytes that ASCII case mapping leaves unchanged.
+ * @internal
+ */
+static inline int32_t
+usimd_u8UnmappedPrefix(const uint8_t *s, int32_t length, uint8_t first) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    // b is in first..first+25 iff b+(0x80-first) is in -0x80..-0x67 (signed).
+    const __m128i offset=_mm_set1_epi8((char)(0x80-first));
+    const __m128i limit=_mm_set1_epi8((char)(-0x80+26));
+    while((length-i)>=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i));
+        __m128i inRange=_mm_cmplt_epi8(_mm_add_epi8(v, offset), limit);
+        if(_mm_movemask_epi8(_mm_or_si128(v, inRange))!=0) {
+            break;
+        }
+        i+=16;
+    }
+#endif
+    uint8_t b;
+    while(i<length && (b=s[i])<0x80 && (uint8_t)(b-first)>=26) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the number of leading UChars in s[0..length[ that are ASCII
+ * but not in first..first+25.
+ * @see usimd_u8UnmappedPrefix
+ * @internal
+ */
+static inline int32_t
+usimd_u16UnmappedPrefix(const UChar *s, int32_t length, UChar first) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    // u is in first..first+25 iff (u-first)^0x8000 is in -0x8000..-0x7fe7 (signed).
+    const __m128i high=_mm_set1_epi16((short)0xff80);
+    const __m128i zero=_mm_setzero_si128();
+    const __m128i offset=_mm_set1_epi16((short)(0x8000-first));
+    const __m128i limit=_mm_set1_epi16((short)(-0x8000+26));
+    while((length-i)>=8) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i));
+        __m128i inRange=_mm_cmplt_epi16(_mm_add_epi16(v, offset), limit);
+        __m128i ascii=_mm_cmpeq_epi16(_mm_and_si128(v, high), zero);
+        if(_mm_movemask_epi8(_mm_andnot_si128(inRange, ascii))!=0xffff) {
+            break;
+        }
+        i+=8;
+    }
+#endif
+    UChar c;
+    while(i<length && (c=s[i])<0x80 && (UChar)(c-first)>=26) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Copies src[0..length[ to dest, toggling the case bit (0x20)
+ * of each byte in first..first+25.
+ * All of src[0..length[ must be ASCII.
+ * With first='A' this lowercases, with first='a' it uppercases.
+ * @internal
+ */
+static inline void
+usimd_u8MapASCIILetters(uint8_t *dest, const uint8_t *src, int32_t length, uint8_t first) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i offset=_mm_set1_epi8((char)(0x80-first));
+    const __m128i limit=_mm_set1_epi8((char)(-0x80+26));
+    const __m128i caseBit=_mm_set1_epi8(0x20);
+    while((length-i)>=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(src+i));
+        __m128i inRange=_mm_cmplt_epi8(_mm_add_epi8(v, offset), limit);
+        _mm_storeu_si128((__m128i *)(dest+i),
+                         _mm_xor_si128(v, _mm_and_si128(inRange, caseBit)));
+        i+=16;
+    }
+#endif
+    for(; i<length; ++i) {
+        uint8_t b=src[i];
+        dest[i]=(uint8_t)(b-first)<26 ? (uint8_t)(b^0x20) : b;
+    }
+}
+
+/**
+ * Copies src[0..length[ to dest, toggling the case bit (0x20)
+ * of each UChar in first..first+25.
+ * All of src[0..length[ must be ASCII.
+ * @see usimd_u8MapASCIILetters
+ * @internal
+ */
+static inline void
+usimd_u16MapASCIILetters(UChar *dest, const UChar *src, int32_t length, UChar first) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i offset=_mm_set1_epi16((short)(0x8000-first));
+    const __m128i limit=_mm_set1_epi16((short)(-0x8000+26));
+    const __m128i caseBit=_mm_set1_epi16(0x20);
+    while((length-i)>=8) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(src+i));
+        __m128i inRange=_mm_cmplt_epi16(_mm_add_epi16(v, offset), limit);
+        _mm_storeu_si128((__m128i *)(dest+i),
+                         _mm_xor_si128(v, _mm_and_si128(inRange, caseBit)));
+        i+=8;
+    }
+#endif
+    for(; i<length; ++i) {
+        UChar c=src[i];
+        dest[i]=(UChar)(c-first)<26 ? (UChar)(c^0x20) : c;
+    }
+}
+
+/**
+ * Widens leading ASCII bytes from src[0..length[ into dest
+ * and returns their number.
+ * dest must have room for length UChars.
+ * @internal
+ */
+static inline int32_t
+usimd_widenASCII(UChar *dest, const uint8_t *src, int32_t length) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i zero=_mm_setzero_si128();
+    while((length-i)>=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(src+i));
+        if(_mm_movemask_epi8(v)!=0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dest+i+8), _mm_unpackhi_epi8(v, zero));
+        i+=16;
+    }
+#else
+    while((length-i)>=4) {
+        uint32_t w;
+        uprv_memcpy(&w, src+i, 4);
+        if((w&0x80808080)!=0) {
+            break;
+        }
+        dest[i]=src[i];
+        dest[i+1]=src[i+1];
+        dest[i+2]=src[i+2];
+        dest[i+3]=src[i+3];
+        i+=4;
+    }
+#endif
+    uint8_t b;
+    while(i<length && (b=src[i])<0x80) {
+        dest[i++]=b;
+    }
+    return i;
+}
+
+/**
+ * Narrows leading ASCII UChars (<0x80) from src[0..length[ into dest
+ * and returns their number.
+ * dest must have room for length bytes.
+ * @internal
+ */
+static inline int32_t
+usimd_narrowASCII(uint8_t *dest, const UChar *src, int32_t length) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i high=_mm_set1_epi16((short)0xff80);
+    const __m128i zero=_mm_setzero_si128();
+    while((length-i)>=16) {
+        __m128i v0=_mm_loadu_si128((const __m128i *)(src+i));
+        __m128i v1=_mm_loadu_si128((const __m128i *)(src+i+8));
+        __m128i h=_mm_and_si128(_mm_or_si128(v0, v1), high);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(h, zero))!=0xffff) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_packus_epi16(v0, v1));
+        i+=16;
+    }
+#else
+    while((length-i)>=4) {
+        UChar c0=src[i], c1=src[i+1], c2=src[i+2], c3=src[i+3];
+        if(((c0|c1|c2|c3)&0xff80)!=0) {
+            break;
+        }
+        dest[i]=(uint8_t)c0;
+        dest[i+1]=(uint8_t)c1;
+        dest[i+2]=(uint8_t)c2;
+        dest[i+3]=(uint8_t)c3;
+        i+=4;
+    }
+#endif
+    UChar c;
+    while(i<length && (c=src[i])<0x80) {
+        dest[i++]=(uint8_t)c;
+    }
+    return i;
+}
+
+/**
+ * Returns a bit set with bit i set for each of the 16 bytes p[i]==b.
+ * @internal
+ */
+static inline uint32_t
+usimd_matchBytes16(const uint8_t *p, uint8_t b) {
+#if U_SIMD_SSE2
+    return (uint32_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi8((char)b)));
+#else
+    uint32_t mask=0;
+    for(int32_t i=0; i<16; ++i) {
+        if(p[i]==b) {
+            mask|=(uint32_t)1<<i;
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+ * Returns the index of the lowest set bit in mask, which must not be 0.
+ * @internal
+ */
+static inline int32_t
+usimd_lowestBitIndex(uint32_t mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int32_t i=0;
+    while((mask&1)==0) {
+        mask>>=1;
+        ++i;
+    }
+    return i;
+#endif
+}
+
+/**
+ * Returns the index of the highest set bit in mask, which must not be 0.
+ * @internal
+ */
+static inline int32_t
+usimd_highestBitIndex(uint32_t mask) {
+#if defined(__GNUC__)
+    return 31-__builtin_clz(mask);
+#else
+    int32_t i=31;
+    while((mask&0x80000000)==0) {
+        mask<<=1;
+        --i;
+    }
+    return i;
+#endif
+}
+
+/**
+ * Maximum number of ranges of ASCII characters in a USimdASCIISet.
+ * Enough for typical sets like [:White_Space:], [a-zA-Z0-9_] or [^\n].
+ * usimd_asciiSetContains8/16() test exactly this many ranges.
+ * @internal
+ */
+#define USIMD_MAX_ASCII_RANGES 4
+
+/**
+ * The ASCII characters of a set, as ranges of code points,
+ * for testing 16 bytes or 8 UChars at a time whether they are in the set.
+ * Without SSE2, or with more than USIMD_MAX_ASCII_RANGES ranges,
+ * rangeCount is negative and the span helpers must not be called.
+ * Unused ranges are empty, so that the vector code always tests
+ * all USIMD_MAX_ASCII_RANGES ranges without branches.
+ * @internal
+ */
+typedef struct USimdASCIISet {
+    int32_t rangeCount;
+#if U_SIMD_SSE2
+    // Per range, the offset and limit for the signed range check
+    // in usimd_asciiSetContains8/16(), copied into all vector lanes.
+    uint8_t offsets8[USIMD_MAX_ASCII_RANGES][16];
+    uint8_t limits8[USIMD_MAX_ASCII_RANGES][16];
+    uint16_t offsets16[USIMD_MAX_ASCII_RANGES][8];
+    uint16_t limits16[USIMD_MAX_ASCII_RANGES][8];
+#endif
+} USimdASCIISet;
+
+/**
+ * Initializes the USimdASCIISet from one boolean per ASCII character.
+ * @internal
+ */
+static inline void
+usimd_initASCIISet(USimdASCIISet *set, const UBool contains[0x80]) {
+    int32_t count=0;
+    uprv_memset(set, 0, sizeof(*set));
+    for(int32_t c=0; c<0x80;) {
+        if(!contains[c]) {
+            ++c;
+            continue;
+        }
+        int32_t start=c;
+        while(c<0x80 && contains[c]) {
+            ++c;
+        }
+        if(count==USIMD_MAX_ASCII_RANGES) {
+            set->rangeCount=-1;
+            return;
+        }
+#if U_SIMD_SSE2
+        // c is in start..start+length-1 iff c+(0x80-start) is in -0x80..-0x80+length-1 (signed).
+        uprv_memset(set->offsets8[count], 0x80-start, 16);
+        uprv_memset(set->limits8[count], 0x80+(c-start), 16);
+        for(int32_t i=0; i<8; ++i) {
+            set->offsets16[count][i]=(uint16_t)(0x8000-start);
+            set->limits16[count][i]=(uint16_t)(0x8000+(c-start));
+        }
+#endif
+        ++count;
+    }
+#if U_SIMD_SSE2
+    // Empty ranges: The limit is the minimum signed value.
+    for(int32_t k=count; k<USIMD_MAX_ASCII_RANGES; ++k) {
+        uprv_memset(set->limits8[k], 0x80, 16);
+        for(int32_t i=0; i<8; ++i) {
+            set->limits16[k][i]=0x8000;
+        }
+    }
+    set->rangeCount=count;
+#else
+    set->rangeCount=-1;
+#endif
+}
+
+#if U_SIMD_SSE2
+// Tests whether the bytes in v are in range k of the set; only ASCII bytes can be.
+static inline __m128i
+usimd_asciiRangeContains8(__m128i v, const USimdASCIISet *set, int32_t k) {
+    return _mm_cmplt_epi8(_mm_add_epi8(v, _mm_loadu_si128((const __m128i *)set->offsets8[k])),
+                          _mm_loadu_si128((const __m128i *)set->limits8[k]));
+}
+
+static inline __m128i
+usimd_asciiSetContains8(__m128i v, const USimdASCIISet *set) {
+    return _mm_or_si128(
+        _mm_or_si128(usimd_asciiRangeContains8(v, set, 0), usimd_asciiRangeContains8(v, set, 1)),
+        _mm_or_si128(usimd_asciiRangeContains8(v, set, 2), usimd_asciiRangeContains8(v, set, 3)));
+}
+
+// Same as usimd_asciiRangeContains8() for 16-bit units.
+static inline __m128i
+usimd_asciiRangeContains16(__m128i v, const USimdASCIISet *set, int32_t k) {
+    return _mm_cmplt_epi16(_mm_add_epi16(v, _mm_loadu_si128((const __m128i *)set->offsets16[k])),
+                           _mm_loadu_si128((const __m128i *)set->limits16[k]));
+}
+
+static inline __m128i
+usimd_asciiSetContains16(__m128i v, const USimdASCIISet *set) {
+    return _mm_or_si128(
+        _mm_or_si128(usimd_asciiRangeContains16(v, set, 0), usimd_asciiRangeContains16(v, set, 1)),
+        _mm_or_si128(usimd_asciiRangeContains16(v, set, 2), usimd_asciiRangeContains16(v, set, 3)));
+}
+
+// Returns a 16-bit mask of the bytes that end a span of ASCII characters
+// which are contained (or not) in the set.
+static inline uint32_t
+usimd_asciiSpanStops8(const uint8_t *p, const USimdASCIISet *set, UBool contained) {
+    __m128i v=_mm_loadu_si128((const __m128i *)p);
+    __m128i in=usimd_asciiSetContains8(v, set);
+    if(contained) {
+        return ~(uint32_t)_mm_movemask_epi8(in)&0xffff;
+    } else {
+        // Stop at non-ASCII bytes (high bit set) and at set members.
+        return (uint32_t)_mm_movemask_epi8(_mm_or_si128(v, in));
+    }
+}
+
+// Same as usimd_asciiSpanStops8() for 8 UChars, with two mask bits per UChar.
+static inline uint32_t
+usimd_asciiSpanStops16(const UChar *p, const USimdASCIISet *set, UBool contained) {
+    __m128i v=_mm_loadu_si128((const __m128i *)p);
+    __m128i in=usimd_asciiSetContains16(v, set);
+    if(contained) {
+        return ~(uint32_t)_mm_movemask_epi8(in)&0xffff;
+    } else {
+        __m128i ascii=_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xff80)),
+                                      _mm_setzero_si128());
+        return ~(uint32_t)_mm_movemask_epi8(_mm_andnot_si128(in, ascii))&0xffff;
+    }
+}
+#endif
+
+/**
+ * Returns the number of leading bytes in s[0..length[ that are ASCII and
+ * contained in the set (contained=TRUE) or not contained in it (contained=FALSE).
+ * Tests only whole blocks of 16 bytes: If the span reaches into the last
+ * length%16 bytes, then the result is shorter, and the caller continues
+ * with its regular loop.
+ * set->rangeCount must not be negative.
+ * @internal
+ */
+static inline int32_t
+usimd_u8ASCIISpan(const uint8_t *s, int32_t length, const USimdASCIISet *set, UBool contained) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    while((length-i)>=16) {
+        uint32_t stops=usimd_asciiSpanStops8(s+i, set, contained);
+        if(stops!=0) {
+            return i+usimd_lowestBitIndex(stops);
+        }
+        i+=16;
+    }
+#else
+    (void)s;
+    (void)length;
+    (void)set;
+    (void)contained;
+#endif
+    return i;
+}
+
+/**
+ * Returns the number of trailing bytes in s[0..length[ that are ASCII and
+ * contained in the set (contained=TRUE) or not contained in it (contained=FALSE).
+ * Tests only whole blocks, like usimd_u8ASCIISpan().
+ * set->rangeCount must not be negative.
+ * @internal
+ */
+static inline int32_t
+usimd_u8ASCIISpanBack(const uint8_t *s, int32_t length, const USimdASCIISet *set, UBool contained) {
+    int32_t i=length;
+#if U_SIMD_SSE2
+    while(i>=16) {
+        uint32_t stops=usimd_asciiSpanStops8(s+i-16, set, contained);
+        if(stops!=0) {
+            return length-(i-16+usimd_highestBitIndex(stops)+1);
+        }
+        i-=16;
+    }
+#else
+    (void)s;
+    (void)set;
+    (void)contained;
+#endif
+    return length-i;
+}
+
+/**
+ * Returns the number of leading UChars in s[0..length[ that are ASCII and
+ * contained in the set (contained=TRUE) or not contained in it (contained=FALSE).
+ * Tests only whole blocks, like usimd_u8ASCIISpan().
+ * set->rangeCount must not be negative.
+ * @internal
+ */
+static inline int32_t
+usimd_u16ASCIISpan(const UChar *s, int32_t length, const USimdASCIISet *set, UBool contained) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    while((length-i)>=8) {
+        uint32_t stops=usimd_asciiSpanStops16(s+i, set, contained);
+        if(stops!=0) {
+            return i+usimd_lowestBitIndex(stops)/2;
+        }
+        i+=8;
+    }
+#else
+    (void)s;
+    (void)length;
+    (void)set;
+    (void)contained;
+#endif
+    return i;
+}
+
+/**
+ * Returns the number of trailing UChars in s[0..length[ that are ASCII and
+ * contained in the set (contained=TRUE) or not contained in it (contained=FALSE).
+ * Tests only whole blocks, like usimd_u8ASCIISpan().
+ * set->rangeCount must not be negative.
+ * @internal
+ */
+static inline int32_t
+usimd_u16ASCIISpanBack(const UChar *s, int32_t length, const USimdASCIISet *set, UBool contained) {
+    int32_t i=length;
+#if U_SIMD_SSE2
+    while(i>=8) {
+        uint32_t stops=usimd_asciiSpanStops16(s+i-8, set, contained);
+        if(stops!=0) {
+            return length-(i-8+usimd_highestBitIndex(stops)/2+1);
+        }
+        i-=8;
+    }
+#else
+    (void)s;
+    (void)set;
+    (void)contained;
+#endif
+    return length-i;
+}
+
+#endif
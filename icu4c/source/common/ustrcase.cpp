@@ -35,6 +35,7 @@
 #include "ucasemap_imp.h"
 #include "ustr_imp.h"
 #include "uassert.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -163,6 +164,23 @@ appendUnchanged(UChar *dest, int32_t destIndex, int32_t destCapacity,
     return appendNonEmptyUnchanged(dest, destIndex, destCapacity, s, length, options, edits);
 }
 
+/**
+ * Appends the ASCII text s[0..length[ with the letters first..first+25 case-mapped,
+ * see usimd_u16MapASCIILetters().
+ * Only for when there are no Edits and no U_OMIT_UNCHANGED_TEXT.
+ */
+inline int32_t
+appendMappedASCII(UChar *dest, int32_t destIndex, int32_t destCapacity,
+                  const UChar *s, int32_t length, UChar first) {
+    if(length>(INT32_MAX-destIndex)) {
+        return -1;  // integer overflow
+    }
+    if((destIndex+length)<=destCapacity) {
+        usimd_u16MapASCIILetters(dest+destIndex, s, length, first);
+    }
+    return destIndex + length;
+}
+
 UChar32 U_CALLCONV
 utf16_caseContextIterator(void *context, int8_t dir) {
     UCaseContext *csc=(UCaseContext *)context;
@@ -212,7 +230,11 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    // Without Edits and with all text written, whole ASCII runs
+    // can be mapped in blocks.
+    UBool mapASCIIBlocks = latinToLower == LatinCase::TO_LOWER_NORMAL &&
+        edits == nullptr && (options & U_OMIT_UNCHANGED_TEXT) == 0;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
@@ -226,12 +248,33 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
                 int8_t d = latinToLower[lead];
                 if (d == LatinCase::EXC) { break; }
                 ++srcIndex;
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    if (lead < 0x80) {
+                        srcIndex += usimd_u16UnmappedPrefix(src + srcIndex, srcLimit - srcIndex, 0x41);
+                    }
+                    continue;
+                }
+                if (mapASCIIBlocks && lead < 0x80) {
+                    int32_t start = srcIndex - 1;
+                    srcIndex += usimd_u16PrefixBelow(src + srcIndex, srcLimit - srcIndex, 0x80);
+                    destIndex = appendUnchanged(dest, destIndex, destCapacity,
+                                                src + prev, start - prev, options, edits);
+                    if (destIndex >= 0) {
+                        destIndex = appendMappedASCII(dest, destIndex, destCapacity,
+                                                      src + start, srcIndex - start, 0x41);
+                    }
+                    if (destIndex < 0) {
+                        errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+                        return 0;
+                    }
+                    prev = srcIndex;
+                    continue;
+                }
                 delta = d;
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -307,7 +350,11 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    // Without Edits and with all text written, whole ASCII runs
+    // can be mapped in blocks.
+    UBool mapASCIIBlocks = latinToUpper == LatinCase::TO_UPPER_NORMAL &&
+        edits == nullptr && (options & U_OMIT_UNCHANGED_TEXT) == 0;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = 0;
     int32_t srcIndex = 0;
@@ -321,12 +368,33 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
                 int8_t d = latinToUpper[lead];
                 if (d == LatinCase::EXC) { break; }
                 ++srcIndex;
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    if (lead < 0x80) {
+                        srcIndex += usimd_u16UnmappedPrefix(src + srcIndex, srcLength - srcIndex, 0x61);
+                    }
+                    continue;
+                }
+                if (mapASCIIBlocks && lead < 0x80) {
+                    int32_t start = srcIndex - 1;
+                    srcIndex += usimd_u16PrefixBelow(src + srcIndex, srcLength - srcIndex, 0x80);
+                    destIndex = appendUnchanged(dest, destIndex, destCapacity,
+                                                src + prev, start - prev, options, edits);
+                    if (destIndex >= 0) {
+                        destIndex = appendMappedASCII(dest, destIndex, destCapacity,
+                                                      src + start, srcIndex - start, 0x61);
+                    }
+                    if (destIndex < 0) {
+                        errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+                        return 0;
+                    }
+                    prev = srcIndex;
+                    continue;
+                }
                 delta = d;
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -1759,6 +1827,31 @@ u_strcmpFold(const UChar *s1, int32_t length1,
              const UChar *s2, int32_t length2,
              uint32_t options,
              UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    /*
+     * Skip the common prefix of ASCII characters that case-fold to the same ones.
+     * With the Turkic option, I does not fold to i, so only skip identical ones.
+     * If the next characters are both ASCII, then they differ after folding,
+     * which yields the result.
+     */
+    UBool foldASCII=(options&U_FOLD_CASE_EXCLUDE_SPECIAL_I)==0;
+    // u_strncasecmp() passes n as both lengths; either string may end at a NUL before that.
+    int32_t prefix=usimd_asciiEqualPrefix(s1, length1, s2, length2, foldASCII,
+                                          (options&_STRNCMP_STYLE)!=0);
+    if(prefix>0) {
+        s1+=prefix;
+        s2+=prefix;
+        if(length1>=0) { length1-=prefix; }
+        if(length2>=0) { length2-=prefix; }
+    }
+    if(foldASCII && length1!=0 && length2!=0) {
+        UChar32 c1=*s1, c2=*s2;
+        if(0<c1 && c1<=0x7f && 0<c2 && c2<=0x7f) {
+            return usimd_asciiFoldCase(c1)-usimd_asciiFoldCase(c2);
+        }
+    }
     return _cmpFold(s1, length1, s2, length2, options, NULL, NULL, pErrorCode);
 }
 
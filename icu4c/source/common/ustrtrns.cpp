@@ -35,6 +35,7 @@
 #include "cmemory.h"
 #include "ustr_imp.h"
 #include "uassert.h"
+#include "usimd.h"
 
 U_CAPI UChar* U_EXPORT2 
 u_strFromUTF32WithSub(UChar *dest,
@@ -403,6 +404,15 @@ u_strFromUTF8WithSub(UChar *dest,
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
+                    if(count > 1 && U8_IS_SINGLE(src[i])) {
+                        // Widen a run of ASCII bytes in bulk.
+                        // Each of them takes one byte and one UChar,
+                        // so count remains valid.
+                        int32_t n = usimd_widenASCII(pDest, (const uint8_t *)src + i, count - 1);
+                        pDest += n;
+                        i += n;
+                        count -= n;
+                    }
                 } else {
                     uint8_t __t1, __t2;
                     if( /* handle U+0800..U+FFFF inline */
@@ -491,7 +501,9 @@ u_strFromUTF8WithSub(UChar *dest,
             // modified copy of U8_NEXT()
             c = (uint8_t)src[i++];
             if(U8_IS_SINGLE(c)) {
-                ++reqLength;
+                int32_t n = usimd_asciiPrefixLength((const uint8_t *)src + i, srcLength - i);
+                reqLength += 1 + n;
+                i += n;
             } else {
                 uint8_t __t1, __t2;
                 if( /* handle U+0800..U+FFFF inline */
@@ -921,6 +933,17 @@ u_strToUTF8WithSub(char *dest,
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
                     *pDest++ = (uint8_t)ch;
+                    if(count > 1 && *pSrc <= 0x7f) {
+                        /*
+                         * Narrow a run of ASCII UChars in bulk.
+                         * Each of them takes one UChar and one byte,
+                         * so count remains valid.
+                         */
+                        int32_t n = usimd_narrowASCII(pDest, pSrc, count - 1);
+                        pDest += n;
+                        pSrc += n;
+                        count -= n;
+                    }
                 } else if(ch <= 0x7ff) {
                     *pDest++=(uint8_t)((ch>>6)|0xc0);
                     *pDest++=(uint8_t)((ch&0x3f)|0x80);
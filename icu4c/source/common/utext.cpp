@@ -27,7 +27,10 @@
 #include "ustr_imp.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "umapfile.h"
+#include "umutex.h"
 #include "uassert.h"
+#include "usimd.h"
 #include "putilimp.h"
 
 U_NAMESPACE_USE
@@ -847,13 +850,33 @@ U_CDECL_END
 //------------------------------------------------------------------------------
 
 // Chunk size.
-//     Must be less than 85 (256/3), because of byte mapping from UChar indexes to native indexes.
+//     Can be set at build time with -DU_UTF8_TEXT_CHUNK_SIZE=n.
+//     Larger chunks mean fewer chunk switches during iteration and more text with
+//     native indexing, at the cost of about 10 bytes per chunk UChar in each of the
+//     two buffers in the UText's extra space.
+//     Must be less than 0x5555 (0x10000/3), because of the 16-bit mapping from UChar indexes
+//     to native indexes.
 //     Worst case is three native bytes to one UChar.  (Supplemenaries are 4 native bytes
 //     to two UChars.)
 //     The longest illegal byte sequence treated as a single error (and converted to U+FFFD)
 //     is a three-byte sequence (truncated four-byte sequence).
 //
-enum { UTF8_TEXT_CHUNK_SIZE=32 };
+#ifndef U_UTF8_TEXT_CHUNK_SIZE
+#   define U_UTF8_TEXT_CHUNK_SIZE 128
+#endif
+enum { UTF8_TEXT_CHUNK_SIZE=U_UTF8_TEXT_CHUNK_SIZE };
+static_assert(UTF8_TEXT_CHUNK_SIZE >= 16 && UTF8_TEXT_CHUNK_SIZE <= 0x5000,
+              "U_UTF8_TEXT_CHUNK_SIZE out of range");
+
+// Short chunk size.
+//     Only iteration that continues off the end (or start) of the current chunk
+//     fills whole chunks.  A random access fills only this many UChars,
+//     because it often uses only a few characters.
+//     When filling forward, a chunk with some non-ASCII text and at least this
+//     many UChars ends before the next ASCII character, so that the next chunk
+//     begins with an ASCII part with native indexing.
+//
+enum { UTF8_TEXT_SHORT_CHUNK_SIZE=UTF8_TEXT_CHUNK_SIZE<32 ? UTF8_TEXT_CHUNK_SIZE : 32 };
 
 //
 // UTF8Buf  Two of these structs will be set up in the UText's extra allocated space.
@@ -868,6 +891,11 @@ enum { UTF8_TEXT_CHUNK_SIZE=32 };
 //     the last character added being a supplementary, and thus requiring a surrogate
 //     pair.  Doing this is simpler than checking for the edge case.
 //
+//     The leading ASCII part of a buffer, up to bufNILimit, uses native indexing:
+//     native and UTF-16 offsets from the start of the chunk are the same.
+//     In a pure-ASCII buffer that is the whole chunk.  The maps are not used for
+//     positions inside that part, and filling forward does not set them there.
+//
 
 struct UTF8Buf {
     int32_t   bufNativeStart;                        // Native index of first char in UChar buf
@@ -886,16 +914,33 @@ struct UTF8Buf {
                                                      //   because of the way indexing works when the array is
                                                      //   filled backwards during a reverse iteration.  Thus,
                                                      //   the additional extra size.
-    uint8_t   mapToNative[UTF8_TEXT_CHUNK_SIZE+4];   // map UChar index in buf to
+    uint16_t  mapToNative[UTF8_TEXT_CHUNK_SIZE+4];   // map UChar index in buf to
                                                      //  native offset from bufNativeStart.
                                                      //  Requires two extra slots,
                                                      //    one for a supplementary starting in the last normal position,
                                                      //    and one for an entry for the buffer limit position.
-    uint8_t   mapToUChars[UTF8_TEXT_CHUNK_SIZE*3+6]; // Map native offset from bufNativeStart to
+    uint16_t  mapToUChars[UTF8_TEXT_CHUNK_SIZE*3+6]; // Map native offset from bufNativeStart to
                                                      //   correspoding offset in filled part of buf.
     int32_t   align;
 };
 
+//
+//   utf8BufOffset
+//
+//        Map a native index inside of a buffer to the offset in its chunk.
+//
+static inline int32_t
+utf8BufOffset(const UTF8Buf *u8b, int32_t ix) {
+    int32_t offset = ix - u8b->bufNativeStart;
+    if (offset <= u8b->bufNILimit) {
+        // Native indexing.
+        return offset;
+    }
+    int32_t mapIndex = ix - u8b->toUCharsMapStart;
+    U_ASSERT(mapIndex>=0 && mapIndex<UPRV_LENGTHOF(UTF8Buf::mapToUChars));
+    return u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+}
+
 U_CDECL_BEGIN
 
 //
@@ -942,7 +987,6 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     UTF8Buf *u8b = NULL;
     int32_t  length = ut->b;         // Length of original utf-8
     int32_t  ix= (int32_t)index;     // Requested index, trimmed to 32 bits.
-    int32_t  mapIndex = 0;
     if (index<0) {
         ix=0;
     } else if (index > 0x7fffffff) {
@@ -1033,9 +1077,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
             // Requested index is in this buffer.
             u8b = (UTF8Buf *)ut->p;   // the current buffer
-            mapIndex = ix - u8b->toUCharsMapStart;
-            U_ASSERT(mapIndex < (int32_t)sizeof(UTF8Buf::mapToUChars));
-            ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+            ut->chunkOffset = utf8BufOffset(u8b, ix);
             return TRUE;
 
         }
@@ -1098,8 +1140,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     // Requested index is in this buffer.
     //   Set the utf16 buffer index.
     u8b = (UTF8Buf *)ut->p;
-    mapIndex = ix - u8b->toUCharsMapStart;
-    ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+    ut->chunkOffset = utf8BufOffset(u8b, ix);
     if (ut->chunkOffset==0) {
         // This occurs when the first character in the text is
         //   a multi-byte UTF-8 char, and the requested index is to
@@ -1128,14 +1169,9 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         ut->nativeIndexingLimit = u8b->bufNILimit;
 
         // Index into the (now current) chunk
-        // Use the map to set the chunk index.  It's more trouble than it's worth
-        //    to check whether native indexing can be used.
         U_ASSERT(ix>=u8b->bufNativeStart);
         U_ASSERT(ix<=u8b->bufNativeLimit);
-        mapIndex = ix - u8b->toUCharsMapStart;
-        U_ASSERT(mapIndex>=0);
-        U_ASSERT(mapIndex<(int32_t)sizeof(u8b->mapToUChars));
-        ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+        ut->chunkOffset = utf8BufOffset(u8b, ix);
 
         return TRUE;
     }
@@ -1190,6 +1226,12 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
 fillForward:
     {
+        int32_t fillSize = UTF8_TEXT_CHUNK_SIZE;
+        if (ix != ut->chunkNativeLimit) {
+            // Random access.
+            fillSize = UTF8_TEXT_SHORT_CHUNK_SIZE;
+        }
+
         // Move the incoming index to a code point boundary.
         U8_SET_CP_START(s8, 0, ix);
 
@@ -1207,23 +1249,38 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
             nulTerminated = TRUE;
         }
 
-        UChar   *buf = u8b_swap->buf;
-        uint8_t *mapToNative  = u8b_swap->mapToNative;
-        uint8_t *mapToUChars  = u8b_swap->mapToUChars;
-        int32_t  destIx       = 0;
-        int32_t  srcIx        = ix;
-        UBool    seenNonAscii = FALSE;
-        UChar32  c = 0;
+        UChar    *buf = u8b_swap->buf;
+        uint16_t *mapToNative  = u8b_swap->mapToNative;
+        uint16_t *mapToUChars  = u8b_swap->mapToUChars;
+        int32_t   destIx       = 0;
+        int32_t   srcIx        = ix;
+        UBool     seenNonAscii = FALSE;
+        UChar32   c = 0;
+
+        // Widen the leading ASCII bytes a block at a time.
+        //   They are in the native indexing part of the buffer and need no map entries.
+        //   Not for NUL-terminated strings, where a zero byte ends the text.
+        if (!nulTerminated) {
+            int32_t maxLength = strLen - ix;
+            if (maxLength > fillSize) {
+                maxLength = fillSize;
+            }
+            destIx = usimd_widenASCII(buf, s8 + ix, maxLength);
+            srcIx += destIx;
+        }
 
-        // Fill the chunk buffer and mapping arrays.
-        while (destIx<UTF8_TEXT_CHUNK_SIZE) {
+        // Fill the rest of the chunk buffer and the mapping arrays.
+        while (destIx<fillSize && srcIx<strLen) {
             c = s8[srcIx];
             if (c>0 && c<0x80) {
                 // Special case ASCII range for speed.
                 //   zero is excluded to simplify bounds checking.
+                if (seenNonAscii && destIx>=UTF8_TEXT_SHORT_CHUNK_SIZE) {
+                    break;
+                }
                 buf[destIx] = (UChar)c;
-                mapToNative[destIx]    = (uint8_t)(srcIx - ix);
-                mapToUChars[srcIx-ix]  = (uint8_t)destIx;
+                mapToNative[destIx]    = (uint16_t)(srcIx - ix);
+                mapToUChars[srcIx-ix]  = (uint16_t)destIx;
                 srcIx++;
                 destIx++;
             } else {
@@ -1244,23 +1301,19 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
                 U16_APPEND_UNSAFE(buf, destIx, c);
                 do {
-                    mapToNative[dIx++] = (uint8_t)(cIx - ix);
+                    mapToNative[dIx++] = (uint16_t)(cIx - ix);
                 } while (dIx < destIx);
 
                 do {
-                    mapToUChars[cIx++ - ix] = (uint8_t)dIxSaved;
+                    mapToUChars[cIx++ - ix] = (uint16_t)dIxSaved;
                 } while (cIx < srcIx);
             }
-            if (srcIx>=strLen) {
-                break;
-            }
-
         }
 
         //  store Native <--> Chunk Map entries for the end of the buffer.
         //    There is no actual character here, but the index position is valid.
-        mapToNative[destIx]     = (uint8_t)(srcIx - ix);
-        mapToUChars[srcIx - ix] = (uint8_t)destIx;
+        mapToNative[destIx]     = (uint16_t)(srcIx - ix);
+        mapToUChars[srcIx - ix] = (uint16_t)destIx;
 
         //  fill in Buffer descriptor
         u8b_swap->bufNativeStart     = ix;
@@ -1297,6 +1350,12 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
 fillReverse:
     {
+        int32_t fillSize = UTF8_TEXT_CHUNK_SIZE;
+        if (ix != ut->chunkNativeStart) {
+            // Random access.
+            fillSize = UTF8_TEXT_SHORT_CHUNK_SIZE;
+        }
+
         // Move the incoming index to a code point boundary.
         // Can only do this if the incoming index is somewhere in the interior of the string.
         //   If index is at the end, there is no character there to look at.
@@ -1315,10 +1374,10 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         ut->q = ut->p;
         ut->p = u8b_swap;
 
-        UChar   *buf = u8b_swap->buf;
-        uint8_t *mapToNative = u8b_swap->mapToNative;
-        uint8_t *mapToUChars = u8b_swap->mapToUChars;
-        int32_t  toUCharsMapStart = ix - sizeof(UTF8Buf::mapToUChars) + 1;
+        UChar    *buf = u8b_swap->buf;
+        uint16_t *mapToNative = u8b_swap->mapToNative;
+        uint16_t *mapToUChars = u8b_swap->mapToUChars;
+        int32_t   toUCharsMapStart = ix - UPRV_LENGTHOF(UTF8Buf::mapToUChars) + 1;
         // Note that toUCharsMapStart can be negative. Happens when the remaining
         // text from current position to the beginning is less than the buffer size.
         // + 1 because mapToUChars must have a slot at the end for the bufNativeLimit entry.
@@ -1326,6 +1385,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
                                                     //   at end of buffer to leave room
                                                     //   for a surrogate pair at the
                                                     //   buffer start.
+        int32_t  destMin = destIx - fillSize;       // At least 2.
         int32_t  srcIx  = ix;
         int32_t  bufNILimit = destIx;
         UChar32   c;
@@ -1333,13 +1393,32 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         // Map to/from Native Indexes, fill in for the position at the end of
         //   the buffer.
         //
-        mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
-        mapToUChars[srcIx - toUCharsMapStart] = (uint8_t)destIx;
+        mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
+        mapToUChars[srcIx - toUCharsMapStart] = (uint16_t)destIx;
+
+        // If the whole chunk is ASCII, then widen it a block at a time.
+        //   It all uses native indexing and needs no further map entries,
+        //   and the loop below finds nothing left to do.
+        {
+            int32_t asciiStart = ix - fillSize;
+            if (asciiStart < 0) {
+                asciiStart = 0;
+            }
+            int32_t i = ix;
+            while (i > asciiStart && s8[i-1] < 0x80) {
+                --i;
+            }
+            if (i == asciiStart) {
+                destIx -= ix - i;
+                usimd_widenASCII(buf + destIx, s8 + i, ix - i);
+                srcIx = i;
+            }
+        }
 
         // Fill the chunk buffer
         // Work backwards, filling from the end of the buffer towards the front.
         //
-        while (destIx>2 && (srcIx - toUCharsMapStart > 5) && (srcIx > 0)) {
+        while (destIx>destMin && (srcIx - toUCharsMapStart > 5) && (srcIx > 0)) {
             srcIx--;
             destIx--;
 
@@ -1349,8 +1428,8 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
                 // Special case ASCII range for speed.
                 buf[destIx] = (UChar)c;
                 U_ASSERT(toUCharsMapStart <= srcIx);
-                mapToUChars[srcIx - toUCharsMapStart] = (uint8_t)destIx;
-                mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                mapToUChars[srcIx - toUCharsMapStart] = (uint16_t)destIx;
+                mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
             } else {
                 // General case, handle everything non-ASCII.
 
@@ -1366,17 +1445,17 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
                 // Store the character in UTF-16 buffer.
                 if (c<0x10000) {
                     buf[destIx] = (UChar)c;
-                    mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
                 } else {
                     buf[destIx]         = U16_TRAIL(c);
-                    mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
                     buf[--destIx]       = U16_LEAD(c);
-                    mapToNative[destIx] = (uint8_t)(srcIx - toUCharsMapStart);
+                    mapToNative[destIx] = (uint16_t)(srcIx - toUCharsMapStart);
                 }
 
                 // Fill in the map from native indexes to UChars buf index.
                 do {
-                    mapToUChars[sIx-- - toUCharsMapStart] = (uint8_t)destIx;
+                    mapToUChars[sIx-- - toUCharsMapStart] = (uint16_t)destIx;
                 } while (sIx >= srcIx);
                 U_ASSERT(toUCharsMapStart <= (srcIx+1));
 
@@ -1553,7 +1632,7 @@ utf8TextMapIndexToUTF16(const UText *ut, int64_t index64) {
     U_ASSERT(index>=ut->chunkNativeStart+ut->nativeIndexingLimit);
     U_ASSERT(index<=ut->chunkNativeLimit);
     int32_t mapIndex = index - u8b->toUCharsMapStart;
-    U_ASSERT(mapIndex < (int32_t)sizeof(UTF8Buf::mapToUChars));
+    U_ASSERT(mapIndex < UPRV_LENGTHOF(UTF8Buf::mapToUChars));
     int32_t offset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
     U_ASSERT(offset>=0 && offset<=ut->chunkLength);
     return offset;
@@ -1660,6 +1739,585 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
 
 
 
+//------------------------------------------------------------------------------
+//
+//     UText implementation for UTF-8 and UTF-16 text files (read-only)
+//
+//         The file is mapped read-only with uprv_mapWholeFile() and converted
+//         to UTF-16 one chunk at a time, only when the chunk is accessed.
+//         UTF-16 files in the platform byte order are accessed directly.
+//         While iterating forward, the pages of text far behind the current
+//         position are released, so that sequential processing of a large
+//         file does not accumulate all of it in memory.
+//
+//         Native indexes are byte offsets for UTF-8,
+//         and code unit indexes (half of the byte offsets) for UTF-16.
+//
+//         Use of UText data members:
+//              context    pointer to the file contents
+//              utext.a    native length
+//              utext.b    encoding form, FILE_TEXT_UTF8 etc.
+//              utext.c    TRUE if UTF-16 in the platform byte order is accessed directly
+//              utext.r    pointer to the FileTextMapping, shared among clones
+//              utext.p    pointer to the current buffer
+//              utext.q    pointer to the other buffer.
+//
+//------------------------------------------------------------------------------
+
+// Chunk size.
+//     Can be set at build time with -DU_FILE_TEXT_CHUNK_SIZE=n.
+//     Direct UTF-16 access uses chunks of 256 times this many UChars.
+//
+#ifndef U_FILE_TEXT_CHUNK_SIZE
+#   define U_FILE_TEXT_CHUNK_SIZE 256
+#endif
+enum {
+    FILE_TEXT_CHUNK_SIZE=U_FILE_TEXT_CHUNK_SIZE,
+    // Size of a random-access fill. See UTF8_TEXT_SHORT_CHUNK_SIZE.
+    FILE_TEXT_SHORT_CHUNK_SIZE=FILE_TEXT_CHUNK_SIZE<32 ? FILE_TEXT_CHUNK_SIZE : 32,
+    FILE_TEXT_DIRECT_CHUNK_SIZE=FILE_TEXT_CHUNK_SIZE*256
+};
+static_assert(FILE_TEXT_CHUNK_SIZE >= 16 && FILE_TEXT_CHUNK_SIZE <= 0x5000,
+              "U_FILE_TEXT_CHUNK_SIZE out of range");
+
+// Forward iteration releases the pages that are more than this many bytes
+// behind the current position, in steps of the same size.
+static const int64_t FILE_TEXT_RELEASE_DISTANCE = 0x1000000;
+
+enum {
+    FILE_TEXT_UTF8,
+    FILE_TEXT_UTF16BE,
+    FILE_TEXT_UTF16LE
+};
+
+//
+// FileTextMapping  The mapped file, shared by a UText and its clones.
+//
+struct FileTextMapping {
+    UMappedFile file;
+    u_atomic_int32_t refCount;
+};
+
+//
+// FileTextBuf  Two of these are set up in the UText's extra space.
+//              A buffer is always filled from its start.
+//              As in UTF8Buf, the leading ASCII part up to nativeIndexingLimit
+//              does not use (or set) the maps.
+//              UTF-16 buffers use native indexing throughout.
+//
+struct FileTextBuf {
+    int64_t   nativeStart;                            // Native index of buf[0].
+    int64_t   nativeLimit;                            // Native index following the last char in buf.
+    int32_t   length;                                 // Number of UChars in buf.
+    int32_t   nativeIndexingLimit;                    // Limit of the native indexing part of buf.
+    UChar     buf[FILE_TEXT_CHUNK_SIZE+2];            // One extra position for a surrogate pair at the end,
+                                                      //   and one for the mapToNative entry of the limit.
+    uint16_t  mapToNative[FILE_TEXT_CHUNK_SIZE+2];    // Map UChar offset to native offset from nativeStart.
+    uint16_t  mapToUChars[FILE_TEXT_CHUNK_SIZE*3+6];  // Map native offset from nativeStart to UChar offset.
+};
+
+struct FileTextExtra {
+    int64_t     releaseLimit;   // Byte offset up to which pages have been released.
+    FileTextBuf bufs[2];
+};
+
+static inline int32_t
+fileTextBufOffset(const FileTextBuf *b, int64_t ix) {
+    int32_t offset = (int32_t)(ix - b->nativeStart);
+    if (offset <= b->nativeIndexingLimit) {
+        return offset;
+    }
+    U_ASSERT(offset < UPRV_LENGTHOF(FileTextBuf::mapToUChars));
+    return b->mapToUChars[offset];
+}
+
+static inline UChar
+fileTextUnitAt(const UText *ut, int64_t i) {
+    const uint8_t *p = (const uint8_t *)ut->context + 2 * i;
+    if (ut->b == FILE_TEXT_UTF16BE) {
+        return (UChar)((p[0] << 8) | p[1]);
+    } else {
+        return (UChar)((p[1] << 8) | p[0]);
+    }
+}
+
+// Is i the index of the trail surrogate of a pair?
+static inline UBool
+fileTextIsPairTrail(const UText *ut, int64_t i) {
+    return 0 < i && i < ut->a &&
+        U16_IS_TRAIL(fileTextUnitAt(ut, i)) && U16_IS_LEAD(fileTextUnitAt(ut, i - 1));
+}
+
+// Move a UTF-8 index back to the start of its code point.
+static int64_t
+fileTextUTF8CPStart(const UText *ut, int64_t ix) {
+    if (ix <= 0 || ix >= ut->a) {
+        return ix;
+    }
+    const uint8_t *s8 = (const uint8_t *)ut->context;
+    if (!U8_IS_TRAIL(s8[ix])) {
+        return ix;
+    }
+    int64_t windowStart = ix >= 3 ? ix - 3 : 0;
+    int32_t i = (int32_t)(ix - windowStart);
+    U8_SET_CP_START(s8 + windowStart, 0, i);
+    return windowStart + i;
+}
+
+//
+// Convert UTF-8 from native index start, but not more than srcLength bytes,
+// and stop once the buffer has capacity or more UChars.
+// When a forward fill that contains non-ASCII text has at least FILE_TEXT_SHORT_CHUNK_SIZE
+// UChars, it stops before the next ASCII character.
+//
+static void
+fileTextFillUTF8(const UText *ut, FileTextBuf *b, int64_t start, int32_t srcLength,
+                 int32_t capacity, UBool stopBeforeASCII) {
+    const uint8_t *src = (const uint8_t *)ut->context + start;
+    int32_t srcIx = usimd_widenASCII(b->buf, src, srcLength < capacity ? srcLength : capacity);
+    int32_t destIx = srcIx;
+    b->nativeIndexingLimit = destIx;
+    while (destIx < capacity && srcIx < srcLength) {
+        int32_t cpStart = srcIx;
+        UChar32 c;
+        if (src[srcIx] <= 0x7f) {
+            if (stopBeforeASCII && destIx >= FILE_TEXT_SHORT_CHUNK_SIZE) {
+                break;
+            }
+            c = src[srcIx++];
+        } else {
+            U8_NEXT_OR_FFFD(src, srcIx, srcLength, c);
+        }
+        for (int32_t i = cpStart; i < srcIx; ++i) {
+            b->mapToUChars[i] = (uint16_t)destIx;
+        }
+        if (U_IS_BMP(c)) {
+            b->mapToNative[destIx] = (uint16_t)cpStart;
+            b->buf[destIx++] = (UChar)c;
+        } else {
+            b->mapToNative[destIx] = (uint16_t)cpStart;
+            b->buf[destIx++] = U16_LEAD(c);
+            b->mapToNative[destIx] = (uint16_t)cpStart;
+            b->buf[destIx++] = U16_TRAIL(c);
+        }
+    }
+    b->mapToNative[destIx] = (uint16_t)srcIx;
+    b->mapToUChars[srcIx] = (uint16_t)destIx;
+    b->nativeStart = start;
+    b->nativeLimit = start + srcIx;
+    b->length = destIx;
+}
+
+//
+// Fill a buffer with code units [start, limit[ of a UTF-16 file in the other byte order.
+//
+static void
+fileTextFillUTF16(const UText *ut, FileTextBuf *b, int64_t start, int64_t limit) {
+    int32_t length = (int32_t)(limit - start);
+    for (int32_t i = 0; i < length; ++i) {
+        b->buf[i] = fileTextUnitAt(ut, start + i);
+    }
+    b->nativeStart = start;
+    b->nativeLimit = limit;
+    b->length = length;
+    b->nativeIndexingLimit = length;
+}
+
+//
+// Fill a buffer with text starting at native index ix,
+// or ending at ix (at the end of the character that contains ix) if !forward.
+//
+static void
+fileTextFill(const UText *ut, FileTextBuf *b, int64_t ix, UBool forward, int32_t fillSize) {
+    int64_t length = ut->a;
+    if (ut->b == FILE_TEXT_UTF8) {
+        if (forward) {
+            int64_t start = fileTextUTF8CPStart(ut, ix);
+            // Enough bytes for fillSize UChars plus the last character.
+            int64_t srcLength = length - start;
+            if (srcLength > 3 * fillSize + 4) {
+                srcLength = 3 * fillSize + 4;
+            }
+            fileTextFillUTF8(ut, b, start, (int32_t)srcLength, fillSize, TRUE);
+        } else {
+            int64_t limit = fileTextUTF8CPStart(ut, ix);
+            if (limit < ix) {
+                // Include the whole character that contains ix.
+                const uint8_t *s8 = (const uint8_t *)ut->context + limit;
+                int32_t srcLength = length - limit < 4 ? (int32_t)(length - limit) : 4;
+                int32_t i = 0;
+                UChar32 c;
+                U8_NEXT_OR_FFFD(s8, i, srcLength, c);
+                (void)c;
+                limit += i;
+            }
+            // Each byte yields at most one UChar, except for one possible
+            // supplementary code point at the start.
+            int64_t start = fileTextUTF8CPStart(ut, limit > fillSize ? limit - fillSize : 0);
+            int32_t srcLength = (int32_t)(limit - start);
+            fileTextFillUTF8(ut, b, start, srcLength, srcLength, FALSE);
+        }
+    } else {
+        int64_t start, limit;
+        if (forward) {
+            start = ix;
+            if (fileTextIsPairTrail(ut, start)) {
+                --start;
+            }
+            limit = start + fillSize < length ? start + fillSize : length;
+            if (fileTextIsPairTrail(ut, limit)) {
+                ++limit;
+            }
+        } else {
+            limit = ix;
+            if (fileTextIsPairTrail(ut, limit)) {
+                ++limit;
+            }
+            start = limit > fillSize ? limit - fillSize : 0;
+            if (fileTextIsPairTrail(ut, start)) {
+                --start;
+            }
+        }
+        fileTextFillUTF16(ut, b, start, limit);
+    }
+}
+
+static void
+fileTextSetChunk(UText *ut, const FileTextBuf *b) {
+    ut->chunkContents = b->buf;
+    ut->chunkNativeStart = b->nativeStart;
+    ut->chunkNativeLimit = b->nativeLimit;
+    ut->chunkLength = b->length;
+    ut->nativeIndexingLimit = b->nativeIndexingLimit;
+}
+
+static void
+fileTextSwapBuffers(UText *ut) {
+    const void *b = ut->q;
+    ut->q = ut->p;
+    ut->p = b;
+    fileTextSetChunk(ut, (const FileTextBuf *)b);
+}
+
+//
+// Called when forward iteration moves on to native index ix.
+// Release the pages that are far enough behind ix.
+//
+static void
+fileTextMovedForward(UText *ut, int64_t ix) {
+    FileTextExtra *extra = (FileTextExtra *)ut->pExtra;
+    int64_t pos = ut->b == FILE_TEXT_UTF8 ? ix : 2 * ix;
+    if (pos < extra->releaseLimit) {
+        // Iteration started over from an earlier position.
+        extra->releaseLimit = pos;
+    } else if (pos - extra->releaseLimit >= 2 * FILE_TEXT_RELEASE_DISTANCE) {
+        int64_t limit = pos - FILE_TEXT_RELEASE_DISTANCE;
+        uprv_releaseWholeFileRange(&((FileTextMapping *)ut->r)->file, extra->releaseLimit, limit);
+        extra->releaseLimit = limit;
+    }
+}
+
+U_CDECL_BEGIN
+
+static int64_t U_CALLCONV
+fileTextLength(UText *ut) {
+    return ut->a;
+}
+
+static UBool U_CALLCONV
+fileTextAccessDirect(UText *ut, int64_t ix, UBool forward) {
+    int64_t length = ut->a;
+    if (forward ? (ut->chunkNativeStart <= ix && ix < ut->chunkNativeLimit) :
+                  (ut->chunkNativeStart < ix && ix <= ut->chunkNativeLimit)) {
+        ut->chunkOffset = (int32_t)(ix - ut->chunkNativeStart);
+        return TRUE;
+    }
+    if (forward && ix == ut->chunkNativeLimit) {
+        fileTextMovedForward(ut, ix);
+    }
+    // The chunk contains the code unit at k.
+    int64_t k = forward ? ix : ix - 1;
+    if (k >= length) {
+        k = length - 1;
+    }
+    if (k < 0) {
+        k = 0;
+    }
+    int64_t start = k - k % FILE_TEXT_DIRECT_CHUNK_SIZE;
+    int64_t limit = start + FILE_TEXT_DIRECT_CHUNK_SIZE < length ?
+        start + FILE_TEXT_DIRECT_CHUNK_SIZE : length;
+    if (fileTextIsPairTrail(ut, start)) {
+        --start;
+    }
+    if (fileTextIsPairTrail(ut, limit)) {
+        ++limit;
+    }
+    ut->chunkContents = (const UChar *)ut->context + start;
+    ut->chunkNativeStart = start;
+    ut->chunkNativeLimit = limit;
+    ut->chunkLength = (int32_t)(limit - start);
+    ut->nativeIndexingLimit = ut->chunkLength;
+    ut->chunkOffset = (int32_t)(ix - start);
+    return forward ? ix < length : ix > 0;
+}
+
+static UBool U_CALLCONV
+fileTextAccess(UText *ut, int64_t index, UBool forward) {
+    int64_t length = ut->a;
+    int64_t ix = index;
+    pinIndex(ix, length);
+    if (ut->c) {
+        return fileTextAccessDirect(ut, ix, forward);
+    }
+
+    const FileTextBuf *b = (const FileTextBuf *)ut->p;
+    FileTextBuf *alt = (FileTextBuf *)ut->q;
+    if (forward) {
+        if (b->nativeStart <= ix && ix < b->nativeLimit) {
+            ut->chunkOffset = fileTextBufOffset(b, ix);
+            return TRUE;
+        }
+        if (alt->nativeStart <= ix && ix < alt->nativeLimit) {
+            fileTextSwapBuffers(ut);
+            ut->chunkOffset = fileTextBufOffset(alt, ix);
+            return TRUE;
+        }
+        if (ix == length) {
+            // End of the text.
+            if (b->nativeLimit != length) {
+                if (alt->nativeLimit != length) {
+                    fileTextFill(ut, alt, ix, FALSE, FILE_TEXT_SHORT_CHUNK_SIZE);
+                }
+                fileTextSwapBuffers(ut);
+            }
+            ut->chunkOffset = ut->chunkLength;
+            return FALSE;
+        }
+        int32_t fillSize = FILE_TEXT_SHORT_CHUNK_SIZE;
+        if (ix == b->nativeLimit) {
+            // Sequential iteration.
+            fillSize = FILE_TEXT_CHUNK_SIZE;
+            fileTextMovedForward(ut, ix);
+        }
+        fileTextFill(ut, alt, ix, TRUE, fillSize);
+    } else {
+        // Move an index on a UTF-8 trail byte to the start of its character,
+        // as utf8TextAccess() does. The buffer must contain text before that start:
+        // A trail byte of the first character in a buffer maps to offset 0.
+        if (ut->b == FILE_TEXT_UTF8) {
+            ix = fileTextUTF8CPStart(ut, ix);
+        }
+        if (b->nativeStart < ix && ix <= b->nativeLimit) {
+            ut->chunkOffset = fileTextBufOffset(b, ix);
+            return TRUE;
+        }
+        if (alt->nativeStart < ix && ix <= alt->nativeLimit) {
+            fileTextSwapBuffers(ut);
+            ut->chunkOffset = fileTextBufOffset(alt, ix);
+            return TRUE;
+        }
+        if (ix == 0) {
+            // Start of the text.
+            if (b->nativeStart != 0) {
+                if (alt->nativeStart != 0) {
+                    fileTextFill(ut, alt, 0, TRUE, FILE_TEXT_SHORT_CHUNK_SIZE);
+                }
+                fileTextSwapBuffers(ut);
+            }
+            ut->chunkOffset = 0;
+            return FALSE;
+        }
+        fileTextFill(ut, alt, ix, FALSE,
+                     ix == b->nativeStart ? FILE_TEXT_CHUNK_SIZE : FILE_TEXT_SHORT_CHUNK_SIZE);
+    }
+    fileTextSwapBuffers(ut);
+    ut->chunkOffset = fileTextBufOffset(alt, ix);
+    return TRUE;
+}
+
+static int32_t U_CALLCONV
+fileTextExtract(UText *ut,
+                int64_t start, int64_t limit,
+                UChar *dest, int32_t destCapacity,
+                UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(destCapacity<0 || (dest==NULL && destCapacity>0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int64_t length = ut->a;
+    pinIndex(start, length);
+    pinIndex(limit, length);
+    if(start>limit) {
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+
+    int32_t destLength=0;
+    if (ut->b == FILE_TEXT_UTF8) {
+        // Snap the indexes back to code point boundaries.
+        start = fileTextUTF8CPStart(ut, start);
+        limit = fileTextUTF8CPStart(ut, limit);
+        if (limit - start > INT32_MAX) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        utext_strFromUTF8(dest, destCapacity, &destLength,
+                          (const char *)ut->context+start, (int32_t)(limit-start),
+                          pErrorCode);
+    } else {
+        // Do not split surrogate pairs.
+        if (fileTextIsPairTrail(ut, start)) {
+            --start;
+        }
+        if (fileTextIsPairTrail(ut, limit)) {
+            ++limit;
+        }
+        if (limit - start > INT32_MAX) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        destLength = (int32_t)(limit - start);
+        int32_t copyLength = destLength < destCapacity ? destLength : destCapacity;
+        if (ut->c) {
+            u_memcpy(dest, (const UChar *)ut->context + start, copyLength);
+        } else {
+            for (int32_t i = 0; i < copyLength; ++i) {
+                dest[i] = fileTextUnitAt(ut, start + i);
+            }
+        }
+        u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+    }
+    fileTextAccess(ut, limit, TRUE);
+    return destLength;
+}
+
+static int64_t U_CALLCONV
+fileTextMapOffsetToNative(const UText *ut) {
+    if (ut->chunkOffset <= ut->nativeIndexingLimit) {
+        return ut->chunkNativeStart + ut->chunkOffset;
+    }
+    const FileTextBuf *b = (const FileTextBuf *)ut->p;
+    U_ASSERT(ut->chunkOffset<=ut->chunkLength);
+    return b->nativeStart + b->mapToNative[ut->chunkOffset];
+}
+
+static int32_t U_CALLCONV
+fileTextMapIndexToUTF16(const UText *ut, int64_t index) {
+    U_ASSERT(index>=ut->chunkNativeStart && index<=ut->chunkNativeLimit);
+    if (ut->c) {
+        return (int32_t)(index - ut->chunkNativeStart);
+    }
+    return fileTextBufOffset((const FileTextBuf *)ut->p, index);
+}
+
+static UText * U_CALLCONV
+fileTextClone(UText *dest, const UText *src, UBool deep, UErrorCode *status) {
+    // The mapped file is read-only. Deep and shallow clones share it.
+    (void)deep;
+    dest = shallowTextClone(dest, src, status);
+    if (U_SUCCESS(*status)) {
+        umtx_atomic_inc(&((FileTextMapping *)dest->r)->refCount);
+    }
+    return dest;
+}
+
+static void U_CALLCONV
+fileTextClose(UText *ut) {
+    FileTextMapping *mapping = (FileTextMapping *)ut->r;
+    if (mapping != NULL && umtx_atomic_dec(&mapping->refCount) == 0) {
+        uprv_unmapWholeFile(&mapping->file);
+        uprv_free(mapping);
+    }
+    ut->r = NULL;
+    ut->context = NULL;
+}
+
+U_CDECL_END
+
+
+static const struct UTextFuncs fileTextFuncs =
+{
+    sizeof(UTextFuncs),
+    0, 0, 0,             // Reserved alignment padding
+    fileTextClone,
+    fileTextLength,
+    fileTextAccess,
+    fileTextExtract,
+    NULL,                /* replace*/
+    NULL,                /* copy   */
+    fileTextMapOffsetToNative,
+    fileTextMapIndexToUTF16,
+    fileTextClose,
+    NULL,                // spare 1
+    NULL,                // spare 2
+    NULL                 // spare 3
+};
+
+static UText *
+openFileText(UText *ut, const char *path, UBool isUTF8, UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return NULL;
+    }
+    if(path==NULL) {
+        *status=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    FileTextMapping *mapping = (FileTextMapping *)uprv_malloc(sizeof(FileTextMapping));
+    if (mapping == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (!uprv_mapWholeFile(&mapping->file, path, status)) {
+        uprv_free(mapping);
+        return NULL;
+    }
+    ut = utext_setup(ut, sizeof(FileTextExtra), status);
+    if (U_FAILURE(*status)) {
+        uprv_unmapWholeFile(&mapping->file);
+        uprv_free(mapping);
+        return ut;
+    }
+    umtx_storeRelease(mapping->refCount, 1);
+
+    const char *data = mapping->file.data;
+    int64_t length = mapping->file.length;
+    ut->pFuncs  = &fileTextFuncs;
+    ut->context = data != NULL ? data : gEmptyString;
+    ut->r       = mapping;
+    if (isUTF8) {
+        ut->a = length;
+        ut->b = FILE_TEXT_UTF8;
+    } else {
+        ut->a = length / 2;
+        if (length >= 2 && (uint8_t)data[0] == 0xff && (uint8_t)data[1] == 0xfe) {
+            ut->b = FILE_TEXT_UTF16LE;
+        } else {
+            ut->b = FILE_TEXT_UTF16BE;
+        }
+        ut->c = ut->b == (U_IS_BIG_ENDIAN ? FILE_TEXT_UTF16BE : FILE_TEXT_UTF16LE);
+    }
+    FileTextExtra *extra = (FileTextExtra *)ut->pExtra;
+    ut->p = &extra->bufs[0];
+    ut->q = &extra->bufs[1];
+    return ut;
+}
+
+U_CAPI UText * U_EXPORT2
+utext_openUTF8File(UText *ut, const char *path, UErrorCode *status) {
+    return openFileText(ut, path, TRUE, status);
+}
+
+U_CAPI UText * U_EXPORT2
+utext_openUTF16File(UText *ut, const char *path, UErrorCode *status) {
+    return openFileText(ut, path, FALSE, status);
+}
+
+
+
+
 
 
 
@@ -150,7 +150,7 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 CharsetDetector::CharsetDetector(UErrorCode &status)
   : textIn(new InputText(status)), resultArray(NULL),
     resultCount(0), fStripTags(FALSE), fFreshTextSet(FALSE),
-    fEnabledRecognizers(NULL)
+    fConfidenceThreshold(0), fEnabledRecognizers(NULL), fScanStates(NULL)
 {
     if (U_FAILURE(status)) {
         return;
@@ -192,6 +192,8 @@ CharsetDetector::~CharsetDetector()
     if (fEnabledRecognizers) {
         uprv_free(fEnabledRecognizers);
     }
+
+    delete[] fScanStates;
 }
 
 void CharsetDetector::setText(const char *in, int32_t len)
@@ -200,6 +202,64 @@ void CharsetDetector::setText(const char *in, int32_t len)
     fFreshTextSet = TRUE;
 }
 
+void CharsetDetector::appendText(const char *in, int32_t len, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if ((in == NULL && len != 0) || len < -1) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (len == -1) {
+        len = (int32_t)uprv_strlen(in);
+    }
+
+    if (!textIn->isIncremental()) {
+        textIn->startText(status);
+        if (fScanStates == NULL && U_SUCCESS(status)) {
+            fScanStates = new RawScanState[fCSRecognizers_size];
+            if (fScanStates == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+        }
+        if (U_FAILURE(status)) {
+            return;
+        }
+        for (int32_t i = 0; i < fCSRecognizers_size; i += 1) {
+            fScanStates[i] = RawScanState();
+        }
+    }
+
+    if (len > INT32_MAX - textIn->fTextLength) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+
+    // The recognizers stop short of a character that might continue in the next piece.
+    //   First give them the seam: the held-back tail bytes with the start of this piece.
+    const uint8_t *bytes = (const uint8_t *)in;
+    int32_t tailLength = textIn->fTailLength;
+    if (tailLength > 0 && len > 0) {
+        uint8_t seam[7];
+        int32_t seamLength = tailLength + (len < 4 ? len : 4);
+        uprv_memcpy(seam, textIn->fTail, tailLength);
+        uprv_memcpy(seam + tailLength, bytes, seamLength - tailLength);
+        for (int32_t i = 0; i < fCSRecognizers_size; i += 1) {
+            fCSRecognizers[i]->recognizer->scan(fScanStates[i], seam, textIn->fTextLength - tailLength,
+                                                seamLength, FALSE);
+        }
+    }
+    if (len > 4 || (tailLength == 0 && len > 0)) {
+        for (int32_t i = 0; i < fCSRecognizers_size; i += 1) {
+            fCSRecognizers[i]->recognizer->scan(fScanStates[i], bytes, textIn->fTextLength, len, FALSE);
+        }
+    }
+
+    textIn->appendText(bytes, len);
+    fFreshTextSet = TRUE;
+}
+
 UBool CharsetDetector::setStripTagsFlag(UBool flag)
 {
     UBool temp = fStripTags;
@@ -213,6 +273,26 @@ UBool CharsetDetector::getStripTagsFlag() const
     return fStripTags;
 }
 
+void CharsetDetector::setConfidenceThreshold(int32_t threshold, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (threshold < 0 || threshold > 100) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    fConfidenceThreshold = threshold;
+    fFreshTextSet = TRUE;
+}
+
+int32_t CharsetDetector::getConfidenceThreshold() const
+{
+    return fConfidenceThreshold;
+}
+
 void CharsetDetector::setDeclaredEncoding(const char *encoding, int32_t len) const
 {
     textIn->setDeclaredEncoding(encoding,len);
@@ -254,11 +334,31 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
 
         // Iterate over all possible charsets, remember all that
         // give a match quality > 0.
+        // With a confidence threshold, stop as soon as one match reaches it.
+        // With incremental input, the recognizers that scanned each piece
+        // finish with the held-back tail bytes instead of matching the sample.
         resultCount = 0;
         for (i = 0; i < fCSRecognizers_size; i += 1) {
             csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
+            UBool matched;
+            if (textIn->isIncremental()) {
+                RawScanState state = fScanStates[i];
+                if (csr->scan(state, textIn->fTail, textIn->fTextLength - textIn->fTailLength,
+                              textIn->fTailLength, TRUE)) {
+                    matched = csr->matchScanned(textIn, state, resultArray[resultCount]);
+                } else {
+                    matched = csr->match(textIn, resultArray[resultCount]);
+                }
+            } else {
+                matched = csr->match(textIn, resultArray[resultCount]);
+            }
+            if (matched) {
                 resultCount++;
+
+                if (fConfidenceThreshold > 0 &&
+                        resultArray[resultCount - 1]->getConfidence() >= fConfidenceThreshold) {
+                    break;
+                }
             }
         }
 
@@ -21,6 +21,7 @@ U_NAMESPACE_BEGIN
 class InputText;
 class CharsetRecognizer;
 class CharsetMatch;
+struct RawScanState;
 
 class CharsetDetector : public UMemory
 {
@@ -30,12 +31,17 @@ class CharsetDetector : public UMemory
     int32_t resultCount;
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
+    int32_t fConfidenceThreshold;   // If > 0, detectAll() stops at the first match this good.
     static void setRecognizers(UErrorCode &status);
 
     UBool *fEnabledRecognizers;  // If not null, active set of charset recognizers had
                                 // been changed from the default. The array index is
                                 // corresponding to fCSRecognizers. See setDetectableCharset().
 
+    RawScanState *fScanStates;  // Per-recognizer scanning state for appendText(),
+                                // allocated on first use. The array index is
+                                // corresponding to fCSRecognizers.
+
 public:
     CharsetDetector(UErrorCode &status);
 
@@ -43,6 +49,8 @@ class CharsetDetector : public UMemory
 
     void setText(const char *in, int32_t len);
 
+    void appendText(const char *in, int32_t len, UErrorCode &status);
+
     const CharsetMatch * const *detectAll(int32_t &maxMatchesFound, UErrorCode &status);
 
     const CharsetMatch *detect(UErrorCode& status);
@@ -53,6 +61,10 @@ class CharsetDetector : public UMemory
 
     UBool getStripTagsFlag() const;
 
+    void setConfidenceThreshold(int32_t threshold, UErrorCode &status);
+
+    int32_t getConfidenceThreshold() const;
+
 //    const char *getCharsetName(int32_t index, UErrorCode& status) const;
 
     static int32_t getDetectableCount();
@@ -26,13 +26,14 @@ U_NAMESPACE_BEGIN
  * the proportion that fit the encoding.
  * 
  * 
- * @param text the byte buffer containing text to analyse
- * @param textLen  the size of the text in the byte.
+ * @param textIn the input text; its fInputBytes are analysed.
  * @param escapeSequences the byte escape sequences to test for.
  * @return match quality, in the range of 0-100.
  */
-int32_t CharsetRecog_2022::match_2022(const uint8_t *text, int32_t textLen, const uint8_t escapeSequences[][5], int32_t escapeSequences_length) const
+int32_t CharsetRecog_2022::match_2022(InputText *textIn, const uint8_t escapeSequences[][5], int32_t escapeSequences_length) const
 {
+    const uint8_t *text = textIn->fInputBytes;
+    int32_t textLen = textIn->fInputLen;
     int32_t i, j;
     int32_t escN;
     int32_t hits   = 0;
@@ -40,6 +41,11 @@ int32_t CharsetRecog_2022::match_2022(const uint8_t *text, int32_t textLen, cons
     int32_t shifts = 0;
     int32_t quality;
 
+    // Without any ESC there can be no hits, and the quality is 0.
+    if (textIn->fByteStats[0x1B] == 0) {
+        return 0;
+    }
+
     i = 0;
     while(i < textLen) {
         if(text[i] == 0x1B) {
@@ -147,8 +153,7 @@ const char *CharsetRecog_2022JP::getName() const {
 }
 
 UBool CharsetRecog_2022JP::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes, 
-                                    textIn->fInputLen, 
+    int32_t confidence = match_2022(textIn,
                                     escapeSequences_2022JP, 
                                     UPRV_LENGTHOF(escapeSequences_2022JP));
     results->set(textIn, this, confidence);
@@ -163,8 +168,7 @@ const char *CharsetRecog_2022KR::getName() const {
 }
 
 UBool CharsetRecog_2022KR::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes, 
-                                    textIn->fInputLen, 
+    int32_t confidence = match_2022(textIn,
                                     escapeSequences_2022KR, 
                                     UPRV_LENGTHOF(escapeSequences_2022KR));
     results->set(textIn, this, confidence);
@@ -178,8 +182,7 @@ const char *CharsetRecog_2022CN::getName() const {
 }
 
 UBool CharsetRecog_2022CN::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes,
-                                    textIn->fInputLen,
+    int32_t confidence = match_2022(textIn,
                                     escapeSequences_2022CN,
                                     UPRV_LENGTHOF(escapeSequences_2022CN));
     results->set(textIn, this, confidence);
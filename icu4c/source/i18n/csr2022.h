@@ -45,13 +45,11 @@ class CharsetRecog_2022 : public CharsetRecognizer
      * the proportion that fit the encoding.
      * 
      * 
-     * @param text the byte buffer containing text to analyse
-     * @param textLen  the size of the text in the byte.
+     * @param textIn the input text; its fInputBytes are analysed.
      * @param escapeSequences the byte escape sequences to test for.
      * @return match quality, in the range of 0-100.
      */
-    int32_t match_2022(const uint8_t *text,
-                       int32_t textLen,
+    int32_t match_2022(InputText *textIn,
                        const uint8_t escapeSequences[][5],
                        int32_t escapeSequences_length) const;
 
@@ -25,6 +25,17 @@ const char *CharsetRecognizer::getLanguage() const
     return "";
 }
 
+UBool CharsetRecognizer::scan(RawScanState &/*state*/, const uint8_t * /*window*/, int32_t /*windowStart*/,
+                              int32_t /*windowLength*/, UBool /*final*/) const
+{
+    return FALSE;
+}
+
+UBool CharsetRecognizer::matchScanned(InputText *textIn, const RawScanState &/*state*/, CharsetMatch *results) const
+{
+    return match(textIn, results);
+}
+
 U_NAMESPACE_END    
 
 #endif
@@ -20,6 +20,22 @@ U_NAMESPACE_BEGIN
 
 class CharsetMatch;
 
+/*
+ * What a recognizer that walks the whole raw input has found so far.
+ * The counts are recognizer-specific.
+ */
+struct RawScanState : public UMemory {
+    RawScanState()
+        : resumeIndex(0), numValid(0), numInvalid(0), numCommon(0), numChars(0), stopped(FALSE) {}
+
+    int32_t resumeIndex;    // Raw input index where the next scan() continues.
+    int32_t numValid;       // Valid multi-byte sequences or characters.
+    int32_t numInvalid;     // Invalid ones.
+    int32_t numCommon;      // Multi-byte characters from the list of common ones.
+    int32_t numChars;       // All characters.
+    UBool   stopped;        // The result is settled; further input is not scanned.
+};
+
 class CharsetRecognizer : public UMemory
 {
  public:
@@ -48,6 +64,26 @@ class CharsetRecognizer : public UMemory
      */
     virtual UBool match(InputText *textIn, CharsetMatch *results) const = 0;
 
+    /*
+     * Recognizers that walk the whole raw input, rather than the fInputBytes sample,
+     * split match() into scan() and matchScanned(), so that incremental input
+     * is scanned piece by piece as it arrives.
+     *
+     * Continue scanning from state.resumeIndex through window[0..windowLength[,
+     * which holds the raw input bytes from index windowStart on.
+     * Unless final is TRUE, stop before a character that might continue
+     * after the window; state.resumeIndex is then within its last 3 bytes.
+     *
+     * Return FALSE if this recognizer does not scan the raw input.
+     */
+    virtual UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+                       int32_t windowLength, UBool final) const;
+
+    /*
+     * Like match(), for raw input that has been scanned to its end into state.
+     */
+    virtual UBool matchScanned(InputText *textIn, const RawScanState &state, CharsetMatch *results) const;
+
     virtual ~CharsetRecognizer();
 };
 
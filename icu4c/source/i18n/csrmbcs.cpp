@@ -14,6 +14,7 @@
 #include "cmemory.h"
 #include "csmatch.h"
 #include "csrmbcs.h"
+#include "usimd.h"
 
 #include <math.h>
 
@@ -114,8 +115,8 @@ static int32_t binarySearch(const uint16_t *array, int32_t len, uint16_t value)
     return -1;
 }
 
-IteratedChar::IteratedChar() : 
-charValue(0), index(-1), nextIndex(0), error(FALSE), done(FALSE)
+IteratedChar::IteratedChar(const uint8_t *theBytes, int32_t theLimit) :
+charValue(0), index(-1), nextIndex(0), error(FALSE), done(FALSE), bytes(theBytes), limit(theLimit)
 {
     // nothing else to do.
 }
@@ -129,15 +130,15 @@ charValue(0), index(-1), nextIndex(0), error(FALSE), done(FALSE)
     done      = FALSE;
 }*/
 
-int32_t IteratedChar::nextByte(InputText *det)
+int32_t IteratedChar::nextByte()
 {
-    if (nextIndex >= det->fRawLength) {
+    if (nextIndex >= limit) {
         done = TRUE;
 
         return -1;
     }
 
-    return det->fRawInput[nextIndex++];
+    return bytes[nextIndex++];
 }
 
 CharsetRecog_mbcs::~CharsetRecog_mbcs()
@@ -146,41 +147,83 @@ CharsetRecog_mbcs::~CharsetRecog_mbcs()
 }
 
 int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars[], int32_t commonCharsLen) const {
-    int32_t singleByteCharCount = 0;
-    int32_t doubleByteCharCount = 0;
-    int32_t commonCharCount     = 0;
-    int32_t badCharCount        = 0;
-    int32_t totalCharCount      = 0;
-    int32_t confidence          = 0;
-    IteratedChar iter;
+    RawScanState state;
+
+    // The leading ASCII bytes were already counted by the InputText.
+    state.resumeIndex = state.numChars = det->fRawASCIILength;
+    scan_mbcs(state, det->fRawInput, 0, det->fRawLength, TRUE, commonChars, commonCharsLen);
 
-    while (nextChar(&iter, det)) {
-        totalCharCount++;
+    return confidence_mbcs(state, commonChars);
+}
+
+void CharsetRecog_mbcs::scan_mbcs(RawScanState &state, const uint8_t *window, int32_t windowStart, int32_t windowLength,
+                                  UBool final, const uint16_t commonChars[], int32_t commonCharsLen) const {
+    if (state.stopped) {
+        return;
+    }
+
+    IteratedChar iter(window, windowLength);
+    iter.nextIndex = state.resumeIndex - windowStart;
+
+    // No character is longer than 4 bytes. Unless this is the end of the input,
+    //   stop before a character that might continue past the end of the window.
+    int32_t charLimit = final ? windowLength : windowLength - 3;
+
+    for (;;) {
+        // Every encoding recognized here treats bytes below 0x80 as single-byte
+        //   characters, so runs of them are counted without calling nextChar().
+        //   They cannot change the bail-out test below, which was already checked
+        //   after the preceding character.
+        if (iter.nextIndex < windowLength && window[iter.nextIndex] < 0x80) {
+            int32_t asciiLength = usimd_asciiPrefixLength(window + iter.nextIndex,
+                                                          windowLength - iter.nextIndex);
+            iter.nextIndex += asciiLength;
+            state.numChars += asciiLength;
+        }
+
+        if (!final && iter.nextIndex >= charLimit) {
+            break;
+        }
+
+        if (!nextChar(&iter)) {
+            break;
+        }
+
+        state.numChars++;
 
         if (iter.error) {
-            badCharCount++;
-        } else {
-            if (iter.charValue <= 0xFF) {
-                singleByteCharCount++;
-            } else {
-                doubleByteCharCount++;
-
-                if (commonChars != 0) {
-                    if (binarySearch(commonChars, commonCharsLen, static_cast<uint16_t>(iter.charValue)) >= 0){
-                        commonCharCount += 1;
-                    }
+            state.numInvalid++;
+        } else if (iter.charValue > 0xFF) {
+            state.numValid++;
+
+            if (commonChars != 0) {
+                if (binarySearch(commonChars, commonCharsLen, static_cast<uint16_t>(iter.charValue)) >= 0){
+                    state.numCommon += 1;
                 }
             }
         }
 
-
-        if (badCharCount >= 2 && badCharCount*5 >= doubleByteCharCount) {
+        if (state.numInvalid >= 2 && state.numInvalid*5 >= state.numValid) {
             // Bail out early if the byte data is not matching the encoding scheme.
-            // break detectBlock;
-            return confidence;
+            state.stopped = TRUE;
+            break;
         }
     }
 
+    state.resumeIndex = windowStart + iter.nextIndex;
+}
+
+int32_t CharsetRecog_mbcs::confidence_mbcs(const RawScanState &state, const uint16_t commonChars[]) {
+    int32_t doubleByteCharCount = state.numValid;
+    int32_t commonCharCount     = state.numCommon;
+    int32_t badCharCount        = state.numInvalid;
+    int32_t totalCharCount      = state.numChars;
+    int32_t confidence          = 0;
+
+    if (state.stopped) {
+        return confidence;
+    }
+
     if (doubleByteCharCount <= 10 && badCharCount == 0) {
         // Not many multi-byte chars.
         if (doubleByteCharCount == 0 && totalCharCount < 10) {
@@ -241,11 +284,11 @@ CharsetRecog_sjis::~CharsetRecog_sjis()
     // nothing to do
 }
 
-UBool CharsetRecog_sjis::nextChar(IteratedChar* it, InputText* det) const {
+UBool CharsetRecog_sjis::nextChar(IteratedChar* it) const {
     it->index = it->nextIndex;
     it->error = FALSE;
 
-    int32_t firstByte = it->charValue = it->nextByte(det);
+    int32_t firstByte = it->charValue = it->nextByte();
 
     if (firstByte < 0) {
         return FALSE;
@@ -255,7 +298,7 @@ UBool CharsetRecog_sjis::nextChar(IteratedChar* it, InputText* det) const {
         return TRUE;
     }
 
-    int32_t secondByte = it->nextByte(det);
+    int32_t secondByte = it->nextByte();
     if (secondByte >= 0) {
         it->charValue = (firstByte << 8) | secondByte;
     }
@@ -275,6 +318,20 @@ UBool CharsetRecog_sjis::match(InputText* det, CharsetMatch *results) const {
     return (confidence > 0);
 }
 
+UBool CharsetRecog_sjis::scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+                              int32_t windowLength, UBool final) const
+{
+    scan_mbcs(state, window, windowStart, windowLength, final, commonChars_sjis, UPRV_LENGTHOF(commonChars_sjis));
+    return TRUE;
+}
+
+UBool CharsetRecog_sjis::matchScanned(InputText *det, const RawScanState &state, CharsetMatch *results) const
+{
+    int32_t confidence = confidence_mbcs(state, commonChars_sjis);
+    results->set(det, this, confidence);
+    return (confidence > 0);
+}
+
 const char *CharsetRecog_sjis::getName() const
 {
     return "Shift_JIS";
@@ -290,14 +347,14 @@ CharsetRecog_euc::~CharsetRecog_euc()
     // nothing to do
 }
 
-UBool CharsetRecog_euc::nextChar(IteratedChar* it, InputText* det) const {
+UBool CharsetRecog_euc::nextChar(IteratedChar* it) const {
     int32_t firstByte  = 0;
     int32_t secondByte = 0;
     int32_t thirdByte  = 0;
 
     it->index = it->nextIndex;
     it->error = FALSE;
-    firstByte = it->charValue = it->nextByte(det);
+    firstByte = it->charValue = it->nextByte();
 
     if (firstByte < 0) {
         // Ran off the end of the input data
@@ -309,7 +366,7 @@ UBool CharsetRecog_euc::nextChar(IteratedChar* it, InputText* det) const {
         return TRUE;
     }
 
-    secondByte = it->nextByte(det);
+    secondByte = it->nextByte();
     if (secondByte >= 0) {
         it->charValue = (it->charValue << 8) | secondByte;
     }
@@ -341,7 +398,7 @@ UBool CharsetRecog_euc::nextChar(IteratedChar* it, InputText* det) const {
     if (firstByte == 0x8F) {
         // Code set 3.
         // Three byte total char size, two bytes of actual char value.
-        thirdByte    = it->nextByte(det);
+        thirdByte    = it->nextByte();
         it->charValue = (it->charValue << 8) | thirdByte;
 
         if (thirdByte < 0xa1) {
@@ -376,6 +433,20 @@ UBool CharsetRecog_euc_jp::match(InputText *det, CharsetMatch *results) const
     return (confidence > 0);
 }
 
+UBool CharsetRecog_euc_jp::scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+                                int32_t windowLength, UBool final) const
+{
+    scan_mbcs(state, window, windowStart, windowLength, final, commonChars_euc_jp, UPRV_LENGTHOF(commonChars_euc_jp));
+    return TRUE;
+}
+
+UBool CharsetRecog_euc_jp::matchScanned(InputText *det, const RawScanState &state, CharsetMatch *results) const
+{
+    int32_t confidence = confidence_mbcs(state, commonChars_euc_jp);
+    results->set(det, this, confidence);
+    return (confidence > 0);
+}
+
 CharsetRecog_euc_kr::~CharsetRecog_euc_kr()
 {
     // nothing to do
@@ -398,18 +469,32 @@ UBool CharsetRecog_euc_kr::match(InputText *det, CharsetMatch *results) const
     return (confidence > 0);
 }
 
+UBool CharsetRecog_euc_kr::scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+                                int32_t windowLength, UBool final) const
+{
+    scan_mbcs(state, window, windowStart, windowLength, final, commonChars_euc_kr, UPRV_LENGTHOF(commonChars_euc_kr));
+    return TRUE;
+}
+
+UBool CharsetRecog_euc_kr::matchScanned(InputText *det, const RawScanState &state, CharsetMatch *results) const
+{
+    int32_t confidence = confidence_mbcs(state, commonChars_euc_kr);
+    results->set(det, this, confidence);
+    return (confidence > 0);
+}
+
 CharsetRecog_big5::~CharsetRecog_big5()
 {
     // nothing to do
 }
 
-UBool CharsetRecog_big5::nextChar(IteratedChar* it, InputText* det) const
+UBool CharsetRecog_big5::nextChar(IteratedChar* it) const
 {
     int32_t firstByte;
 
     it->index = it->nextIndex;
     it->error = FALSE;
-    firstByte = it->charValue = it->nextByte(det);
+    firstByte = it->charValue = it->nextByte();
 
     if (firstByte < 0) {
         return FALSE;
@@ -420,7 +505,7 @@ UBool CharsetRecog_big5::nextChar(IteratedChar* it, InputText* det) const
         return TRUE;
     }
 
-    int32_t secondByte = it->nextByte(det);
+    int32_t secondByte = it->nextByte();
     if (secondByte >= 0)  {
         it->charValue = (it->charValue << 8) | secondByte;
     }
@@ -450,12 +535,26 @@ UBool CharsetRecog_big5::match(InputText *det, CharsetMatch *results) const
     return (confidence > 0);
 }
 
+UBool CharsetRecog_big5::scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+                              int32_t windowLength, UBool final) const
+{
+    scan_mbcs(state, window, windowStart, windowLength, final, commonChars_big5, UPRV_LENGTHOF(commonChars_big5));
+    return TRUE;
+}
+
+UBool CharsetRecog_big5::matchScanned(InputText *det, const RawScanState &state, CharsetMatch *results) const
+{
+    int32_t confidence = confidence_mbcs(state, commonChars_big5);
+    results->set(det, this, confidence);
+    return (confidence > 0);
+}
+
 CharsetRecog_gb_18030::~CharsetRecog_gb_18030()
 {
     // nothing to do
 }
 
-UBool CharsetRecog_gb_18030::nextChar(IteratedChar* it, InputText* det) const {
+UBool CharsetRecog_gb_18030::nextChar(IteratedChar* it) const {
     int32_t firstByte  = 0;
     int32_t secondByte = 0;
     int32_t thirdByte  = 0;
@@ -463,7 +562,7 @@ UBool CharsetRecog_gb_18030::nextChar(IteratedChar* it, InputText* det) const {
 
     it->index = it->nextIndex;
     it->error = FALSE;
-    firstByte = it->charValue = it->nextByte(det);
+    firstByte = it->charValue = it->nextByte();
 
     if (firstByte < 0) {
         // Ran off the end of the input data
@@ -475,7 +574,7 @@ UBool CharsetRecog_gb_18030::nextChar(IteratedChar* it, InputText* det) const {
         return TRUE;
     }
 
-    secondByte = it->nextByte(det);
+    secondByte = it->nextByte();
     if (secondByte >= 0) {
         it->charValue = (it->charValue << 8) | secondByte;
     }
@@ -489,10 +588,10 @@ UBool CharsetRecog_gb_18030::nextChar(IteratedChar* it, InputText* det) const {
 
         // Four byte char
         if (secondByte >= 0x30 && secondByte <= 0x39) {
-            thirdByte = it->nextByte(det);
+            thirdByte = it->nextByte();
 
             if (thirdByte >= 0x81 && thirdByte <= 0xFE) {
-                fourthByte = it->nextByte(det);
+                fourthByte = it->nextByte();
 
                 if (fourthByte >= 0x30 && fourthByte <= 0x39) {
                     it->charValue = (it->charValue << 16) | (thirdByte << 8) | fourthByte;
@@ -526,5 +625,19 @@ UBool CharsetRecog_gb_18030::match(InputText *det, CharsetMatch *results) const
     return (confidence > 0);
 }
 
+UBool CharsetRecog_gb_18030::scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+                                  int32_t windowLength, UBool final) const
+{
+    scan_mbcs(state, window, windowStart, windowLength, final, commonChars_gb_18030, UPRV_LENGTHOF(commonChars_gb_18030));
+    return TRUE;
+}
+
+UBool CharsetRecog_gb_18030::matchScanned(InputText *det, const RawScanState &state, CharsetMatch *results) const
+{
+    int32_t confidence = confidence_mbcs(state, commonChars_gb_18030);
+    results->set(det, this, confidence);
+    return (confidence > 0);
+}
+
 U_NAMESPACE_END
 #endif
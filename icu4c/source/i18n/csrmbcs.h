@@ -38,10 +38,13 @@ class IteratedChar : public UMemory
     UBool    error;
     UBool    done;
 
+    const uint8_t *bytes;           // The raw input bytes being iterated over,
+    int32_t  limit;                 //   or a window of them.
+
 public:
-    IteratedChar();
+    IteratedChar(const uint8_t *bytes, int32_t limit);
     //void reset();
-    int32_t nextByte(InputText* det);
+    int32_t nextByte();
 };
 
 
@@ -62,6 +65,13 @@ class CharsetRecog_mbcs : public CharsetRecognizer {
      */
     int32_t match_mbcs(InputText* det, const uint16_t commonChars[], int32_t commonCharsLen) const;
 
+    /*
+     * The two parts of match_mbcs(), for CharsetRecognizer::scan() and matchScanned().
+     */
+    void scan_mbcs(RawScanState &state, const uint8_t *window, int32_t windowStart, int32_t windowLength,
+                   UBool final, const uint16_t commonChars[], int32_t commonCharsLen) const;
+    static int32_t confidence_mbcs(const RawScanState &state, const uint16_t commonChars[]);
+
 public:
 
     virtual ~CharsetRecog_mbcs();
@@ -83,11 +93,10 @@ class CharsetRecog_mbcs : public CharsetRecognizer {
      *  This function is not a method of class IteratedChar only because
      *   that would require a lot of extra derived classes, which is awkward.
      * @param it  The IteratedChar "struct" into which the returned char is placed.
-     * @param det The charset detector, which is needed to get at the input byte data
-     *            being iterated over.
+     *            It also holds the input byte data being iterated over.
      * @return    True if a character was returned, false at end of input.
      */
-    virtual UBool nextChar(IteratedChar *it, InputText *textIn) const = 0;
+    virtual UBool nextChar(IteratedChar *it) const = 0;
 
 };
 
@@ -100,10 +109,15 @@ class CharsetRecog_sjis : public CharsetRecog_mbcs {
 public:
     virtual ~CharsetRecog_sjis();
 
-    UBool nextChar(IteratedChar *it, InputText *det) const;
+    UBool nextChar(IteratedChar *it) const;
 
     UBool match(InputText* input, CharsetMatch *results) const;
 
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const;
+
     const char *getName() const;
     const char *getLanguage() const;
 
@@ -131,7 +145,7 @@ class CharsetRecog_euc : public CharsetRecog_mbcs
      *  Character "value" is simply the raw bytes that make up the character
      *     packed into an int.
      */
-    UBool nextChar(IteratedChar *it, InputText *det) const;
+    UBool nextChar(IteratedChar *it) const;
 };
 
 /**
@@ -147,6 +161,11 @@ class CharsetRecog_euc_jp : public CharsetRecog_euc
     const char *getLanguage() const;
 
     UBool match(InputText* input, CharsetMatch *results) const;
+
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const;
 };
 
 /**
@@ -162,6 +181,11 @@ class CharsetRecog_euc_kr : public CharsetRecog_euc
     const char *getLanguage() const;
 
     UBool match(InputText* input, CharsetMatch *results) const;
+
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const;
 };
 
 /**
@@ -174,12 +198,17 @@ class CharsetRecog_big5 : public CharsetRecog_mbcs
 public:
     virtual ~CharsetRecog_big5();
 
-    UBool nextChar(IteratedChar* it, InputText* det) const;
+    UBool nextChar(IteratedChar* it) const;
 
     const char *getName() const;
     const char *getLanguage() const;
 
     UBool match(InputText* input, CharsetMatch *results) const;
+
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const;
 };
 
 
@@ -193,12 +222,17 @@ class CharsetRecog_gb_18030 : public CharsetRecog_mbcs
 public:
     virtual ~CharsetRecog_gb_18030();
 
-    UBool nextChar(IteratedChar* it, InputText* det) const;
+    UBool nextChar(IteratedChar* it) const;
 
     const char *getName() const;
     const char *getLanguage() const;
 
     UBool match(InputText* input, CharsetMatch *results) const;
+
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const;
 };
 
 U_NAMESPACE_END
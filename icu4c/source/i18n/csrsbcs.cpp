@@ -10,6 +10,7 @@
 #include "unicode/utypes.h"
 
 #include "cmemory.h"
+#include "uassert.h"
 
 #if !UCONFIG_NO_CONVERSION
 #include "csrsbcs.h"
@@ -21,7 +22,16 @@
 U_NAMESPACE_BEGIN
 
 NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
- : ngram(0), byteIndex(0)
+ : ngram(0), ngramListLength(64), listHits(NULL), byteIndex(0)
+{
+    ngramList = theNgramList;
+    charMap   = theCharMap;
+
+    ngramCount = hitCount = 0;
+}
+
+NGramParser::NGramParser(const int32_t *theNgramList, int32_t theListLength, int32_t *theListHits, const uint8_t *theCharMap)
+ : ngram(0), ngramListLength(theListLength), listHits(theListHits), byteIndex(0)
 {
     ngramList = theNgramList;
     charMap   = theCharMap;
@@ -80,7 +90,24 @@ void NGramParser::lookup(int32_t thisNgram)
 {
     ngramCount += 1;
 
-    if (search(ngramList, thisNgram) >= 0) {
+    if (listHits != NULL) {
+        // Binary search in a list of any length.
+        int32_t start = 0, limit = ngramListLength;
+
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+
+            if (ngramList[mid] < thisNgram) {
+                start = mid + 1;
+            } else {
+                limit = mid;
+            }
+        }
+
+        if (start < ngramListLength && ngramList[start] == thisNgram) {
+            listHits[start] += 1;
+        }
+    } else if (search(ngramList, thisNgram) >= 0) {
         hitCount += 1;
     }
 
@@ -127,6 +154,19 @@ int32_t NGramParser::parse(InputText *det)
     // TODO: Is this OK? The buffer could have ended in the middle of a word...
     addByte(0x20);
 
+    return getConfidence(hitCount, ngramCount);
+}
+
+int32_t NGramParser::parseCounts(InputText *det)
+{
+    parseCharacters(det);
+    addByte(0x20);
+
+    return ngramCount;
+}
+
+int32_t NGramParser::getConfidence(int32_t hitCount, int32_t ngramCount)
+{
     double rawPercent = (double) hitCount / (double) ngramCount;
 
     //            if (rawPercent <= 2.0) {
@@ -884,27 +924,96 @@ static const int32_t ngrams_8859_9_tr[] = {
     0x6E206B, 0x6E6461, 0x6E6465, 0x6E6520, 0x6E6920, 0x6E696E, 0x6EFD20, 0x72696E, 0x72FD6E, 0x766520, 0x796120, 0x796F72, 0xFD6E20, 0xFD6E64, 0xFD6EFD, 0xFDF0FD,
 };
 
-CharsetRecog_8859_1::~CharsetRecog_8859_1()
+#define MAX_LANGUAGES 16
+
+/*
+ * Match the languages that share one charMap and report the best of them,
+ * with a single pass over the input instead of one per language.
+ * The languages' sorted ngram lists are merged into one, the input is parsed
+ * counting the hits per merged entry, and each language then adds up the
+ * hits of its own entries.
+ */
+static UBool match_languages(const CharsetRecognizer *recognizer, InputText *textIn, CharsetMatch *results,
+                             const char *name, const NGramsPlusLang languages[], int32_t languageCount,
+                             const uint8_t charMap[])
 {
-    // nothing to do
-}
+    int32_t  merged[MAX_LANGUAGES * 64];
+    uint32_t mergedLanguages[MAX_LANGUAGES * 64];   // Bit set of the languages with each ngram.
+    int32_t  mergedHits[MAX_LANGUAGES * 64];
+    int32_t  nextIndex[MAX_LANGUAGES];
+    int32_t  mergedLength = 0;
+    int32_t  l;
+
+    U_ASSERT(languageCount <= MAX_LANGUAGES);
+
+    for (l = 0; l < languageCount; l++) {
+        nextIndex[l] = 0;
+    }
+
+    for (;;) {
+        int32_t minNgram = -1;
+
+        for (l = 0; l < languageCount; l++) {
+            if (nextIndex[l] < 64) {
+                int32_t ngram = languages[l].ngrams[nextIndex[l]];
+
+                if (minNgram < 0 || ngram < minNgram) {
+                    minNgram = ngram;
+                }
+            }
+        }
+
+        if (minNgram < 0) {
+            break;
+        }
+
+        uint32_t languageBits = 0;
+
+        for (l = 0; l < languageCount; l++) {
+            if (nextIndex[l] < 64 && languages[l].ngrams[nextIndex[l]] == minNgram) {
+                languageBits |= (uint32_t)1 << l;
+                nextIndex[l] += 1;
+            }
+        }
+
+        merged[mergedLength] = minNgram;
+        mergedLanguages[mergedLength] = languageBits;
+        mergedHits[mergedLength] = 0;
+        mergedLength += 1;
+    }
+
+    NGramParser parser(merged, mergedLength, mergedHits, charMap);
+    int32_t ngramCount = parser.parseCounts(textIn);
 
-UBool CharsetRecog_8859_1::match(InputText *textIn, CharsetMatch *results) const {
-    const char *name = textIn->fC1Bytes? "windows-1252" : "ISO-8859-1";
-    uint32_t i;
     int32_t bestConfidenceSoFar = -1;
-    for (i=0; i < UPRV_LENGTHOF(ngrams_8859_1) ; i++) {
-        const int32_t *ngrams = ngrams_8859_1[i].ngrams;
-        const char    *lang   = ngrams_8859_1[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_1);
+    for (l = 0; l < languageCount; l++) {
+        int32_t hitCount = 0;
+
+        for (int32_t i = 0; i < mergedLength; i++) {
+            if (mergedLanguages[i] & ((uint32_t)1 << l)) {
+                hitCount += mergedHits[i];
+            }
+        }
+
+        int32_t confidence = NGramParser::getConfidence(hitCount, ngramCount);
         if (confidence > bestConfidenceSoFar) {
-            results->set(textIn, this, confidence, name, lang);
+            results->set(textIn, recognizer, confidence, name, languages[l].lang);
             bestConfidenceSoFar = confidence;
         }
     }
     return (bestConfidenceSoFar > 0);
 }
 
+CharsetRecog_8859_1::~CharsetRecog_8859_1()
+{
+    // nothing to do
+}
+
+UBool CharsetRecog_8859_1::match(InputText *textIn, CharsetMatch *results) const {
+    const char *name = textIn->fC1Bytes? "windows-1252" : "ISO-8859-1";
+    return match_languages(this, textIn, results, name, ngrams_8859_1, UPRV_LENGTHOF(ngrams_8859_1), charMap_8859_1);
+}
+
 const char *CharsetRecog_8859_1::getName() const
 {
     return "ISO-8859-1";
@@ -918,18 +1027,7 @@ CharsetRecog_8859_2::~CharsetRecog_8859_2()
 
 UBool CharsetRecog_8859_2::match(InputText *textIn, CharsetMatch *results) const {
     const char *name = textIn->fC1Bytes? "windows-1250" : "ISO-8859-2";
-    uint32_t i;
-    int32_t bestConfidenceSoFar = -1;
-    for (i=0; i < UPRV_LENGTHOF(ngrams_8859_2) ; i++) {
-        const int32_t *ngrams = ngrams_8859_2[i].ngrams;
-        const char    *lang   = ngrams_8859_2[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_2);
-        if (confidence > bestConfidenceSoFar) {
-            results->set(textIn, this, confidence, name, lang);
-            bestConfidenceSoFar = confidence;
-        }
-    }
-    return (bestConfidenceSoFar > 0);
+    return match_languages(this, textIn, results, name, ngrams_8859_2, UPRV_LENGTHOF(ngrams_8859_2), charMap_8859_2);
 }
 
 const char *CharsetRecog_8859_2::getName() const
@@ -23,6 +23,8 @@ class NGramParser : public UMemory
 private:
     int32_t ngram;
     const int32_t *ngramList;    
+    int32_t ngramListLength;
+    int32_t *listHits;          // If not NULL, hits are counted per ngramList entry here.
 
     int32_t ngramCount;
     int32_t hitCount;
@@ -35,6 +37,12 @@ class NGramParser : public UMemory
 
 public:
     NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap);
+    /*
+    * A parser for a sorted ngram list of any length, which counts the hits
+    * for each list entry in theListHits[] (not zeroed here) so that several
+    * languages can be scored from a single pass over the input.
+    */
+    NGramParser(const int32_t *theNgramList, int32_t theListLength, int32_t *theListHits, const uint8_t *theCharMap);
     virtual ~NGramParser();
 
 private:
@@ -51,6 +59,17 @@ class NGramParser : public UMemory
 public:
     int32_t parse(InputText *det);
 
+    /*
+    * Parse the input with a parser that counts hits per list entry.
+    * Returns the total number of ngrams.
+    */
+    int32_t parseCounts(InputText *det);
+
+    /*
+    * The confidence that parse() returns for the given counts.
+    */
+    static int32_t getConfidence(int32_t hitCount, int32_t ngramCount);
+
 };
 
 #if !UCONFIG_ONLY_HTML_CONVERSION
@@ -14,6 +14,8 @@
 #include "csrucode.h"
 #include "csmatch.h"
 
+#include <string.h>
+
 U_NAMESPACE_BEGIN
 
 CharsetRecog_Unicode::~CharsetRecog_Unicode()
@@ -122,27 +124,50 @@ CharsetRecog_UTF_32::~CharsetRecog_UTF_32()
 
 UBool CharsetRecog_UTF_32::match(InputText* textIn, CharsetMatch *results) const
 {
-    const uint8_t *input = textIn->fRawInput;
-    int32_t limit = (textIn->fRawLength / 4) * 4;
-    int32_t numValid = 0;
-    int32_t numInvalid = 0;
-    bool hasBOM = FALSE;
-    int32_t confidence = 0;
+    RawScanState state;
 
-    if (limit > 0 && getChar(input, 0) == 0x0000FEFFUL) {
-        hasBOM = TRUE;
+    scan(state, textIn->fRawInput, 0, textIn->fRawLength, TRUE);
+    return matchScanned(textIn, state, results);
+}
+
+UBool CharsetRecog_UTF_32::scan(RawScanState &state, const uint8_t *input, int32_t windowStart,
+                                int32_t windowLength, UBool /*final*/) const
+{
+    int32_t i = state.resumeIndex - windowStart;
+    // A partial code unit at the end is either completed by the next piece or ignored.
+    int32_t limit = i + ((windowLength - i) / 4) * 4;
+
+    // Every code point up to U+10FFFF has a zero high byte,
+    //   so without any 0x00 bytes all of the code units are invalid.
+    if (memchr(input + i, 0, limit - i) == NULL) {
+        state.numInvalid += (limit - i) / 4;
+        i = limit;
     }
 
-    for(int32_t i = 0; i < limit; i += 4) {
+    for(; i < limit; i += 4) {
         int32_t ch = getChar(input, i);
 
         if (ch < 0 || ch >= 0x10FFFF || (ch >= 0xD800 && ch <= 0xDFFF)) {
-            numInvalid += 1;
+            state.numInvalid += 1;
         } else {
-            numValid += 1;
+            state.numValid += 1;
         }
     }
 
+    state.resumeIndex = windowStart + i;
+    return TRUE;
+}
+
+UBool CharsetRecog_UTF_32::matchScanned(InputText* textIn, const RawScanState &state, CharsetMatch *results) const
+{
+    int32_t numValid = state.numValid;
+    int32_t numInvalid = state.numInvalid;
+    bool hasBOM = FALSE;
+    int32_t confidence = 0;
+
+    if (textIn->fRawLength >= 4 && getChar(textIn->fRawInput, 0) == 0x0000FEFFUL) {
+        hasBOM = TRUE;
+    }
 
     // Cook up some sort of confidence score, based on presense of a BOM
     //    and the existence of valid and/or invalid multi-byte sequences.
@@ -75,6 +75,11 @@ class CharsetRecog_UTF_32 : public CharsetRecog_Unicode
     const char* getName() const = 0;
 
     UBool match(InputText* textIn, CharsetMatch *results) const;
+
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText* textIn, const RawScanState &state, CharsetMatch *results) const;
 };
 
 
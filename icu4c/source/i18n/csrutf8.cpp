@@ -13,6 +13,7 @@
 
 #include "csrutf8.h"
 #include "csmatch.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -27,25 +28,31 @@ const char *CharsetRecog_UTF8::getName() const
 }
 
 UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
-    bool hasBOM = FALSE;
-    int32_t numValid = 0;
-    int32_t numInvalid = 0;
-    const uint8_t *inputBytes = input->fRawInput;
-    int32_t i;
+    RawScanState state;
+
+    // Start after the leading ASCII that InputText has already measured.
+    state.resumeIndex = input->fRawASCIILength;
+    scan(state, input->fRawInput, 0, input->fRawLength, TRUE);
+
+    return matchScanned(input, state, results);
+}
+
+UBool CharsetRecog_UTF8::scan(RawScanState &state, const uint8_t *inputBytes, int32_t windowStart,
+                              int32_t windowLength, UBool final) const {
+    int32_t i = state.resumeIndex - windowStart;
     int32_t trailBytes = 0;
-    int32_t confidence;
 
-    if (input->fRawLength >= 3 && 
-        inputBytes[0] == 0xEF && inputBytes[1] == 0xBB && inputBytes[2] == 0xBF) {
-            hasBOM = TRUE;
-    }
+    // Unless this is the end of the input, only start sequences that end in the window.
+    int32_t startLimit = final ? windowLength : windowLength - 3;
 
     // Scan for multi-byte sequences
-    for (i=0; i < input->fRawLength; i += 1) {
+    while (i < startLimit) {
         int32_t b = inputBytes[i];
 
         if ((b & 0x80) == 0) {
-            continue;   // ASCII
+            // ASCII; skip the rest of this run in one go.
+            i += usimd_asciiPrefixLength(inputBytes + i, windowLength - i);
+            continue;
         }
 
         // Hi bit on char found.  Figure out how long the sequence should be
@@ -56,7 +63,8 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
         } else if ((b & 0x0F8) == 0xF0) {
             trailBytes = 3;
         } else {
-            numInvalid += 1;
+            state.numInvalid += 1;
+            i += 1;
             continue;
         }
 
@@ -64,23 +72,45 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
         for (;;) {
             i += 1;
 
-            if (i >= input->fRawLength) {
+            if (i >= windowLength) {
                 break;
             }
 
             b = inputBytes[i];
 
             if ((b & 0xC0) != 0x080) {
-                numInvalid += 1;
+                state.numInvalid += 1;
                 break;
             }
 
             if (--trailBytes == 0) {
-                numValid += 1;
+                state.numValid += 1;
                 break;
             }
         }
 
+        // Continue after the sequence, or after the byte that ended it early.
+        i += 1;
+    }
+
+    if (i > windowLength) {
+        i = windowLength;
+    }
+
+    state.resumeIndex = windowStart + i;
+    return TRUE;
+}
+
+UBool CharsetRecog_UTF8::matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const {
+    bool hasBOM = FALSE;
+    const uint8_t *inputBytes = input->fRawInput;
+    int32_t numValid = state.numValid;
+    int32_t numInvalid = state.numInvalid;
+    int32_t confidence;
+
+    if (input->fRawLength >= 3 && 
+        inputBytes[0] == 0xEF && inputBytes[1] == 0xBB && inputBytes[2] == 0xBF) {
+            hasBOM = TRUE;
     }
 
     // Cook up some sort of confidence score, based on presence of a BOM
@@ -35,6 +35,11 @@ class CharsetRecog_UTF8: public CharsetRecognizer {
      * @see com.ibm.icu.text.CharsetRecognizer#match(com.ibm.icu.text.CharsetDetector)
      */
     UBool match(InputText *input, CharsetMatch *results) const;
+
+    UBool scan(RawScanState &state, const uint8_t *window, int32_t windowStart,
+               int32_t windowLength, UBool final) const;
+
+    UBool matchScanned(InputText *input, const RawScanState &state, CharsetMatch *results) const;
 	
 };
 
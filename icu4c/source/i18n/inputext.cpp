@@ -15,6 +15,7 @@
 
 #include "cmemory.h"
 #include "cstring.h"
+#include "usimd.h"
 
 #include <string.h>
 
@@ -32,7 +33,17 @@ InputText::InputText(UErrorCode &status)
                                                  //   Value is percent, not absolute.
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fRawASCIILength(0),
+      fTextLength(0),
+      fTailLength(0),
+      fIncremental(FALSE),
+      fPrefixBytes(NULL),
+      fStrippedBytes(NULL),
+      fStrippedLength(0),
+      fInMarkup(FALSE),
+      fOpenTags(0),
+      fBadTags(0)
 {
     if (fInputBytes == NULL || fByteStats == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -44,6 +55,8 @@ InputText::~InputText()
     DELETE_ARRAY(fDeclaredEncoding);
     DELETE_ARRAY(fByteStats);
     DELETE_ARRAY(fInputBytes);
+    DELETE_ARRAY(fPrefixBytes);
+    DELETE_ARRAY(fStrippedBytes);
 }
 
 void InputText::setText(const char *in, int32_t len)
@@ -52,6 +65,72 @@ void InputText::setText(const char *in, int32_t len)
     fC1Bytes   = FALSE;
     fRawInput  = (const uint8_t *) in;
     fRawLength = len == -1? (int32_t)uprv_strlen(in) : len;
+    fRawASCIILength = 0;
+    fTextLength = fRawLength;
+    fIncremental = FALSE;
+}
+
+void InputText::startText(UErrorCode &status)
+{
+    if (fPrefixBytes == NULL) {
+        fPrefixBytes = NEW_ARRAY(uint8_t, BUFFER_SIZE);
+        fStrippedBytes = NEW_ARRAY(uint8_t, BUFFER_SIZE);
+
+        if (fPrefixBytes == NULL || fStrippedBytes == NULL) {
+            DELETE_ARRAY(fPrefixBytes);
+            DELETE_ARRAY(fStrippedBytes);
+            fPrefixBytes = fStrippedBytes = NULL;
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+
+    fInputLen  = 0;
+    fC1Bytes   = FALSE;
+    fRawInput  = fPrefixBytes;
+    fRawLength = 0;
+    fRawASCIILength = 0;
+    fTextLength = 0;
+    fTailLength = 0;
+    fIncremental = TRUE;
+
+    fStrippedLength = 0;
+    fInMarkup = FALSE;
+    fOpenTags = fBadTags = 0;
+}
+
+void InputText::appendText(const uint8_t *in, int32_t len)
+{
+    if (fRawLength < BUFFER_SIZE) {
+        int32_t prefixLength = BUFFER_SIZE - fRawLength;
+
+        if (prefixLength > len) {
+            prefixLength = len;
+        }
+
+        uprv_memcpy(fPrefixBytes + fRawLength, in, prefixLength);
+        fRawLength += prefixLength;
+    }
+
+    stripMarkup(in, len, fStrippedBytes);
+
+    // Keep the last up to 3 bytes of the old tail and the new piece.
+    if (len >= 3) {
+        uprv_memcpy(fTail, in + len - 3, 3);
+        fTailLength = 3;
+    } else {
+        for (int32_t i = 0; i < len; i += 1) {
+            if (fTailLength == 3) {
+                fTail[0] = fTail[1];
+                fTail[1] = fTail[2];
+                fTailLength = 2;
+            }
+
+            fTail[fTailLength++] = in[i];
+        }
+    }
+
+    fTextLength += len;
 }
 
 void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
@@ -73,6 +152,39 @@ UBool InputText::isSet() const
     return fRawInput != NULL;
 }
 
+/*
+ * html / xml markup stripping.
+ *    quick and dirty, not 100% accurate, but hopefully good enough, statistically.
+ *    discard everything within < brackets >
+ *    Count how many total '<' and illegal (nested) '<' occur, so we can make some
+ *    guess as to whether the input was actually marked up at all.
+ * Continues from where the previous call left off, until dest holds BUFFER_SIZE bytes.
+ * TODO: Think about how this interacts with EBCDIC charsets that are detected.
+ */
+void InputText::stripMarkup(const uint8_t *in, int32_t len, uint8_t *dest)
+{
+    for (int32_t srci = 0; srci < len && fStrippedLength < BUFFER_SIZE; srci += 1) {
+        uint8_t b = in[srci];
+
+        if (b == (uint8_t)0x3C) { /* Check for the ASCII '<' */
+            if (fInMarkup) {
+                fBadTags += 1;
+            }
+
+            fInMarkup = TRUE;
+            fOpenTags += 1;
+        }
+
+        if (! fInMarkup) {
+            dest[fStrippedLength++] = b;
+        }
+
+        if (b == (uint8_t)0x3E) { /* Check for the ASCII '>' */
+            fInMarkup = FALSE;
+        }
+    }
+}
+
 /**
 *  MungeInput - after getting a set of raw input data to be analyzed, preprocess
 *               it by removing what appears to be html markup.
@@ -81,42 +193,23 @@ UBool InputText::isSet() const
 */
 void InputText::MungeInput(UBool fStripTags) {
     int     srci = 0;
-    int     dsti = 0;
-    uint8_t b;
-    bool    inMarkup = FALSE;
     int32_t openTags = 0;
     int32_t badTags  = 0;
 
-    //
-    //  html / xml markup stripping.
-    //     quick and dirty, not 100% accurate, but hopefully good enough, statistically.
-    //     discard everything within < brackets >
-    //     Count how many total '<' and illegal (nested) '<' occur, so we can make some
-    //     guess as to whether the input was actually marked up at all.
-    // TODO: Think about how this interacts with EBCDIC charsets that are detected.
     if (fStripTags) {
-        for (srci = 0; srci < fRawLength && dsti < BUFFER_SIZE; srci += 1) {
-            b = fRawInput[srci];
-
-            if (b == (uint8_t)0x3C) { /* Check for the ASCII '<' */
-                if (inMarkup) {
-                    badTags += 1;
-                }
-
-                inMarkup = TRUE;
-                openTags += 1;
-            }
-
-            if (! inMarkup) {
-                fInputBytes[dsti++] = b;
-            }
-
-            if (b == (uint8_t)0x3E) { /* Check for the ASCII '>' */
-                inMarkup = FALSE;
-            }
+        if (fIncremental) {
+            // The pieces were stripped as they were appended.
+            uprv_memcpy(fInputBytes, fStrippedBytes, fStrippedLength);
+        } else {
+            fStrippedLength = 0;
+            fInMarkup = FALSE;
+            fOpenTags = fBadTags = 0;
+            stripMarkup(fRawInput, fRawLength, fInputBytes);
         }
 
-        fInputLen = dsti;
+        fInputLen = fStrippedLength;
+        openTags = fOpenTags;
+        badTags = fBadTags;
     }
 
     //
@@ -125,7 +218,7 @@ void InputText::MungeInput(UBool fStripTags) {
     //    Detection will have to work on the unstripped input.
     //
     if (openTags<5 || openTags/5 < badTags || 
-        (fInputLen < 100 && fRawLength>600))
+        (fInputLen < 100 && fTextLength>600))
     {
         int32_t limit = fRawLength;
 
@@ -143,12 +236,27 @@ void InputText::MungeInput(UBool fStripTags) {
     //
     // Tally up the byte occurence statistics.
     // These are available for use by the various detectors.
+    // Four interleaved sub-histograms keep consecutive increments of the same
+    //   counter (runs of spaces, or of one script's lead bytes) from waiting
+    //   on each other's stores.
     //
 
-    uprv_memset(fByteStats, 0, (sizeof fByteStats[0]) * 256);
+    uint16_t counts[4][256];
+    uprv_memset(counts, 0, sizeof(counts));
 
-    for (srci = 0; srci < fInputLen; srci += 1) {
-        fByteStats[fInputBytes[srci]] += 1;
+    for (srci = 0; srci + 4 <= fInputLen; srci += 4) {
+        counts[0][fInputBytes[srci]] += 1;
+        counts[1][fInputBytes[srci + 1]] += 1;
+        counts[2][fInputBytes[srci + 2]] += 1;
+        counts[3][fInputBytes[srci + 3]] += 1;
+    }
+
+    for (; srci < fInputLen; srci += 1) {
+        counts[0][fInputBytes[srci]] += 1;
+    }
+
+    for (int32_t i = 0; i < 256; i += 1) {
+        fByteStats[i] = (int16_t)(counts[0][i] + counts[1][i] + counts[2][i] + counts[3][i]);
     }
 
     for (int32_t i = 0x80; i <= 0x9F; i += 1) {
@@ -157,6 +265,11 @@ void InputText::MungeInput(UBool fStripTags) {
             break;
         }
     }
+
+    //
+    // The leading ASCII of the raw input, which can be much longer than fInputBytes.
+    //
+    fRawASCIILength = usimd_asciiPrefixLength(fRawInput, fRawLength);
 }
 
 U_NAMESPACE_END
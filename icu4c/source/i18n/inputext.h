@@ -38,6 +38,14 @@ class InputText : public UMemory
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
 
+    // Incremental input: startText() begins an empty text, appendText() adds to it.
+    //   Only the first BUFFER_SIZE bytes are kept, in fRawInput, together with the
+    //   markup-stripped sample and the last few bytes (fTail). The recognizers that
+    //   walk the whole raw input scan each piece as it arrives; see CharsetRecognizer::scan().
+    void startText(UErrorCode &status);
+    void appendText(const uint8_t *in, int32_t len);
+    UBool isIncremental() const { return fIncremental; }
+
     // The text to be checked.  Markup will have been
     //   removed if appropriate.
     uint8_t    *fInputBytes;
@@ -55,6 +63,29 @@ class InputText : public UMemory
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
 
+    // Statistics over the whole raw input, computed once by MungeInput()
+    //   so that the recognizers which walk fRawInput can skip work that
+    //   cannot change their result.
+    int32_t                  fRawASCIILength; // Length of the leading run of bytes < 0x80 in fRawInput.
+                                              //   Equal to fRawLength for 7-bit input.
+
+    // Incremental input. fRawInput then points to fPrefixBytes.
+    int32_t                  fTextLength;     // Length of all of the text appended so far.
+    uint8_t                  fTail[3];        // The last up to 3 bytes of the text, which may
+    int32_t                  fTailLength;     //   hold a character that continues in the next piece.
+
+private:
+    void stripMarkup(const uint8_t *in, int32_t len, uint8_t *dest);
+
+    UBool     fIncremental;
+    uint8_t  *fPrefixBytes;      // The first BUFFER_SIZE bytes of incremental input.
+    uint8_t  *fStrippedBytes;    // Incremental input with markup removed, up to BUFFER_SIZE bytes.
+
+    // State of markup stripping, which continues from one piece of input to the next.
+    int32_t   fStrippedLength;
+    UBool     fInMarkup;
+    int32_t   fOpenTags;
+    int32_t   fBadTags;
 };
 
 U_NAMESPACE_END
@@ -62,6 +62,16 @@ ucsdet_setText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCo
     ((CharsetDetector *) ucsd)->setText(textIn, len);
 }
 
+U_CAPI void U_EXPORT2
+ucsdet_appendText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->appendText(textIn, len, *status);
+}
+
 U_CAPI const char * U_EXPORT2
 ucsdet_getName(const UCharsetMatch *ucsm, UErrorCode *status)
 {
@@ -170,6 +180,26 @@ ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter)
     return prev;
 }
 
+U_CAPI void U_EXPORT2
+ucsdet_setConfidenceThreshold(UCharsetDetector *ucsd, int32_t threshold, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->setConfidenceThreshold(threshold, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucsdet_getConfidenceThreshold(const UCharsetDetector *ucsd)
+{
+    if (ucsd == NULL) {
+        return 0;
+    }
+
+    return ((CharsetDetector *) ucsd)->getConfidenceThreshold();
+}
+
 U_CAPI  int32_t U_EXPORT2
 ucsdet_getUChars(const UCharsetMatch *ucsm,
                  UChar *buf, int32_t cap, UErrorCode *status)
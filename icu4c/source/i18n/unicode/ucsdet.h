@@ -127,6 +127,32 @@ U_NAMESPACE_END
 U_STABLE void U_EXPORT2
 ucsdet_setText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  * Append a piece of input byte data whose charset is to be detected,
+  * for input that arrives incrementally, such as from a network stream.
+  * The first call starts new input text; ucsdet_setText() ends incremental input.
+  *
+  * Unlike with ucsdet_setText(), the charset detector does not refer to
+  * the caller's buffer after this function returns, so it may be reused
+  * for the next piece. The UTF-8, UTF-32 and multi-byte recognizers take
+  * every piece into account. The others, and ucsdet_getUChars(), use only
+  * the first 8 kB of the input, which is retained by the charset detector.
+  *
+  * ucsdet_detect() and ucsdet_detectAll() may be called between pieces
+  * to get a best guess for the input so far.
+  *
+  * @param ucsd   the charset detector to be used.
+  * @param textIn the next piece of the input text of unknown encoding.
+  * @param len    the length of the piece, or -1 if it is NUL terminated.
+  * @param status any error conditions are reported back in this variable.
+  *
+  * @draft ICU 63
+  */
+U_CAPI void U_EXPORT2
+ucsdet_appendText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Set the declared encoding for charset detection.
  *  The declared encoding of an input text is an encoding obtained
@@ -379,6 +405,40 @@ ucsdet_isInputFilterEnabled(const UCharsetDetector *ucsd);
 U_STABLE  UBool U_EXPORT2
 ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Set a confidence threshold for the detection.
+ * ucsdet_detect() and ucsdet_detectAll() normally run every charset recognizer
+ * over the input. With a threshold, they stop as soon as one match reaches it
+ * and report only the matches found so far.
+ *
+ * The recognizers run in a fixed order (Unicode charsets first), so a charset
+ * that would have been tried later, even with a higher confidence, is not reported.
+ * This is useful for large inputs where any sufficiently confident answer will do.
+ *
+ * @param ucsd      the charset detector to be modified.
+ * @param threshold a confidence value from 1 to 100, or 0 (the default)
+ *                  to always run all recognizers.
+ * @param status    any error conditions are reported back in this variable.
+ *                  U_ILLEGAL_ARGUMENT_ERROR if the threshold is out of range.
+ *
+ * @draft ICU 63
+ */
+U_CAPI void U_EXPORT2
+ucsdet_setConfidenceThreshold(UCharsetDetector *ucsd, int32_t threshold, UErrorCode *status);
+
+/**
+ * Get the confidence threshold of this charset detector.
+ *
+ * @param ucsd the charset detector to check.
+ * @return the threshold set with ucsdet_setConfidenceThreshold(), or 0.
+ *
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+ucsdet_getConfidenceThreshold(const UCharsetDetector *ucsd);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Get an iterator over the set of detectable charsets -
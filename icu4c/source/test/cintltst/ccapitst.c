@@ -22,6 +22,7 @@
 #include "unicode/ucnv.h"
 #include "unicode/ucnv_err.h"
 #include "unicode/putil.h"
+#include "unicode/udata.h"
 #include "unicode/uset.h"
 #include "unicode/ustring.h"
 #include "unicode/utf8.h"
@@ -69,6 +70,8 @@ static void TestEBCDICSwapLFNL(void);
 static void TestConvertEx(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
+static void TestConvertExDirect(void);
+static void TestConvertExDirectMBCS(void);
 static void TestConvertAlgorithmic(void);
        void TestDefaultConverterError(void);    /* defined in cctest.c */
        void TestDefaultConverterSet(void);    /* defined in cctest.c */
@@ -80,6 +83,7 @@ static void TestSubstString(void);
 static void InvalidArguments(void);
 static void TestGetName(void);
 static void TestUTFBOM(void);
+static void TestAcquireRelease(void);
 
 void addTestConvert(TestNode** root);
 
@@ -104,6 +108,8 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertEx,               "tsconv/ccapitst/TestConvertEx");
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
+    addTest(root, &TestConvertExDirect,         "tsconv/ccapitst/TestConvertExDirect");
+    addTest(root, &TestConvertExDirectMBCS,     "tsconv/ccapitst/TestConvertExDirectMBCS");
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
     addTest(root, &TestDefaultConverterError,   "tsconv/ccapitst/TestDefaultConverterError");
     addTest(root, &TestDefaultConverterSet,     "tsconv/ccapitst/TestDefaultConverterSet");
@@ -117,6 +123,7 @@ void addTestConvert(TestNode** root)
     addTest(root, &InvalidArguments,            "tsconv/ccapitst/InvalidArguments");
     addTest(root, &TestGetName,                 "tsconv/ccapitst/TestGetName");
     addTest(root, &TestUTFBOM,                  "tsconv/ccapitst/TestUTFBOM");
+    addTest(root, &TestAcquireRelease,          "tsconv/ccapitst/TestAcquireRelease");
 }
 
 static void ListNames(void) {
@@ -2639,6 +2646,8 @@ static void TestConvertExFromUTF8() {
 #endif
         "us-ascii",
         "iso-8859-1",
+        "utf-16be",
+        "utf-16le",
         "utf-8"
     };
 
@@ -2674,6 +2683,163 @@ static void TestConvertExFromUTF8() {
     ucnv_close(utf8Cnv);
 }
 
+/*
+ * Test the direct (pivot-less) ucnv_convertEx() paths between UTF-8 and
+ * UTF-16BE/LE and from ISO-8859-1 to UTF-8, with ASCII runs long enough
+ * for bulk processing and with characters split across buffer boundaries.
+ */
+static void TestConvertExDirect() {
+    static const char *const converterNames[]={
+        "utf-16be",
+        "utf-16le",
+        "UnicodeBig",
+        "iso-8859-1"
+    };
+    UChar text[200];
+    int32_t textLength, latin1Length, i, j;
+    char utf8[600], other[600], testName[64];
+    int32_t utf8Length, otherLength;
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+
+    /* ASCII runs of varying lengths, separated by non-ASCII characters */
+    textLength=0;
+    for(i=0; i<8; ++i) {
+        for(j=0; j<=i*5; ++j) {
+            text[textLength++]=(UChar)(0x41+j%26);
+        }
+        text[textLength++]=(UChar)(0xa0+i);
+    }
+    latin1Length=textLength;
+    text[textLength++]=0x4e00;
+    text[textLength++]=0x7ff;
+    text[textLength++]=0xd800+1;  /* U+10400 */
+    text[textLength++]=0xdc00;
+    text[textLength++]=0x61;
+    text[textLength++]=0xfffd;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+    for(i=0; i<UPRV_LENGTHOF(converterNames); ++i) {
+        int32_t length=i==UPRV_LENGTHOF(converterNames)-1 ? latin1Length : textLength;
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(converterNames[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", converterNames[i], u_errorName(errorCode));
+            continue;
+        }
+        utf8Length=ucnv_fromUChars(utf8Cnv, utf8, (int32_t)sizeof(utf8), text, length, &errorCode);
+        otherLength=ucnv_fromUChars(cnv, other, (int32_t)sizeof(other), text, length, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to convert test text to %s - %s\n", converterNames[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        /* ucnv_fromUChars() resets, the streaming tests reset too */
+        strcpy(testName, "UTF-8 to ");
+        strcat(testName, converterNames[i]);
+        convertExMultiStreaming(utf8Cnv, cnv, utf8, utf8Length, other, otherLength, testName, U_ZERO_ERROR);
+        convertExStreaming(utf8Cnv, cnv, utf8, utf8Length, other, otherLength, 100, testName, U_ZERO_ERROR);
+        strcpy(testName, converterNames[i]);
+        strcat(testName, " to UTF-8");
+        convertExMultiStreaming(cnv, utf8Cnv, other, otherLength, utf8, utf8Length, testName, U_ZERO_ERROR);
+        convertExStreaming(cnv, utf8Cnv, other, otherLength, utf8, utf8Length, 100, testName, U_ZERO_ERROR);
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+}
+
+/*
+ * Test the direct ucnv_convertEx() paths between UTF-8 and MBCS converters:
+ * multi-byte, EUC, SI/SO-stateful and GB 18030 tables,
+ * mixing roundtrip mappings with characters that are handled by
+ * extension tables, fallbacks or substitution in the pivoting code.
+ */
+static void TestConvertExDirectMBCS() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const char *const converterNames[]={
+        "shift-jis",
+        "euc-jp",
+        "euc-kr",
+        "big5",
+        "gb18030",
+        "ibm-930",
+        "ibm-1363",
+        "windows-1252"
+    };
+    static const UChar chars[]={
+        0x3042, 0x4e00, 0x65e5, 0xac00, 0x5927, 0xff71, 0x00e9, 0x20ac, 0x0080, 0xffe4
+    };
+    UChar text[300], back[600];
+    int32_t textLength, backLength, i, j;
+    char utf8[1200], other[1200], testName[64];
+    int32_t utf8Length, otherLength;
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+
+    /* ASCII runs of varying lengths, separated by non-ASCII characters */
+    textLength=0;
+    for(i=0; i<20; ++i) {
+        for(j=0; j<i%7; ++j) {
+            text[textLength++]=(UChar)(0x61+j);
+        }
+        text[textLength++]=chars[i%UPRV_LENGTHOF(chars)];
+        if(i%4==3) {
+            text[textLength++]=chars[(i+3)%UPRV_LENGTHOF(chars)];
+        }
+    }
+    text[textLength++]=0xd801;  /* U+10400 */
+    text[textLength++]=0xdc00;
+    text[textLength++]=0x0a;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+    for(i=0; i<UPRV_LENGTHOF(converterNames); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(converterNames[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", converterNames[i], u_errorName(errorCode));
+            continue;
+        }
+        /* reference results via UTF-16, with substitution for unmappable characters */
+        utf8Length=ucnv_fromUChars(utf8Cnv, utf8, (int32_t)sizeof(utf8), text, textLength, &errorCode);
+        otherLength=ucnv_fromUChars(cnv, other, (int32_t)sizeof(other), text, textLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to convert test text to %s - %s\n", converterNames[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+        strcpy(testName, "UTF-8 to ");
+        strcat(testName, converterNames[i]);
+        convertExMultiStreaming(utf8Cnv, cnv, utf8, utf8Length, other, otherLength, testName, U_ZERO_ERROR);
+        convertExStreaming(utf8Cnv, cnv, utf8, utf8Length, other, otherLength, 100, testName, U_ZERO_ERROR);
+
+        backLength=ucnv_toUChars(cnv, back, UPRV_LENGTHOF(back), other, otherLength, &errorCode);
+        utf8Length=ucnv_fromUChars(utf8Cnv, utf8, (int32_t)sizeof(utf8), back, backLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to convert test text from %s - %s\n", converterNames[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+        strcpy(testName, converterNames[i]);
+        strcat(testName, " to UTF-8");
+        convertExMultiStreaming(cnv, utf8Cnv, other, otherLength, utf8, utf8Length, testName, U_ZERO_ERROR);
+        convertExStreaming(cnv, utf8Cnv, other, otherLength, utf8, utf8Length, 100, testName, U_ZERO_ERROR);
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+#endif
+}
+
 static void TestConvertExFromUTF8_C5F0() {
     static const char *const converterNames[]={
 #if !UCONFIG_NO_LEGACY_CONVERSION
@@ -3738,3 +3904,162 @@ static void TestUTFBOM() {
         ucnv_close(cnv);
     }
 }
+
+/* Test the per-thread converter pool. */
+static void TestAcquireRelease(void) {
+    static const char *const names[]={
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "ibm-37,swaplfnl", "ibm-37", "Shift_JIS",
+#endif
+        "UTF-8", "UTF-16BE"
+    };
+    UConverter *cnv, *cnv2, *many[20];
+    UChar buffer[8], *target;
+    const char *source, *bytes="\xe4";
+    int32_t hits, misses, hits2, misses2, i;
+    UErrorCode errorCode;
+
+    ucnv_flushPool();
+    ucnv_getPoolStatistics(&hits, &misses);
+
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_acquire(names[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("ucnv_acquire(%s) failed - %s\n", names[i], u_errorName(errorCode));
+            continue;
+        }
+        /* leave the converter with a partial character */
+        source=bytes;
+        target=buffer;
+        ucnv_toUnicode(cnv, &target, buffer+UPRV_LENGTHOF(buffer), &source, bytes+1, NULL, FALSE, &errorCode);
+        ucnv_release(cnv);
+
+        cnv2=ucnv_acquire(names[i], &errorCode);
+        if(U_FAILURE(errorCode) || cnv2!=cnv) {
+            log_err("ucnv_acquire(%s) did not return the released converter - %s\n", names[i], u_errorName(errorCode));
+        }
+        if(ucnv_toUCountPending(cnv2, &errorCode)!=0) {
+            log_err("ucnv_acquire(%s) returned a converter that was not reset\n", names[i]);
+        }
+        ucnv_release(cnv2);
+    }
+    ucnv_getPoolStatistics(&hits2, &misses2);
+    if(hits2-hits!=misses2-misses) {
+        log_err("unexpected pool statistics: %d hits, %d misses\n", (int)(hits2-hits), (int)(misses2-misses));
+    }
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /* name-based options must match */
+    errorCode=U_ZERO_ERROR;
+    cnv=ucnv_acquire("ibm-37,swaplfnl", &errorCode);
+    cnv2=ucnv_acquire("ibm-37", &errorCode);
+    if(U_SUCCESS(errorCode)) {
+        if(cnv==cnv2 || uprv_strcmp(ucnv_getName(cnv, &errorCode), ucnv_getName(cnv2, &errorCode))==0) {
+            log_err("ucnv_acquire() mixed up ibm-37 with and without swaplfnl\n");
+        }
+    } else {
+        log_data_err("ucnv_acquire(ibm-37) failed - %s\n", u_errorName(errorCode));
+    }
+    ucnv_release(cnv);
+    ucnv_release(cnv2);
+#endif
+
+    /* the pool is bounded: releasing many converters keeps only some of them */
+    errorCode=U_ZERO_ERROR;
+    for(i=0; i<UPRV_LENGTHOF(many); ++i) {
+        many[i]=ucnv_acquire("UTF-16BE", &errorCode);
+    }
+    for(i=0; i<UPRV_LENGTHOF(many); ++i) {
+        ucnv_release(many[i]);
+    }
+    ucnv_getPoolStatistics(&hits, &misses);
+    for(i=0; i<UPRV_LENGTHOF(many); ++i) {
+        many[i]=ucnv_acquire("UTF-16BE", &errorCode);
+    }
+    ucnv_getPoolStatistics(&hits2, &misses2);
+    if(U_FAILURE(errorCode) || hits2==hits || misses2==misses) {
+        log_err("expected some pool hits and misses for more converters than the pool holds - %s\n",
+                u_errorName(errorCode));
+    }
+    for(i=0; i<UPRV_LENGTHOF(many); ++i) {
+        ucnv_close(many[i]);
+    }
+
+    /* converters with changed settings are closed rather than pooled */
+    ucnv_flushPool();
+    for(i=0; i<3; ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_acquire("UTF-8", &errorCode);
+        if(i==0) {
+            ucnv_setSubstChars(cnv, "?", 1, &errorCode);
+        } else if(i==1) {
+            ucnv_setFallback(cnv, TRUE);
+        } else {
+            ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+        }
+        ucnv_release(cnv);
+        ucnv_getPoolStatistics(&hits, &misses);
+        cnv=ucnv_acquire("UTF-8", &errorCode);
+        ucnv_getPoolStatistics(&hits2, &misses2);
+        if(U_FAILURE(errorCode) || hits2!=hits) {
+            log_err("ucnv_release() pooled a modified converter (case %d) - %s\n",
+                    (int)i, u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+    }
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /*
+     * A converter from a package reports the same name as the standard one.
+     * It must not be pooled and then returned for the standard name.
+     */
+    ucnv_flushPool();
+    errorCode=U_ZERO_ERROR;
+    cnv=ucnv_acquire("ibm-37", &errorCode);
+    if(U_SUCCESS(errorCode)) {
+        const char *name=ucnv_getName(cnv, &errorCode);
+        UConverter *pkgCnv=ucnv_openPackage(U_ICUDATA_ALIAS, name, &errorCode);
+        if(U_SUCCESS(errorCode)) {
+            if(uprv_strcmp(ucnv_getName(pkgCnv, &errorCode), name)!=0) {
+                log_err("ucnv_openPackage(ICUDATA, %s) has a different name\n", name);
+            }
+            ucnv_release(cnv);
+            ucnv_release(pkgCnv);
+            cnv2=ucnv_acquire("ibm-37", &errorCode);
+            if(U_FAILURE(errorCode) || cnv2!=cnv) {
+                log_err("ucnv_acquire(ibm-37) after releasing a package converter "
+                        "did not return the standard one - %s\n", u_errorName(errorCode));
+            }
+            ucnv_release(cnv2);
+            ucnv_getPoolStatistics(&hits, &misses);
+            cnv2=ucnv_acquire("ibm-37", &errorCode);
+            cnv=ucnv_acquire("ibm-37", &errorCode);
+            ucnv_getPoolStatistics(&hits2, &misses2);
+            if(U_FAILURE(errorCode) || hits2!=hits+1 || misses2!=misses+1) {
+                log_err("ucnv_release() pooled a package converter - %s\n", u_errorName(errorCode));
+            }
+            ucnv_close(cnv);
+            ucnv_close(cnv2);
+        } else {
+            log_data_err("ucnv_openPackage(ICUDATA, %s) failed - %s\n", name, u_errorName(errorCode));
+            ucnv_close(cnv);
+        }
+    } else {
+        log_data_err("ucnv_acquire(ibm-37) failed - %s\n", u_errorName(errorCode));
+    }
+#endif
+
+    /* ucnv_flushPool() empties the pool */
+    ucnv_flushPool();
+    ucnv_getPoolStatistics(&hits, &misses);
+    cnv=ucnv_acquire("UTF-8", &errorCode);
+    ucnv_getPoolStatistics(&hits2, &misses2);
+    if(hits2!=hits || misses2!=misses+1) {
+        log_err("ucnv_acquire() after ucnv_flushPool() should be a miss\n");
+    }
+    ucnv_close(cnv);
+
+    ucnv_release(NULL);
+    ucnv_flushPool();
+}
@@ -15,6 +15,7 @@
 #include "uhash.h"
 #include "unicode/ctest.h"
 #include "unicode/ustring.h"
+#include "cmemory.h"
 #include "cstring.h"
 
 /**********************************************************************
@@ -24,6 +25,8 @@
 static void TestBasic(void);
 static void TestOtherAPI(void);
 static void hashIChars(void);
+static void TestLongKeyHashes(void);
+static void TestGroupProbing(void);
 
 static int32_t U_EXPORT2 U_CALLCONV hashChars(const UHashTok key);
 
@@ -89,6 +92,8 @@ void addHashtableTest(TestNode** root) {
     addTest(root, &TestBasic,   "tsutil/chashtst/TestBasic");
     addTest(root, &TestOtherAPI, "tsutil/chashtst/TestOtherAPI");
     addTest(root, &hashIChars, "tsutil/chashtst/hashIChars");
+    addTest(root, &TestLongKeyHashes, "tsutil/chashtst/TestLongKeyHashes");
+    addTest(root, &TestGroupProbing, "tsutil/chashtst/TestGroupProbing");
     
 }
 
@@ -312,6 +317,141 @@ static void hashIChars(void) {
     uhash_close(hash);
 }
 
+/**
+ * Long keys that differ in only one character must hash differently
+ * no matter where that character is.
+ * (The hash functions used to sample only about 32 characters of each key.)
+ */
+static void TestLongKeyHashes(void) {
+    char key[200], upperKey[200];
+    UChar ukey[200];
+    UHashTok tok, upperTok, utok;
+    int32_t codes[200], ucodes[200];
+    int32_t i, j, length;
+
+    tok.pointer = key;
+    upperTok.pointer = upperKey;
+    utok.pointer = ukey;
+    for (length = 40; length <= 160; length += 40) {
+        for (i = 0; i < length; ++i) {
+            uprv_memset(key, 'a', length);
+            key[i] = 'b';
+            key[length] = 0;
+            uprv_strcpy(upperKey, key);
+            upperKey[i] = 'B';
+            u_charsToUChars(key, ukey, length + 1);
+            codes[i] = uhash_hashChars(tok);
+            ucodes[i] = uhash_hashUChars(utok);
+            if (uhash_hashIChars(tok) != uhash_hashIChars(upperTok)) {
+                log_err("FAIL: uhash_hashIChars() differs for \"%s\" and \"%s\"\n", key, upperKey);
+            }
+            for (j = 0; j < i; ++j) {
+                if (codes[j] == codes[i] || ucodes[j] == ucodes[i]) {
+                    log_err("FAIL: length %d keys with 'b' at %d and %d hash the same\n",
+                            (int)length, (int)j, (int)i);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Hash function with few distinct values, so that equal control bytes
+ * spill over many groups.
+ */
+static int32_t U_EXPORT2 U_CALLCONV hashLongMod7(const UHashTok key) {
+    return key.integer % 7;
+}
+
+static void checkGroupProbing(UHashFunction *keyHash, int32_t size,
+                              enum UHashResizePolicy policy, int32_t n) {
+    UErrorCode status = U_ZERO_ERROR;
+    UHashtable *hash;
+    int32_t i, pos, count;
+    const UHashElement *e;
+
+    hash = uhash_openSizeWithFlags(keyHash, uhash_compareLong, NULL,
+                                   size, UHASH_GROUP_PROBING, &status);
+    if (U_FAILURE(status)) {
+        log_err("FAIL: uhash_openSizeWithFlags() failed - %s\n", u_errorName(status));
+        return;
+    }
+    uhash_setResizePolicy(hash, policy);
+    for (i = 0; i < n; ++i) {
+        uhash_iputi(hash, i, 2 * i + 1, &status);
+    }
+    uhash_iputi(hash, 3, 1000, &status);
+    if (U_FAILURE(status) || uhash_count(hash) != n) {
+        log_err("FAIL: group probing n=%d: count %d after puts - %s\n",
+                (int)n, (int)uhash_count(hash), u_errorName(status));
+    }
+    for (i = 0; i < n; ++i) {
+        int32_t expected = i == 3 ? 1000 : 2 * i + 1;
+        if (uhash_igeti(hash, i) != expected) {
+            log_err("FAIL: group probing n=%d: get(%d)=%d != %d\n",
+                    (int)n, (int)i, (int)uhash_igeti(hash, i), (int)expected);
+        }
+    }
+    if (uhash_igeti(hash, n) != 0 || uhash_igeti(hash, -1) != 0) {
+        log_err("FAIL: group probing n=%d: found a key that was never put\n", (int)n);
+    }
+
+    /* Remove the even keys, then put some of them back. */
+    for (i = 0; i < n; i += 2) {
+        uhash_iremovei(hash, i);
+    }
+    for (i = 0; i < n; i += 4) {
+        uhash_iputi(hash, i, -i - 1, &status);
+    }
+    count = 0;
+    pos = UHASH_FIRST;
+    while ((e = uhash_nextElement(hash, &pos)) != NULL) {
+        int32_t key = e->key.integer;
+        int32_t expected = (key & 1) != 0 ? (key == 3 ? 1000 : 2 * key + 1) :
+                           (key & 3) == 0 ? -key - 1 : 0;
+        if (e->value.integer != expected) {
+            log_err("FAIL: group probing n=%d: iterated %d->%d != %d\n",
+                    (int)n, (int)key, (int)e->value.integer, (int)expected);
+        }
+        ++count;
+    }
+    if (count != uhash_count(hash)) {
+        log_err("FAIL: group probing n=%d: iterated over %d elements, count %d\n",
+                (int)n, (int)count, (int)uhash_count(hash));
+    }
+    for (i = 0; i < n; ++i) {
+        int32_t expected = (i & 1) != 0 ? (i == 3 ? 1000 : 2 * i + 1) :
+                           (i & 3) == 0 ? -i - 1 : 0;
+        if (uhash_igeti(hash, i) != expected) {
+            log_err("FAIL: group probing n=%d: get(%d)=%d != %d after removals\n",
+                    (int)n, (int)i, (int)uhash_igeti(hash, i), (int)expected);
+        }
+    }
+
+    uhash_removeAll(hash);
+    if (uhash_count(hash) != 0 || uhash_igeti(hash, 1) != 0) {
+        log_err("FAIL: group probing n=%d: not empty after uhash_removeAll()\n", (int)n);
+    }
+    uhash_iputi(hash, 5, 55, &status);
+    if (U_FAILURE(status) || uhash_igeti(hash, 5) != 55) {
+        log_err("FAIL: group probing n=%d: put after uhash_removeAll() failed\n", (int)n);
+    }
+    uhash_close(hash);
+}
+
+/**
+ * Exercise the UHASH_GROUP_PROBING layout with growth, shrinking,
+ * deletions and iteration, with well-distributed and with heavily
+ * colliding hash codes.
+ */
+static void TestGroupProbing(void) {
+    checkGroupProbing(uhash_hashLong, 0, U_GROW, 1000);
+    checkGroupProbing(uhash_hashLong, 0, U_GROW_AND_SHRINK, 5000);
+    checkGroupProbing(uhash_hashLong, 5, U_GROW_AND_SHRINK, 20);
+    checkGroupProbing(hashLongMod7, 0, U_GROW_AND_SHRINK, 300);
+    checkGroupProbing(hashLongMod7, 16, U_FIXED, 15);
+    checkGroupProbing(hashLongMod7, 64, U_FIXED, 60);
+}
 
 /**********************************************************************
  * uhash Callbacks
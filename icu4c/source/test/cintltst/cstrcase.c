@@ -18,6 +18,10 @@
 *   Test file for string casing C API functions.
 */
 
+/* Defines _XOPEN_SOURCE for access to POSIX functions.
+ * Must be before any other #includes. */
+#include "uposixdefs.h"
+
 #include <string.h>
 #include "unicode/utypes.h"
 #include "unicode/uchar.h"
@@ -30,6 +34,12 @@
 #include "ucasemap_imp.h"
 #include "ustr_imp.h"
 
+#if U_PLATFORM_IMPLEMENTS_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 /* test string case mapping functions --------------------------------------- */
 
 static void
@@ -713,6 +723,83 @@ TestCaseCompare(void) {
     }
 }
 
+/*
+ * u_strncasecmp() with n larger than the strings:
+ * Comparison must stop at the NUL and must not read past it.
+ * Where possible, the short string is placed right before an inaccessible page.
+ */
+static void
+TestCaseCompareShortNUL(void) {
+    static const UChar shortString[]={ 0x61, 0x42, 0 };    /* "aB" */
+    static const UChar longString[]={
+        0x41, 0x62, 0, 0x78, 0x79, 0x7a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+        0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0
+    };
+    static const uint32_t options[]={ U_FOLD_CASE_DEFAULT, U_FOLD_CASE_EXCLUDE_SPECIAL_I };
+    UChar *s1=NULL;
+    void *pages=NULL;
+    size_t pageSize=0;
+    int32_t i, result;
+
+#if U_PLATFORM_IMPLEMENTS_POSIX
+    {
+        int fd=open("/dev/zero", O_RDWR);
+        if(fd>=0) {
+            pageSize=(size_t)sysconf(_SC_PAGESIZE);
+            pages=mmap(NULL, 2*pageSize, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+        }
+    }
+    if(pages==MAP_FAILED) {
+        pages=NULL;
+    }
+    if(pages!=NULL) {
+        if(mprotect((char *)pages+pageSize, pageSize, PROT_NONE)==0) {
+            s1=(UChar *)((char *)pages+pageSize)-UPRV_LENGTHOF(shortString);
+        } else {
+            munmap(pages, 2*pageSize);
+            pages=NULL;
+        }
+    }
+#endif
+    if(s1==NULL) {
+        s1=(UChar *)uprv_malloc(sizeof(shortString));
+        if(s1==NULL) {
+            log_err("out of memory\n");
+            return;
+        }
+    }
+    u_memcpy(s1, shortString, UPRV_LENGTHOF(shortString));
+
+    for(i=0; i<UPRV_LENGTHOF(options); ++i) {
+        result=u_strncasecmp(s1, longString, 100, options[i]);
+        if(result!=0) {
+            log_err("error: u_strncasecmp(\"aB\", \"Ab\\0...\", 100, options[%d])=%ld instead of 0\n",
+                    (int)i, (long)result);
+        }
+        result=u_strncasecmp(longString, s1, 100, options[i]);
+        if(result!=0) {
+            log_err("error: u_strncasecmp(\"Ab\\0...\", \"aB\", 100, options[%d])=%ld instead of 0\n",
+                    (int)i, (long)result);
+        }
+        result=u_strncasecmp(s1, longString+3, 100, options[i]);
+        if(result>=0) {
+            log_err("error: u_strncasecmp(\"aB\", \"xyz...\", 100, options[%d])=%ld instead of negative\n",
+                    (int)i, (long)result);
+        }
+    }
+
+#if U_PLATFORM_IMPLEMENTS_POSIX
+    if(pages!=NULL) {
+        munmap(pages, 2*pageSize);
+        return;
+    }
+#endif
+    (void)pages;
+    (void)pageSize;
+    uprv_free(s1);
+}
+
 /* test UCaseMap ------------------------------------------------------------ */
 
 /*
@@ -1049,6 +1136,7 @@ void addCaseTest(TestNode** root) {
 #endif
     addTest(root, &TestCaseFolding, "tsutil/cstrcase/TestCaseFolding");
     addTest(root, &TestCaseCompare, "tsutil/cstrcase/TestCaseCompare");
+    addTest(root, &TestCaseCompareShortNUL, "tsutil/cstrcase/TestCaseCompareShortNUL");
     addTest(root, &TestUCaseMap, "tsutil/cstrcase/TestUCaseMap");
 #if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILE_IO
     addTest(root, &TestUCaseMapToTitle, "tsutil/cstrcase/TestUCaseMapToTitle");
@@ -3565,4 +3565,81 @@ static void TestIntCharacterPropertiesAPI() {
     if (ucpmap_get(map, 0x20) != U_SPACE_SEPARATOR || ucpmap_get(map, 0x23456) != U_OTHER_LETTER) {
         log_err("u_getIntPropertyMap(UCHAR_GENERAL_CATEGORY) wrong contents\n");
     }
+
+    // "ab1 \u4e00\U00023456.\ud800" and the UTF-8 version with an ill-formed byte
+    static const UChar s16[] = { 0x61, 0x62, 0x31, 0x20, 0x4e00, 0xd84d, 0xdc56, 0x2e, 0xd800 };
+    static const char s8[] = "ab1 \xe4\xb8\x80\xf0\xa3\x91\x96.\xff";
+    static const int32_t expectedLimits16[] = { 2, 3, 4, 7, 8, 9 };
+    static const int32_t expectedLimits8[] = { 2, 3, 4, 11, 12, 13 };
+    static const int32_t expectedTypes[] = {
+        U_LOWERCASE_LETTER, U_DECIMAL_DIGIT_NUMBER, U_SPACE_SEPARATOR,
+        U_OTHER_LETTER, U_OTHER_PUNCTUATION, U_SURROGATE
+    };
+    int32_t limits[8], values[16];
+    int32_t i, count;
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertySpans(s16, UPRV_LENGTHOF(s16), UCHAR_GENERAL_CATEGORY,
+                                  limits, values, UPRV_LENGTHOF(limits), &errorCode);
+    if (U_FAILURE(errorCode) || count != UPRV_LENGTHOF(expectedLimits16)) {
+        log_err("u_getIntPropertySpans(gc) = %d %s\n", (int)count, u_errorName(errorCode));
+    } else {
+        for (i = 0; i < count; ++i) {
+            if (limits[i] != expectedLimits16[i] || values[i] != expectedTypes[i]) {
+                log_err("u_getIntPropertySpans(gc)[%d] = (%d, %d) wrong\n",
+                        (int)i, (int)limits[i], (int)values[i]);
+            }
+        }
+    }
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertySpansUTF8(s8, -1, UCHAR_GENERAL_CATEGORY,
+                                      limits, values, UPRV_LENGTHOF(limits), &errorCode);
+    if (U_FAILURE(errorCode) || count != UPRV_LENGTHOF(expectedLimits8)) {
+        log_err("u_getIntPropertySpansUTF8(gc) = %d %s\n", (int)count, u_errorName(errorCode));
+    } else {
+        for (i = 0; i < count; ++i) {
+            // The ill-formed byte gets the value of U+FFFD.
+            int32_t expected = i == count - 1 ? u_charType(0xfffd) : expectedTypes[i];
+            if (limits[i] != expectedLimits8[i] || values[i] != expected) {
+                log_err("u_getIntPropertySpansUTF8(gc)[%d] = (%d, %d) wrong\n",
+                        (int)i, (int)limits[i], (int)values[i]);
+            }
+        }
+    }
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertySpans(s16, UPRV_LENGTHOF(s16), UCHAR_GENERAL_CATEGORY,
+                                  limits, values, 2, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || count != UPRV_LENGTHOF(expectedLimits16) ||
+            limits[1] != 3 || values[1] != U_DECIMAL_DIGIT_NUMBER) {
+        log_err("u_getIntPropertySpans(gc, capacity=2) = %d %s\n", (int)count, u_errorName(errorCode));
+    }
+
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertyValues(s16, UPRV_LENGTHOF(s16), UCHAR_SCRIPT, values, &errorCode);
+    if (U_FAILURE(errorCode) || count != UPRV_LENGTHOF(s16)) {
+        log_err("u_getIntPropertyValues(sc) = %d %s\n", (int)count, u_errorName(errorCode));
+    } else {
+        for (i = 0; i < count; ++i) {
+            UChar32 c = s16[i];
+            if (U16_IS_LEAD(c) && i + 1 < count && U16_IS_TRAIL(s16[i + 1])) {
+                c = U16_GET_SUPPLEMENTARY(c, s16[i + 1]);
+            } else if (U16_IS_TRAIL(c) && i > 0 && U16_IS_LEAD(s16[i - 1])) {
+                c = U16_GET_SUPPLEMENTARY(s16[i - 1], c);
+            }
+            if (values[i] != u_getIntPropertyValue(c, UCHAR_SCRIPT)) {
+                log_err("u_getIntPropertyValues(sc)[%d] = %d wrong\n", (int)i, (int)values[i]);
+            }
+        }
+    }
+    errorCode = U_ZERO_ERROR;
+    count = u_getIntPropertyValuesUTF8(s8, -1, UCHAR_SCRIPT, values, &errorCode);
+    if (U_FAILURE(errorCode) || count != (int32_t)strlen(s8) ||
+            values[0] != USCRIPT_LATIN || values[4] != USCRIPT_HAN || values[6] != USCRIPT_HAN ||
+            values[7] != USCRIPT_HAN || values[11] != USCRIPT_COMMON) {
+        log_err("u_getIntPropertyValuesUTF8(sc) = %d %s\n", (int)count, u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    u_getIntPropertyValues(s16, UPRV_LENGTHOF(s16), UCHAR_INT_LIMIT, values, &errorCode);
+    if (U_SUCCESS(errorCode)) {
+        log_err("u_getIntPropertyValues(UCHAR_INT_LIMIT) did not fail\n");
+    }
 }
@@ -38,6 +38,7 @@ static void Test_strFromUTF32_surrogates(void);
 static void Test_UChar_UTF8_API(void);
 static void Test_FromUTF8(void);
 static void Test_FromUTF8Lenient(void);
+static void Test_UTF8_ASCIIRuns(void);
 static void Test_UChar_WCHART_API(void);
 static void Test_widestrs(void);
 static void Test_WCHART_LongString(void);
@@ -55,6 +56,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_UChar_UTF8_API, "custrtrn/Test_UChar_UTF8_API");
    addTest(root, &Test_FromUTF8, "custrtrn/Test_FromUTF8");
    addTest(root, &Test_FromUTF8Lenient, "custrtrn/Test_FromUTF8Lenient");
+   addTest(root, &Test_UTF8_ASCIIRuns, "custrtrn/Test_UTF8_ASCIIRuns");
    addTest(root, &Test_UChar_WCHART_API,  "custrtrn/Test_UChar_WCHART_API");
    addTest(root, &Test_widestrs,  "custrtrn/Test_widestrs");
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
@@ -928,6 +930,68 @@ Test_FromUTF8(void) {
     }
 }
 
+/*
+ * Test u_strToUTF8() and u_strFromUTF8() with long ASCII runs
+ * interrupted by non-ASCII characters at every offset,
+ * which exercises the bulk ASCII code paths and their exits.
+ */
+static void
+Test_UTF8_ASCIIRuns(void) {
+    static const UChar nonASCII[]={ 0xe9, 0x4e00, 0xd83d, 0xde00 };  /* U+00E9, U+4E00, U+1F600 */
+    static const char nonASCII8[]="\xc3\xa9\xe4\xb8\x80\xf0\x9f\x98\x80";
+    UChar s16[80], d16[100];
+    char s8[100], d8[100];
+    int32_t pos, i, length16, length8, destLength;
+    UErrorCode errorCode;
+
+    for(pos=0; pos<=64; ++pos) {
+        /* ASCII letters with the non-ASCII characters inserted at pos */
+        length16=0;
+        length8=0;
+        for(i=0; i<72; ++i) {
+            if(i==pos) {
+                u_memcpy(s16+length16, nonASCII, 4);
+                length16+=4;
+                uprv_memcpy(s8+length8, nonASCII8, 9);
+                length8+=9;
+            }
+            s16[length16++]=(UChar)(0x61+i%26);
+            s8[length8++]=(char)(0x61+i%26);
+        }
+
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8(d8, UPRV_LENGTHOF(d8), &destLength, s16, length16, &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=length8 || 0!=uprv_memcmp(d8, s8, length8)) {
+            log_err("error: u_strToUTF8(non-ASCII at %ld) fails: destLength=%ld - %s\n",
+                    (long)pos, (long)destLength, u_errorName(errorCode));
+        }
+
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8(d16, UPRV_LENGTHOF(d16), &destLength, s8, length8, &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=length16 || 0!=u_memcmp(d16, s16, length16)) {
+            log_err("error: u_strFromUTF8(non-ASCII at %ld) fails: destLength=%ld - %s\n",
+                    (long)pos, (long)destLength, u_errorName(errorCode));
+        }
+
+        /* preflighting */
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8(NULL, 0, &destLength, s8, length8, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=length16) {
+            log_err("error: u_strFromUTF8(preflight non-ASCII at %ld) fails: destLength=%ld - %s\n",
+                    (long)pos, (long)destLength, u_errorName(errorCode));
+        }
+
+        /* destination too short, stopping inside an ASCII run */
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8(d16, 20, &destLength, s8, length8, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=length16 ||
+                0!=u_memcmp(d16, s16, 20)) {
+            log_err("error: u_strFromUTF8(capacity 20, non-ASCII at %ld) fails: destLength=%ld - %s\n",
+                    (long)pos, (long)destLength, u_errorName(errorCode));
+        }
+    }
+}
+
 /* test u_strFromUTF8Lenient() */
 static void
 Test_FromUTF8Lenient(void) {
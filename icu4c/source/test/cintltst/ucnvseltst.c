@@ -376,6 +376,29 @@ serializeAndUnserialize(UConverterSelector *sel, char **buffer, UErrorCode *stat
   return sel;
 }
 
+/* incremental selection, with the text split into pieces of pieceLength units */
+static UEnumeration *
+selectForUTF8InPieces(UConverterSelection *selection, const char *s, int32_t length,
+                      int32_t pieceLength, UErrorCode *status) {
+  int32_t start;
+  for (start = 0; start < length; start += pieceLength) {
+    int32_t n = length - start < pieceLength ? length - start : pieceLength;
+    ucnvsel_appendUTF8(selection, s + start, n, status);
+  }
+  return ucnvsel_finishSelection(selection, status);
+}
+
+static UEnumeration *
+selectForStringInPieces(UConverterSelection *selection, const UChar *s, int32_t length,
+                        int32_t pieceLength, UErrorCode *status) {
+  int32_t start;
+  for (start = 0; start < length; start += pieceLength) {
+    int32_t n = length - start < pieceLength ? length - start : pieceLength;
+    ucnvsel_appendString(selection, s + start, n, status);
+  }
+  return ucnvsel_finishSelection(selection, status);
+}
+
 static void TestSelector()
 {
   TestText text;
@@ -415,6 +438,7 @@ static void TestSelector()
     excluded_set_id = testCaseIdx % UPRV_LENGTHOF(excluded_sets);
     {
       UConverterSelector *sel_rt, *sel_fb;
+      UConverterSelection *selection_rt = NULL;
       char *buffer_fb = NULL;
       UErrorCode status = U_ZERO_ERROR;
       sel_rt = ucnvsel_open(encodings, num_encodings,
@@ -442,6 +466,11 @@ static void TestSelector()
         continue;
       }
 
+      selection_rt = ucnvsel_openSelection(sel_rt, &status);
+      if (U_FAILURE(status)) {
+        log_err("ucnvsel_openSelection() failed - %s\n", u_errorName(status));
+      }
+
       text_reset(&text);
       for (;;) {
         UBool *manual_rt, *manual_fb;
@@ -469,6 +498,9 @@ static void TestSelector()
         /* UTF-8 NUL-terminated */
         verifyResult(ucnvsel_selectForUTF8(sel_rt, s, -1, &status), manual_rt);
         verifyResult(ucnvsel_selectForUTF8(sel_fb, s, -1, &status), manual_fb);
+        /* UTF-8 in pieces that split characters, reusing the selection */
+        verifyResult(selectForUTF8InPieces(selection_rt, s, length8, 1 + text.number % 3, &status), manual_rt);
+        verifyResult(selectForUTF8InPieces(selection_rt, s, length8, 7, &status), manual_rt);
 
         u_strFromUTF8(utf16, UPRV_LENGTHOF(utf16), &length16, s, length8, &status);
         if (U_FAILURE(status)) {
@@ -485,12 +517,16 @@ static void TestSelector()
             /* UTF-16 NUL-terminated */
             verifyResult(ucnvsel_selectForString(sel_rt, utf16, -1, &status), manual_rt);
             verifyResult(ucnvsel_selectForString(sel_fb, utf16, -1, &status), manual_fb);
+            /* UTF-16 in pieces that split surrogate pairs */
+            verifyResult(selectForStringInPieces(selection_rt, utf16, length16, 1, &status), manual_rt);
+            verifyResult(selectForStringInPieces(selection_rt, utf16, length16, 5, &status), manual_rt);
           }
         }
 
         uprv_free(manual_rt);
         uprv_free(manual_fb);
       }
+      ucnvsel_closeSelection(selection_rt);
       ucnvsel_close(sel_rt);
       ucnvsel_close(sel_fb);
       uprv_free(buffer_fb);
@@ -685,12 +685,192 @@ testTrieUTF8(const char *testName,
     }
 }
 
+static UBool
+checkStringSpans(const char *testName, const char *variant,
+                 const uint32_t values[], int32_t length,
+                 const int32_t limits[], const uint32_t spanValues[], int32_t count) {
+    int32_t i, j=0, start=0;
+    for(i=0; i<count; ++i) {
+        if(limits[i]<=start || limits[i]>length ||
+                (i>0 && spanValues[i]==spanValues[i-1])) {
+            log_err("error: %s(%s) span %ld has bad limit %ld or repeats value 0x%lx\n",
+                    variant, testName, (long)i, (long)limits[i], (long)spanValues[i]);
+            return FALSE;
+        }
+        for(j=start; j<limits[i]; ++j) {
+            if(values[j]!=spanValues[i]) {
+                log_err("error: %s(%s) span %ld value 0x%lx != 0x%lx at index %ld\n",
+                        variant, testName, (long)i, (long)spanValues[i], (long)values[j], (long)j);
+                return FALSE;
+            }
+        }
+        start=limits[i];
+    }
+    if(start!=length) {
+        log_err("error: %s(%s) spans end at %ld != length %ld\n",
+                variant, testName, (long)start, (long)length);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void
+testTrieStrings(const char *testName, const UCPTrie *trie,
+                const CheckRange checkRanges[], int32_t countCheckRanges) {
+    static const uint8_t illegal8[]={
+        0xc0, 0x80, 0xe0, 0xa0, 0x41, 0xed, 0xa0, 0x80, 0xf4, 0x90, 0x80, 0x80, 0xf0, 0x90, 0x80
+    };
+    static UChar s16[30000];
+    static char s8[60000];
+    static uint32_t expected[60000], actual[60000], spanValues[60000];
+    static int32_t limits[60000];
+
+    UErrorCode errorCode;
+    UChar32 prevCP, c;
+    int32_t i, j, length16, length8, count, spanCount;
+    UBool isError=FALSE;
+
+    /* start, middle and end of each range, plus surrogates and ill-formed UTF-8 */
+    prevCP=0;
+    length16=length8=0;
+    for(i=skipSpecialValues(checkRanges, countCheckRanges); i<countCheckRanges; ++i) {
+        UChar32 cps[3];
+        c=checkRanges[i].limit;
+        cps[0]=prevCP;
+        cps[1]=(prevCP+c)/2;
+        cps[2]=c-1;
+        prevCP=c;
+        for(j=0; j<3; ++j) {
+            U16_APPEND_UNSAFE(s16, length16, cps[j]);
+            if(!U_IS_SURROGATE(cps[j])) {
+                U8_APPEND_UNSAFE(s8, length8, cps[j]);
+            }
+        }
+        if(length16>UPRV_LENGTHOF(s16)-8 || length8>UPRV_LENGTHOF(s8)-UPRV_LENGTHOF(illegal8)) {
+            log_err("string test (%s) ran out of capacity\n", testName);
+            return;
+        }
+    }
+    s16[length16++]=0xd800;
+    s16[length16++]=0x61;
+    s16[length16++]=0xdc00;
+    s16[length16++]=0xd800;
+    s16[length16++]=0xd800;
+    s16[length16++]=0xdfff;
+    s16[length16++]=0xd800;
+    uprv_memcpy(s8+length8, illegal8, sizeof(illegal8));
+    length8+=UPRV_LENGTHOF(illegal8);
+
+    /* UTF-16 */
+    for(i=0; i<length16;) {
+        j=i;
+        U16_NEXT(s16, i, length16, c);
+        for(; j<i; ++j) {
+            expected[j]=ucptrie_get(trie, c);
+        }
+    }
+    errorCode=U_ZERO_ERROR;
+    count=ucptrie_getStringValues(trie, s16, length16, actual, &errorCode);
+    if(U_FAILURE(errorCode) || count!=length16) {
+        log_err("error: ucptrie_getStringValues(%s) failed: %s count=%ld\n",
+                testName, u_errorName(errorCode), (long)count);
+        return;
+    }
+    for(i=0; i<length16; ++i) {
+        if(actual[i]!=expected[i]) {
+            log_err("error: ucptrie_getStringValues(%s)[%ld] (U+%04lx) = 0x%lx instead of 0x%lx\n",
+                    testName, (long)i, (long)s16[i], (long)actual[i], (long)expected[i]);
+            isError=TRUE;
+            break;
+        }
+    }
+    errorCode=U_ZERO_ERROR;
+    spanCount=ucptrie_getStringSpans(trie, s16, length16, NULL, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || spanCount<=0) {
+        log_err("error: ucptrie_getStringSpans(%s, preflighting) = %ld %s\n",
+                testName, (long)spanCount, u_errorName(errorCode));
+        return;
+    }
+    errorCode=U_ZERO_ERROR;
+    count=ucptrie_getStringSpans(trie, s16, length16, limits, spanValues, spanCount, &errorCode);
+    if(U_FAILURE(errorCode) || count!=spanCount) {
+        log_err("error: ucptrie_getStringSpans(%s) = %ld %s\n",
+                testName, (long)count, u_errorName(errorCode));
+        return;
+    }
+    if(!isError) {
+        checkStringSpans(testName, "ucptrie_getStringSpans", expected, length16,
+                         limits, spanValues, count);
+    }
+    if(spanCount>1) {
+        /* the first capacity spans must be written even on overflow */
+        int32_t lastLimit=limits[spanCount-2];
+        limits[spanCount-2]=-1;
+        errorCode=U_ZERO_ERROR;
+        count=ucptrie_getStringSpans(trie, s16, length16, limits, spanValues, spanCount-1, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || count!=spanCount || limits[spanCount-2]!=lastLimit) {
+            log_err("error: ucptrie_getStringSpans(%s, capacity=%ld) = %ld %s\n",
+                    testName, (long)(spanCount-1), (long)count, u_errorName(errorCode));
+        }
+    }
+
+    /* UTF-8 */
+    isError=FALSE;
+    for(i=0; i<length8;) {
+        j=i;
+        U8_NEXT_OR_FFFD(s8, i, length8, c);
+        for(; j<i; ++j) {
+            expected[j]=ucptrie_get(trie, c);
+        }
+    }
+    errorCode=U_ZERO_ERROR;
+    count=ucptrie_getStringValuesUTF8(trie, s8, length8, actual, &errorCode);
+    if(U_FAILURE(errorCode) || count!=length8) {
+        log_err("error: ucptrie_getStringValuesUTF8(%s) failed: %s count=%ld\n",
+                testName, u_errorName(errorCode), (long)count);
+        return;
+    }
+    for(i=0; i<length8; ++i) {
+        if(actual[i]!=expected[i]) {
+            log_err("error: ucptrie_getStringValuesUTF8(%s)[%ld] (byte %02x) = 0x%lx instead of 0x%lx\n",
+                    testName, (long)i, (int)(uint8_t)s8[i], (long)actual[i], (long)expected[i]);
+            isError=TRUE;
+            break;
+        }
+    }
+    errorCode=U_ZERO_ERROR;
+    count=ucptrie_getStringSpansUTF8(trie, s8, length8, limits, spanValues,
+                                     UPRV_LENGTHOF(limits), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("error: ucptrie_getStringSpansUTF8(%s) = %ld %s\n",
+                testName, (long)count, u_errorName(errorCode));
+        return;
+    }
+    if(!isError) {
+        checkStringSpans(testName, "ucptrie_getStringSpansUTF8", expected, length8,
+                         limits, spanValues, count);
+    }
+
+    /* NUL-terminated and empty strings */
+    errorCode=U_ZERO_ERROR;
+    s16[0]=0x61;
+    s16[1]=0;
+    if(ucptrie_getStringValues(trie, s16, -1, actual, &errorCode)!=1 ||
+            actual[0]!=ucptrie_get(trie, 0x61) ||
+            ucptrie_getStringSpansUTF8(trie, "", -1, NULL, NULL, 0, &errorCode)!=0 ||
+            U_FAILURE(errorCode)) {
+        log_err("error: ucptrie_getString...(%s) NUL-terminated/empty string: %s\n",
+                testName, u_errorName(errorCode));
+    }
+}
+
 static void
 testTrie(const char *testName, const UCPTrie *trie,
          UCPTrieType type, UCPTrieValueWidth valueWidth,
          const CheckRange checkRanges[], int32_t countCheckRanges) {
     testTrieGetters(testName, trie, type, valueWidth, checkRanges, countCheckRanges);
     testTrieGetRanges(testName, trie, NULL, UCPMAP_RANGE_NORMAL, 0, checkRanges, countCheckRanges);
+    testTrieStrings(testName, trie, checkRanges, countCheckRanges);
     if (type == UCPTRIE_TYPE_FAST) {
         testTrieUTF16(testName, trie, valueWidth, checkRanges, countCheckRanges);
         testTrieUTF8(testName, trie, valueWidth, checkRanges, countCheckRanges);
@@ -16,6 +16,7 @@
 #include "cintltst.h"
 #include "cmemory.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -31,6 +32,8 @@ static void TestChaining(void);
 static void TestBufferOverflow(void);
 static void TestIBM424(void);
 static void TestIBM420(void);
+static void TestConfidenceThreshold(void);
+static void TestAppendText(void);
 
 void addUCsdetTest(TestNode** root);
 
@@ -43,6 +46,8 @@ void addUCsdetTest(TestNode** root)
     addTest(root, &TestInputFilter, "ucsdetst/TestInputFilter");
     addTest(root, &TestChaining, "ucsdetst/TestErrorChaining");
     addTest(root, &TestBufferOverflow, "ucsdetst/TestBufferOverflow");
+    addTest(root, &TestConfidenceThreshold, "ucsdetst/TestConfidenceThreshold");
+    addTest(root, &TestAppendText, "ucsdetst/TestAppendText");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestIBM424, "ucsdetst/TestIBM424");
     addTest(root, &TestIBM420, "ucsdetst/TestIBM420");
@@ -589,3 +594,179 @@ static void TestIBM420(void)
     freeBytes(bytes_r);
     ucsdet_close(csd);
 }
+
+static void TestConfidenceThreshold(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    static const char ss[] = "This is a string with some non-ascii characters: "
+               "\u0391\u0392\u0393\u0394\u0395 \u00E9t\u00E9.";
+    int32_t sLength = 0, byteLength = 0;
+    int32_t allCount = 0, count = 0;
+    UChar s[sizeof(ss)];
+    char *bytes;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch **matches;
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+    bytes = extractBytes(s, sLength, "UTF-8", &byteLength);
+
+    if (ucsdet_getConfidenceThreshold(csd) != 0) {
+        log_err("The default confidence threshold is %d rather than 0\n",
+                (int)ucsdet_getConfidenceThreshold(csd));
+    }
+
+    ucsdet_setText(csd, bytes, byteLength, &status);
+    ucsdet_detectAll(csd, &allCount, &status);
+    if (U_FAILURE(status) || allCount < 2) {
+        log_err("ucsdet_detectAll() without a threshold: %s, %d matches\n", u_errorName(status), (int)allCount);
+        goto bail;
+    }
+
+    /* The UTF-8 recognizer runs first and is certain, so nothing else runs. */
+    ucsdet_setConfidenceThreshold(csd, 100, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != 1 ||
+            strcmp(ucsdet_getName(matches[0], &status), "UTF-8") != 0 ||
+            ucsdet_getConfidence(matches[0], &status) != 100) {
+        log_err("ucsdet_detectAll() with threshold 100 did not stop at the UTF-8 match: %s, %d matches\n",
+                u_errorName(status), (int)count);
+    }
+    if (ucsdet_getConfidenceThreshold(csd) != 100) {
+        log_err("ucsdet_getConfidenceThreshold() did not return the new threshold\n");
+    }
+
+    /* Out-of-range thresholds are rejected and leave the setting alone. */
+    ucsdet_setConfidenceThreshold(csd, 101, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR || ucsdet_getConfidenceThreshold(csd) != 100) {
+        log_err("ucsdet_setConfidenceThreshold(101) - %s, threshold %d\n",
+                u_errorName(status), (int)ucsdet_getConfidenceThreshold(csd));
+    }
+    status = U_ZERO_ERROR;
+
+    ucsdet_setConfidenceThreshold(csd, 0, &status);
+    ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != allCount) {
+        log_err("ucsdet_detectAll() after removing the threshold: %s, %d matches rather than %d\n",
+                u_errorName(status), (int)count, (int)allCount);
+    }
+
+bail:
+    freeBytes(bytes);
+    ucsdet_close(csd);
+}
+
+/*
+ * Feed the input to ucsdet_appendText() in pieces of varying sizes,
+ * which split characters in every possible way, and check that the matches
+ * are the same as with ucsdet_setText() on the whole input.
+ */
+static void checkAppendText(const char *bytes, int32_t byteLength, UBool filter, const char *what)
+{
+    static const int32_t pieceSizes[] = { 1, 2, 3, 7, 4, 5, 64, 1000 };
+    UErrorCode status = U_ZERO_ERROR;
+    UCharsetDetector *wholeCsd = ucsdet_open(&status);
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch **wholeMatches, **matches;
+    int32_t wholeCount = 0, count = 0;
+    int32_t start, piece, i;
+
+    ucsdet_enableInputFilter(wholeCsd, filter);
+    ucsdet_enableInputFilter(csd, filter);
+    ucsdet_setText(wholeCsd, bytes, byteLength, &status);
+    wholeMatches = ucsdet_detectAll(wholeCsd, &wholeCount, &status);
+
+    for (start = 0, piece = 0; start < byteLength; start += i, ++piece) {
+        i = pieceSizes[piece % UPRV_LENGTHOF(pieceSizes)];
+        if (i > byteLength - start) {
+            i = byteLength - start;
+        }
+        ucsdet_appendText(csd, bytes + start, i, &status);
+        if (piece == 5) {
+            /* A running guess must not disturb the rest of the detection. */
+            ucsdet_detect(csd, &status);
+        }
+    }
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status)) {
+        log_err("%s: ucsdet_appendText()+ucsdet_detectAll() - %s\n", what, u_errorName(status));
+        goto bail;
+    }
+
+    if (count != wholeCount) {
+        log_err("%s: %d matches with ucsdet_appendText() but %d with ucsdet_setText()\n",
+                what, (int)count, (int)wholeCount);
+        goto bail;
+    }
+    for (i = 0; i < count; ++i) {
+        if (strcmp(ucsdet_getName(matches[i], &status), ucsdet_getName(wholeMatches[i], &status)) != 0 ||
+                ucsdet_getConfidence(matches[i], &status) != ucsdet_getConfidence(wholeMatches[i], &status)) {
+            log_err("%s: match %d is %s/%d with ucsdet_appendText() but %s/%d with ucsdet_setText()\n",
+                    what, (int)i,
+                    ucsdet_getName(matches[i], &status), (int)ucsdet_getConfidence(matches[i], &status),
+                    ucsdet_getName(wholeMatches[i], &status), (int)ucsdet_getConfidence(wholeMatches[i], &status));
+        }
+    }
+
+bail:
+    ucsdet_close(csd);
+    ucsdet_close(wholeCsd);
+}
+
+static void TestAppendText(void)
+{
+    static const char ss[] = "<p class=\"x\">Some text with markup, \u65e5\u672c\u8a9e\u306e\u6587\u7ae0\u3002 "
+               "\u3053\u308c\u306f\u30c6\u30b9\u30c8\u3067\u3059\u3002</p> "
+               "\u4e2d\u6587\u7684\u6d4b\u8bd5\u3002\U00010400 ";
+    static const char *const codepages[] = {
+        "UTF-8", "Shift_JIS", "EUC-JP", "GB18030", "UTF-32LE", "UTF-32BE", "UTF-16BE"
+    };
+    UChar s[sizeof(ss)];
+    UChar *longS;
+    int32_t sLength, longLength, i, c;
+    UErrorCode status = U_ZERO_ERROR;
+    UCharsetDetector *csd;
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+
+    /* Longer than the 8 kB sample that the charset detector keeps. */
+    longLength = sLength * (10000 / sLength + 1);
+    longS = NEW_ARRAY(UChar, longLength);
+    for (i = 0; i < longLength; i += sLength) {
+        u_memcpy(longS + i, s, sLength);
+    }
+
+    for (c = 0; c < UPRV_LENGTHOF(codepages); ++c) {
+        int32_t byteLength = 0;
+        char what[64];
+        char *bytes = extractBytes(s, sLength, codepages[c], &byteLength);
+
+        sprintf(what, "short %s", codepages[c]);
+        checkAppendText(bytes, byteLength, FALSE, what);
+        sprintf(what, "short filtered %s", codepages[c]);
+        checkAppendText(bytes, byteLength, TRUE, what);
+        freeBytes(bytes);
+
+        bytes = extractBytes(longS, longLength, codepages[c], &byteLength);
+        sprintf(what, "long %s", codepages[c]);
+        checkAppendText(bytes, byteLength, FALSE, what);
+        sprintf(what, "long filtered %s", codepages[c]);
+        checkAppendText(bytes, byteLength, TRUE, what);
+        freeBytes(bytes);
+    }
+    DELETE_ARRAY(longS);
+
+    /* Argument checking, and ucsdet_setText() ending incremental input. */
+    csd = ucsdet_open(&status);
+    ucsdet_appendText(csd, NULL, 5, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_appendText(NULL, 5) - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucsdet_appendText(csd, "\xE6\x97", -1, &status);
+    ucsdet_setText(csd, "plain", 5, &status);
+    ucsdet_appendText(csd, "\xA5 text", -1, &status);
+    if (U_FAILURE(status) || ucsdet_detect(csd, &status) == NULL) {
+        log_err("ucsdet_appendText() after ucsdet_setText() - %s\n", u_errorName(status));
+    }
+    ucsdet_close(csd);
+}
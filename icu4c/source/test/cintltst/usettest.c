@@ -595,6 +595,16 @@ static void TestFreezable() {
         log_err("uset_cloneAsThawed() does not work\n");
     }
 
+    uset_close(frozen);
+    frozen=uset_clone(idSet);
+    uset_freezeWithOptions(frozen, USET_FREEZE_CODE_POINT_TRIE);
+    uset_addRange(frozen, 0xd802, 0xd805);
+    if(!uset_isFrozen(frozen) || !uset_equals(frozen, idSet) ||
+            uset_contains(frozen, 0x1d7ff)!=uset_contains(idSet, 0x1d7ff) ||
+            uset_contains(frozen, 0xe01ef)!=uset_contains(idSet, 0xe01ef)) {
+        log_err("uset_freezeWithOptions(USET_FREEZE_CODE_POINT_TRIE) does not work\n");
+    }
+
     uset_close(idSet);
     uset_close(frozen);
     uset_close(thawed);
@@ -0,0 +1,3119 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// file name: genprophdrtest.h
+//
+// machine-generated by: icu/tools/genprophdr/genprophdr.cpp
+
+
+// Unicode 11.0 property lookup functions for: gc WSpace Alpha sc scf
+// The lookup functions are constexpr and need no runtime initialization.
+// The constexpr arrays have internal linkage: Include this header
+// in only one translation unit to avoid duplicating the data.
+
+#ifndef GENPROPHDRTEST_H
+#define GENPROPHDRTEST_H
+
+#include <stdint.h>
+
+namespace genprophdrtest {
+
+namespace detail {
+
+// Same lookup as UCPTRIE_FAST_GET() for a UCPTRIE_TYPE_FAST trie,
+// with single-return-statement functions so that they are C++11 constexpr.
+constexpr int32_t dataBlock18(const uint16_t *index, int32_t i3Block, int32_t i3) {
+    return ((int32_t(index[i3Block]) << (2 + 2 * i3)) & 0x30000) | index[i3Block + 1 + i3];
+}
+
+constexpr int32_t dataBlock(const uint16_t *index, int32_t i3Block, int32_t i3) {
+    return (i3Block & 0x8000) == 0 ? index[i3Block + i3] :
+        dataBlock18(index, (i3Block & 0x7fff) + (i3 & ~7) + (i3 >> 3), i3 & 7);
+}
+
+constexpr int32_t supplementaryIndex(const uint16_t *index, int32_t c) {
+    return dataBlock(index, index[index[(c >> 14) + 1020] + ((c >> 9) & 0x1f)], (c >> 4) & 0x1f) +
+        (c & 0xf);
+}
+
+constexpr int32_t cpIndex(const uint16_t *index, int32_t dataLength, int32_t highStart, int32_t c) {
+    return uint32_t(c) <= 0xffff ? index[c >> 6] + (c & 0x3f) :
+        uint32_t(c) <= 0x10ffff ?
+            (c >= highStart ? dataLength - 2 : supplementaryIndex(index, c)) :
+            dataLength - 1;
+}
+
+constexpr uint16_t generalCategory_index[2921]={
+0,0x40,0x7f,0xbf,0xff,0x12e,0x16d,0x1ad,0x1e5,0x224,0x250,0x28e,0x2ce,0x2de,0x31e,0x34f,
+0x38c,0x3bc,0x3fa,0x43a,0x44a,0x47b,0x4b2,0x4f2,0x532,0x572,0x5a3,0x5cf,0x60f,0x644,0x65e,0x69e,
+0x6de,0x71e,0x749,0x787,0x7c4,0x803,0x842,0x881,0x8c0,0x8ff,0x93e,0x97d,0x9bd,0x9fb,0xa39,0xa79,
+0xab9,0xaf8,0xb38,0xb78,0xbb8,0xbf7,0xc37,0xc77,0xcb6,0xcf6,0xd35,0xd75,0xdb5,0xdf5,0xe35,0xe73,
+0xeb3,0xef3,0xf31,0xf6b,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0xfab,0xfe2,0x1020,0x104f,0x1074,0x10b4,0x10d4,
+0x1114,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x1127,0x1167,0x1187,0x11c7,0x1207,0x1247,0x1285,
+0x12c5,0x1302,0x1342,0x1372,0x13b2,0x13f2,0x1432,0x1468,0x14a8,0x14d3,0x1513,0x1552,0x1592,0x15d0,0x1610,0x164a,
+0x168a,0x16ca,0x170a,0x174a,0x178a,0x17b6,0x179b,0x17f6,0x1836,0x1836,0x1860,0x1836,0x189f,0x18df,0x191f,0x195e,
+0x199e,0x19dd,0x1a1d,0x1a5d,0x1a9d,0x1add,0x1b1a,0x1b4c,0x1b80,0x1b80,0x1b80,0x1b80,0x1bc0,0x1beb,0x1c28,0x1c5c,
+0x1c7e,0x1cbe,0x1ce2,0x1cfe,0x1d3e,0x1d3e,0x1bf0,0x1d7d,0x1d3e,0x1bf8,0x1d3e,0x1d3e,0x1d3e,0x1dbd,0x1d2a,0x1dfd,
+0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1b80,0x1b80,0x1e3a,0x1e62,0x1b80,0x1b80,0x1b80,0x1b80,0x1ea2,0x1edd,0x1efb,0x1f32,
+0x1f72,0x1fa2,0x1836,0x1fe1,0x2021,0x2051,0x2091,0x20b1,0x20f1,0x2131,0x1f21,0x2171,0x1d3e,0x1d3e,0x1d3e,0x218f,
+0x21cf,0x220f,0x2238,0x2259,0x2299,0x5a3,0x22ca,0x230a,0x234a,0x2382,0x2398,0x23d8,0x1d3e,0x1d3e,0x1d3e,0x1d3e,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x1372,0x1d3e,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2418,
+0x12f0,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x2458,0x2491,0x5a3,0x5a3,0x5a3,0x5a3,0x24d1,0x2511,0x2551,0x2571,0x25b1,0x25e3,0x2621,0x265b,
+0x2699,0x26d9,0x2719,0x2755,0x2795,0x27ce,0x280e,0x284d,0x288d,0x28cd,0x290b,0x294b,0x298a,0x29ba,0x29ea,0x2a2a,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2a6a,0x2aa3,
+0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,
+0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,0x2ae3,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2b63,0x5a3,0x2b93,0x2bd3,0x2c13,0x2c21,0x2c5f,
+0x5a3,0x5a3,0x5a3,0x5a3,0x2c72,0x2c62,0x2cb2,0x2cea,0x2d2a,0x2d66,0x5a3,0x2d9c,0x2ddc,0x2e1c,0x2e4d,0x2e8c,
+0xa46,0xa64,0xa81,0xaa0,0xac0,0xac0,0xacd,0xaea,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,
+0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,
+0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,0xb08,
+0xb08,0xb08,0xb08,0xb08,0xb28,0xb08,0xb08,0xb08,0xb48,0xb48,0xb48,0xb49,0xb48,0xb48,0xb48,0xb49,
+0x772,0x5a3,0x777,0x2ecc,0x50f,0x50f,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x73e,
+0x2edc,0x109d,0x109d,0x2ee8,0x1afd,0x1afd,0x1afd,0x2ef8,0x2f01,0x1c99,0x1ca4,0x1552,0x1552,0x1d3e,0x1d3e,0x2f11,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x510,0x5a3,0x5a3,0x5a3,0x748,0x2f21,0x2f25,
+0x5a3,0x5a3,0x2f2d,0x5a3,0x2f3c,0x5a3,0x5a3,0x2f4c,0x5a3,0x2f5c,0x5a3,0x5a3,0x145a,0x2f6b,0x1552,0x1552,
+0x41,0x41,0x342,0x29ea,0x29ea,0x5a3,0x5a3,0x5a3,0x5a3,0x50f,0xb1e,0x41,0x41,0x2f7b,0x29ea,0x2f83,
+0x5a3,0x5a3,0x741,0x5a3,0x5a3,0x5a3,0x2f93,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x742,0x5a3,0x743,0x741,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x2fa3,0x5a3,0x5a3,0x2fad,0x5a3,0x2fbc,0x5a3,0x2fcc,0x5a3,0x50e,0x1cd7,0x1552,0x1552,0x1552,0x5a3,0x2fdc,
+0x5a3,0x2fec,0x5a3,0x2ffc,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x300c,0x109d,0x1cdc,0x109d,0x109d,
+0x301b,0x948,0x5a3,0x302b,0x2f28,0x2137,0x5a3,0x303b,0x5a3,0x304b,0x1552,0x1552,0x305b,0x5a3,0x3066,0x2139,
+0x5a3,0x5a3,0x5a3,0x3076,0x5a3,0x3086,0x5a3,0x3096,0x5a3,0x30a6,0x1cd5,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x5a3,0x5a3,0x5a3,0x5a3,0x740,0x1552,0x1552,0x1552,0x41,0x41,0x41,0x30b6,0x29ea,0x29ea,0x29ea,0x30c6,
+0x5a3,0x5a3,0x30d6,0xb1e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x109d,0x10a2,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x304b,0x30e6,0x5a3,0x577,0x30f6,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x2908,0x5a3,0x5a3,0x575,0x3106,0x1cdc,
+0x3116,0x78b,0x7c5,0x5a3,0x5a3,0x3126,0x3134,0x5a3,0x740,0xb1e,0x3144,0x5a3,0x314d,0x315a,0x316a,0x5a3,
+0x5a3,0x317a,0x7c5,0x5a3,0x5a3,0x318a,0x3199,0x31a9,0x1cdd,0x31b9,0x5a3,0x94e,0x31c9,0x31d8,0x1552,0x1552,
+0x1552,0x1552,0x31e8,0x770,0x31f7,0x5a3,0x5a3,0x630,0x3207,0xb1e,0x3217,0x852,0x775,0x3226,0x3236,0x3246,
+0x3254,0x1a89,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x3264,0x3274,0x3284,
+0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x3294,0x32a3,0xb1e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x5a3,0x5a3,0xecf,0x32b3,0x32c2,0x32ca,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x32da,0x32e9,0xb1e,
+0x32f9,0x1552,0x5a3,0x5a3,0x3309,0x3319,0xb1e,0x1552,0x1552,0x1552,0x5a3,0x1084,0x3329,0x3339,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x31c9,0x3349,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x41,0x41,0x29ea,0x29ea,0xc1d,0x3359,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x3368,0x5a3,0x5a3,0x3375,0x3384,0x3394,
+0x5a3,0x5a3,0x33a0,0x33aa,0x213d,0x1552,0x5a3,0x5a3,0x5a3,0x740,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x775,0x5a3,0xecf,0x33ba,0x33ca,0xc1d,
+0x10a4,0x550,0x5a3,0x798,0x33da,0x33e9,0x1552,0x1552,0x1552,0x1552,0x968,0x5a3,0x5a3,0x33f9,0x3408,0xb1e,
+0x3418,0x5a3,0x3422,0x3432,0xb1e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x5a3,0x3442,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x73f,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1afd,0x1afd,0x1afd,0x1afd,0x1afd,0x1afd,0x3452,0x213b,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x745,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x50e,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x742,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x740,0x5a3,0x50e,
+0x285d,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x50f,0x3462,0x5a3,0x5a3,0x5a3,0x3472,0x3482,0x3492,
+0x34a0,0x34a8,0x5a3,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x41,0x41,0x29ea,0x29ea,0x109d,0x34b8,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x744,0x34c8,0x34c9,0x34ca,0x78b,0x34da,
+0x1552,0x1552,0x1552,0x1552,0x34e8,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x747,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x746,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x50e,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x511,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x73e,0x510,0x740,0x34f8,0x3508,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1c9f,0x1d3e,0x1d3e,0x1f0a,
+0x1d3e,0x1d3e,0x1d3e,0x3518,0x3525,0x3532,0x1d3e,0x353e,0x1d3e,0x1d3e,0x1d3e,0x1c9c,0x1552,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x354c,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x109d,0x355c,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1c9e,0x109d,0x2f28,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x41,0x3b2,0x29ea,
+0x356c,0x3ae,0x357c,0x189f,0x41,0xdc,0x3582,0x3592,0x35a0,0x357d,0x41,0x3b2,0x29ea,0x35ad,0x35ba,0x29ea,
+0x35c8,0x35d8,0x1fa0,0x35e8,0x41,0xd8,0x29ea,0x41,0x3b2,0x29ea,0x356c,0x3ae,0x29ea,0x189f,0x41,0xdc,
+0x35e8,0x41,0xd8,0x29ea,0x41,0x3b2,0x29ea,0x35f8,0x41,0x3607,0xeb,0x38a,0x3617,0x29ea,0x3623,0x41,
+0x3603,0xe7,0x3611,0xc7,0x29ea,0xed,0x41,0x362f,0x29ea,0x363c,0x364a,0x364a,0x364a,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x2ce,0x2ce,0x2ce,
+0x365a,0x2ce,0x2ce,0x3665,0x3672,0x367e,0x78f,0x4c2,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0xe46,0x368e,0x369c,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x36ac,0x1a87,0x1552,0x1552,0x41,0x41,0xdc,
+0x29ea,0x36bc,0x285d,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1cdd,0x109d,0x109d,
+0x36cc,0x36dc,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0xade,0x5a3,0x36eb,0x36f8,0x3706,0x3716,0x3724,0x372c,0x774,0x511,
+0x373b,0x511,0x1552,0x1552,0x1552,0x374b,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1d3e,0x1d3e,0x1c99,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1ca1,
+0x1c96,0x1485,0x1485,0x1485,0x1d3e,0x1c9f,0x10a4,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1c99,0x1d3e,0x1d3e,0x1d3e,
+0x1c98,0x1552,0x1552,0x1552,0x1cb8,0x1d3e,0x1ca2,0x1d3e,0x1d3e,0x1c99,0x1c9c,0x1ca3,0x1c9f,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x375b,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1d3e,0x1ca0,0x1c98,0x10c4,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1d3e,0x1ca1,0x1d3e,0x1d3e,
+0x1d3e,0x1d3e,0x1d3e,0x1c9c,0x1552,0x1552,0x1c99,0x1d3e,0x1d3e,0x1d3e,0x1c9d,0x10c4,0x1d3e,0x1d3e,0x1c9d,0x1d3e,
+0x1c97,0x1552,0x1552,0x1552,0x1552,0x1552,0x1c99,0x1d3e,0x1d3e,0x1c96,0x1d3e,0x1d3e,0x1d3e,0x376b,0x1d3e,0x1d3e,
+0x1ca2,0x10c4,0x1ca2,0x1d3e,0x1d3e,0x1d3e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1c97,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x742,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x744,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x50f,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x747,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x748,0x1552,0x5a3,0x50f,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x377b,0x1552,0x378b,0x378b,0x378b,0x378b,0x378b,0x378b,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,
+0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x1552,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,
+0x2b23,0x2b23,0x2b23,0x2b23,0x2b23,0x379b,0x440,0x460,0x480,0x4a0,0x4c0,0x4e0,0x500,0x51a,0x53a,0x55a,
+0x57a,0x59a,0x5ba,0x5da,0x5fa,0x615,0xd0,0x635,0x655,0x66a,0x66a,0x66a,0x66a,0x66a,0xd0,0xd0,
+0x68a,0x66a,0x66a,0x66a,0x66a,0x66a,0xd0,0x6aa,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0xd0,0x6ca,0x66a,0x6e6,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0x706,0xd0,0x726,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x746,0x75d,0x66a,0x66a,0x66a,0x66a,0x77d,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x79d,0x7bd,0x7dd,0x7fd,0x81d,0x83d,0x66a,0x66a,
+0x85d,0x66a,0x66a,0x66a,0x87d,0x66a,0x896,0x8b6,0x8d6,0x8f6,0x81d,0x916,0x936,0x956,0x66a,0x66a,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0x976,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x986,0x9a5,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0x9bb,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x9c6,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0xd0,0x9e6,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0xa06,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,
+0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,
+0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0xa26
+};
+
+constexpr uint8_t generalCategory_data[14254]={
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+0xc,0x17,0x17,0x17,0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,
+9,9,9,9,9,9,9,9,9,9,0x17,0x17,0x18,0x18,0x18,0x17,
+0x17,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0x14,0x17,0x15,0x1a,0x16,
+0x1a,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0x14,0x18,0x15,0x18,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xc,
+0x17,0x19,0x19,0x19,0x19,0x1b,0x17,0x1a,0x1b,5,0x1c,0x18,0x10,0x1b,0x1a,0x1b,
+0x18,0xb,0xb,0x1a,2,0x17,0x17,0x1a,0xb,5,0x1d,0xb,0xb,0xb,0x17,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0x18,1,1,1,1,1,1,1,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0x18,2,2,2,2,2,2,2,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,1,2,1,2,1,2,2,1,1,
+2,1,2,1,1,2,1,1,1,2,2,1,1,1,1,2,
+1,1,2,1,1,1,2,2,2,1,1,2,1,1,2,1,
+2,1,2,1,1,2,1,2,2,1,2,1,1,2,1,1,
+1,2,1,2,1,1,2,2,5,1,2,2,2,5,5,5,
+5,1,3,2,1,3,2,1,3,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,2,1,3,
+2,1,2,1,1,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,2,2,2,2,2,2,1,
+1,2,1,1,2,1,2,1,1,1,1,2,1,2,1,2,
+1,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,5,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,4,4,4,4,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,
+4,4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,0x1a,4,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,1,2,
+1,2,4,0x1a,1,2,0,0,4,2,2,2,0x17,1,0,0,
+0,0,0x1a,0x1a,1,0x17,1,1,1,0,1,0,1,1,2,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,
+2,1,1,1,2,2,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,
+2,2,2,1,2,0x18,1,2,1,1,2,2,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,0x1b,6,6,6,
+6,6,7,7,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,0,4,0x17,0x17,0x17,0x17,0x17,0x17,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0x17,0x13,0,0,0x1b,
+0x1b,0x19,0,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+0x13,6,0x17,6,6,0x17,6,6,0x17,6,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
+0,5,5,5,5,0x17,0x17,0,0,0,0,0,0,0,0,0,
+0,0,0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x17,0x17,0x19,0x17,0x17,
+0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,0x17,0x10,0,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,4,5,5,5,5,5,5,5,5,5,5,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,9,9,9,9,9,9,9,9,9,9,0x17,0x17,0x17,0x17,
+5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0x17,5,6,6,6,6,6,6,6,0x10,0x1b,6,6,
+6,6,6,6,4,4,6,6,0x1b,6,6,6,6,5,5,9,
+9,9,9,9,9,9,9,9,9,5,5,5,0x1b,0x1b,5,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0x10,5,
+6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,
+9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,
+6,6,4,4,0x1b,0x17,0x17,0x17,4,0,0,6,0x19,0x19,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,4,6,6,6,6,6,6,6,
+6,6,4,6,6,6,4,6,6,6,6,6,0,0,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,6,6,6,0,0,0x17,0,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
+5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,0x10,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,8,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,8,
+6,5,8,8,6,6,6,6,6,6,6,6,8,8,8,8,
+6,8,8,5,6,6,6,6,6,6,6,5,5,5,5,5,
+5,5,5,5,5,6,6,0x17,0x17,9,9,9,9,9,9,9,
+9,9,9,0x17,4,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,6,8,8,0,5,5,5,5,5,5,5,5,0,
+0,5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
+5,5,5,0,5,0,0,0,5,5,5,5,0,0,6,5,
+8,8,6,6,6,6,0,0,8,8,0,0,8,8,6,5,
+0,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+5,5,5,6,6,0,0,9,9,9,9,9,9,9,9,9,
+9,5,5,0x19,0x19,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,0x19,5,0x17,6,
+0,6,6,8,0,5,5,5,5,5,5,0,0,0,0,5,
+5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
+5,0,5,5,0,5,5,0,5,5,0,0,6,0,8,8,
+6,6,0,0,0,0,6,6,0,0,6,6,6,0,0,0,
+6,0,0,0,0,0,0,0,5,5,5,5,0,5,0,0,
+0,0,0,0,0,9,9,9,9,9,9,9,9,9,9,6,
+6,5,5,5,6,0x17,0,0,0,0,0,0,0,0,0,6,
+6,8,0,5,5,5,5,5,5,5,5,5,0,5,5,5,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
+5,5,0,5,5,5,5,5,0,0,6,5,8,8,6,6,
+6,6,6,0,6,6,8,0,8,8,6,0,0,5,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,6,
+6,0,0,9,9,9,9,9,9,9,9,9,9,0x17,0x19,0,
+0,0,0,0,0,0,5,6,6,6,6,6,6,0,6,8,
+8,0,5,5,5,5,5,5,5,5,0,0,5,5,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,
+5,0,5,5,5,5,5,0,0,6,5,8,6,6,6,6,
+0,0,8,8,0,0,8,8,6,0,0,0,0,0,0,0,
+0,6,8,0,0,0,0,5,5,0,5,5,5,6,6,0,
+0,9,9,9,9,9,9,9,9,9,9,0x1b,5,0xb,0xb,0xb,
+0xb,0xb,0xb,0,0,0,0,0,0,0,0,6,5,0,5,5,
+5,5,5,5,0,0,0,5,5,5,0,5,5,5,5,0,
+0,0,5,5,0,5,0,5,5,0,0,0,5,5,0,0,
+0,5,5,5,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,0,0,0,0,8,8,6,8,8,0,0,0,8,
+8,8,0,8,8,8,6,0,0,5,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+9,9,9,9,9,9,9,9,9,0xb,0xb,0xb,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x19,0x1b,0,0,0,0,0,6,8,8,8,6,5,5,
+5,5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,0,0,5,6,6,8,8,8,8,0,6,6,
+6,0,6,6,6,6,0,0,0,0,0,0,0,6,6,0,
+5,5,5,0,0,0,0,0,5,5,6,6,0,0,9,9,
+9,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,5,6,8,8,0x17,5,5,5,
+5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,5,5,5,0,5,5,5,
+5,5,0,0,6,5,8,6,8,8,8,8,8,0,6,8,
+8,0,8,8,6,6,0,0,0,0,0,0,0,8,8,0,
+0,0,0,0,0,0,5,0,5,5,6,6,0,0,9,9,
+9,9,9,9,9,9,9,9,0,5,5,0,0,0,0,0,
+0,0,0,0,0,0,0,0,6,6,8,8,0,5,5,5,
+5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,6,6,5,8,8,6,6,6,6,0,8,8,8,
+0,8,8,8,6,5,0x1b,0,0,0,0,5,5,5,8,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,5,5,5,6,6,0,0,9,9,9,
+9,9,9,9,9,9,9,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0x1b,5,5,5,5,5,5,0,0,8,8,0,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
+5,5,5,0,5,0,0,5,5,5,5,5,5,5,0,0,
+0,6,0,0,0,0,8,8,8,6,6,6,0,6,0,8,
+8,8,8,8,8,8,8,0,0,0,0,0,0,9,9,9,
+9,9,9,9,9,9,9,0,0,8,8,0x17,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,
+6,0,0,0,0,0x19,5,5,5,5,5,5,4,6,6,6,
+6,6,6,6,6,0x17,9,9,9,9,9,9,9,9,9,9,
+0x17,0x17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,5,5,0,5,0,0,5,5,0,5,
+0,0,5,0,0,0,0,0,0,5,5,5,5,0,5,5,
+5,5,5,5,5,0,5,5,5,0,5,0,5,0,0,5,
+5,0,5,5,5,5,6,5,5,6,6,6,6,6,6,0,
+6,6,5,0,0,5,5,5,5,5,0,4,0,6,6,6,
+6,6,6,0,0,9,9,9,9,9,9,9,9,9,9,0,
+0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,5,0x1b,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1b,0x17,0x1b,0x1b,0x1b,6,6,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,9,9,9,9,9,9,9,9,9,9,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,6,0x1b,6,0x1b,6,0x14,
+0x15,0x14,0x15,8,8,5,5,5,5,5,5,5,5,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,0,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,8,6,6,6,6,6,0x17,6,6,5,5,5,
+5,5,6,6,6,6,6,6,6,6,6,6,6,0,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,0x1b,0x17,0x17,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
+6,6,6,6,8,6,6,6,6,6,6,8,6,6,8,8,
+6,6,5,9,9,9,9,9,9,9,9,9,9,0x17,0x17,0x17,
+0x17,0x17,0x17,5,5,5,5,5,5,8,8,6,6,5,5,5,
+5,6,6,6,5,8,8,8,5,5,8,8,8,8,8,8,
+8,5,5,5,6,6,6,6,5,5,5,5,5,5,5,5,
+5,5,5,6,8,8,6,6,8,8,8,8,8,8,6,5,
+8,9,9,9,9,9,9,9,9,9,9,8,8,8,6,0x1b,
+0x1b,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0,1,0,0,0,0,0,1,0,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0x17,4,2,2,2,5,5,5,5,5,
+5,5,5,5,0,5,5,5,5,0,0,5,5,5,5,5,
+5,5,0,5,0,5,5,5,5,0,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,5,5,5,5,0,0,5,5,5,5,5,5,
+5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
+0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,2,2,2,2,
+2,2,0,0,0x13,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x17,0x17,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0xc,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x14,0x15,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x17,0x17,0x17,0xa,0xa,0xa,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0,5,5,5,5,6,6,6,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,6,0x17,0x17,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,0,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0,5,5,5,0,6,6,0,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,6,6,8,6,6,
+6,6,6,6,6,8,8,8,8,8,8,6,8,8,6,6,
+6,6,6,6,6,6,6,6,6,0x17,0x17,0x17,4,0x17,0x17,0x17,
+0x19,5,6,0,0,9,9,9,9,9,9,9,9,9,9,0,
+0,0,0,0,0,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0,
+0,0,0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x13,0x17,0x17,0x17,0x17,
+6,6,6,0x10,0,9,9,9,9,9,9,9,9,9,9,0,
+0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+0,0,5,5,5,5,5,6,6,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,6,5,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,6,6,6,8,8,8,8,6,6,8,8,8,0,0,
+0,0,8,8,6,8,8,8,8,8,8,6,6,6,0,0,
+0,0,0x1b,0,0,0,0x17,0x17,9,9,9,9,9,9,9,9,
+9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,0,0,0,9,9,9,9,9,9,9,9,
+9,9,0xb,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+6,8,8,6,0,0,0x17,0x17,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,8,6,8,6,6,6,6,6,
+6,6,0,6,8,6,8,8,6,6,6,6,6,6,6,6,
+8,8,8,8,8,8,6,6,6,6,6,6,6,6,6,6,
+0,0,6,9,9,9,9,9,9,9,9,9,9,0,0,0,
+0,0,0,9,9,9,9,9,9,9,9,9,9,0,0,0,
+0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,4,0x17,0x17,0x17,0x17,0x17,
+0x17,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,6,6,6,6,8,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,6,8,6,6,6,6,6,8,6,8,
+8,8,6,8,8,5,5,5,5,5,5,5,0,0,0,0,
+9,9,9,9,9,9,9,9,9,9,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,6,
+6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
+6,6,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,8,6,6,6,6,8,8,6,6,8,6,6,6,5,5,
+9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+6,8,6,6,8,8,8,6,8,6,6,6,8,8,0,0,
+0,0,0,0,0,0,0x17,0x17,0x17,0x17,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
+8,8,8,8,8,8,6,6,6,6,6,6,6,6,8,8,
+6,6,0,0,0,0x17,0x17,0x17,0x17,0x17,9,9,9,9,9,9,
+9,9,9,9,0,0,0,5,5,5,9,9,9,9,9,9,
+9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,4,4,4,4,4,4,0x17,0x17,2,2,2,2,2,2,
+2,2,2,0,0,0,0,0,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,1,1,1,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0,0,0,0,0,0,0,0,6,6,6,0x17,6,6,
+6,6,6,6,6,6,6,6,6,6,6,8,6,6,6,6,
+6,6,6,5,5,5,5,6,5,5,5,5,8,8,6,5,
+5,8,6,6,0,0,0,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,2,2,2,2,2,2,2,2,2,2,2,2,2,4,2,
+2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+0,6,6,6,6,6,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,2,2,2,2,2,2,2,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,2,
+2,2,2,2,2,2,2,0,1,0,1,0,1,0,1,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,
+2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,
+2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,
+2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,
+2,2,2,2,0,2,2,1,1,1,1,3,0x1a,2,0x1a,0x1a,
+2,2,2,0,2,2,1,1,1,1,3,0x1a,0x1a,0x1a,2,2,
+2,2,0,0,2,2,1,1,1,1,0,0x1a,0x1a,0x1a,2,2,
+2,2,2,2,2,2,1,1,1,1,1,0x1a,0x1a,0x1a,0,0,
+2,2,2,0,2,2,1,1,1,1,3,0x1a,0x1a,0,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x10,0x10,0x10,0x10,0x10,0x13,0x13,
+0x13,0x13,0x13,0x13,0x17,0x17,0x1c,0x1d,0x14,0x1c,0x1c,0x1d,0x14,0x1c,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0xd,0xe,0x10,0x10,0x10,0x10,0x10,0xc,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x16,0x17,0x17,
+0x17,0x18,0x14,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x18,
+0x17,0x16,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xc,0x10,0x10,0x10,
+0x10,0x10,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xb,4,0,
+0,0xb,0xb,0xb,0xb,0xb,0xb,0x18,0x18,0x18,0x14,0x15,4,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x18,0x18,0x18,0x14,0x15,0,4,4,4,
+4,4,4,4,4,4,4,4,4,4,0,0,0,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,
+6,6,6,6,6,6,6,6,6,6,7,7,7,7,6,7,
+7,7,6,6,6,6,6,6,6,6,6,6,6,6,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,1,
+0x1b,0x1b,0x1b,0x1b,1,0x1b,0x1b,2,1,1,1,2,2,1,1,1,
+2,0x1b,1,0x1b,0x1b,0x18,1,1,1,1,1,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,1,0x1b,1,0x1b,1,0x1b,1,1,1,1,0x1b,2,1,1,1,
+1,2,5,5,5,5,2,0x1b,0x1b,2,2,1,1,0x18,0x18,0x18,
+0x18,0x18,1,2,2,2,2,0x1b,0x18,0x1b,0x1b,2,0x1b,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,1,2,0xa,
+0xa,0xa,0xa,0xb,0x1b,0x1b,0,0,0,0,0x18,0x18,0x18,0x18,0x18,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x18,0x1b,0x1b,
+0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x18,0x1b,
+0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x14,0x15,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
+0x15,0x14,0x15,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x18,0x18,0x18,
+0x18,0x18,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,
+0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
+0x15,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,
+0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,0,1,2,1,1,1,2,2,1,2,1,2,1,2,1,
+1,1,1,2,1,2,2,1,2,2,2,2,2,2,4,4,
+1,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,2,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,1,2,1,2,
+6,6,6,1,2,0,0,0,0,0,0x17,0x17,0x17,0x17,0xb,0x17,
+0x17,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,0,0,0,0,0,2,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,
+4,0x17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,
+0,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,
+0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,0x17,0x17,0x1c,0x1d,0x1c,0x1d,0x17,0x17,0x17,0x1c,0x1d,0x17,0x1c,0x1d,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x13,0x17,0x17,0x13,0x17,0x1c,0x1d,0x17,
+0x17,0x1c,0x1d,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x17,0x17,0x17,
+4,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x13,0x13,0x17,0x17,0x17,
+0x17,0x13,0x17,0x14,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0xc,
+0x17,0x17,0x17,0x1b,4,5,0xa,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
+0x15,0x1b,0x1b,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x13,0x14,0x15,0x15,0x1b,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,6,6,6,6,8,8,0x13,
+4,4,4,4,4,0x1b,0x1b,0xa,0xa,0xa,4,5,0x17,0x1b,0x1b,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0,6,6,0x1a,0x1a,4,4,5,0x13,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x17,4,4,4,5,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,0x1b,0x1b,0xb,0xb,0xb,0xb,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
+0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0x1b,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,0x17,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,4,0x17,0x17,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,9,9,9,9,9,9,9,9,9,9,5,5,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,5,
+6,7,7,7,0x17,6,6,6,6,6,6,6,6,6,6,0x17,
+4,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,4,4,6,
+6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,
+0,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,
+4,0x1a,0x1a,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,4,2,2,2,2,2,2,2,2,1,2,1,2,
+1,1,2,1,2,1,2,1,2,4,0x1a,0x1a,1,2,1,2,
+5,1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,1,1,1,1,
+2,1,1,1,1,1,2,1,2,1,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,5,4,4,2,5,5,5,5,5,6,5,5,5,6,
+5,5,5,5,6,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,8,8,6,6,
+8,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,
+0x1b,0x19,0x1b,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,
+0x17,0,0,0,0,0,0,0,0,8,8,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,
+8,8,8,8,8,8,8,8,8,6,6,0,0,0,0,0,
+0,0,0,0x17,0x17,9,9,9,9,9,9,9,9,9,9,0,
+0,0,0,0,0,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,5,5,5,5,5,5,0x17,0x17,0x17,
+5,0x17,5,5,6,9,9,9,9,9,9,9,9,9,9,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,
+6,6,6,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,
+8,8,0,0,0,0,0,0,0,0,0,0,0,0x17,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,0,0,6,6,
+6,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,6,8,8,6,6,6,6,8,8,6,8,8,8,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,4,9,9,9,
+9,9,9,9,9,9,9,0,0,0,0,0x17,0x17,5,5,5,
+5,5,6,4,5,5,5,5,5,5,5,5,5,9,9,9,
+9,9,9,9,9,9,9,5,5,5,5,5,0,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,6,6,6,6,6,6,8,8,6,6,
+8,8,6,6,0,0,0,0,0,0,0,0,0,5,5,5,
+6,5,5,5,5,5,5,5,5,6,8,0,0,9,9,9,
+9,9,9,9,9,9,9,0,0,0x17,0x17,0x17,0x17,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,4,5,5,
+5,5,5,5,0x1b,0x1b,0x1b,5,8,6,8,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,6,5,6,6,6,
+5,5,6,6,5,5,5,5,5,6,6,5,6,5,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,5,5,4,0x17,0x17,5,5,5,5,5,
+5,5,5,5,5,5,8,6,6,8,8,0x17,0x17,5,4,4,
+8,6,0,0,0,0,0,0,0,0,0,5,5,5,5,5,
+5,0,0,5,5,5,5,5,5,0,0,5,5,5,5,5,
+5,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0x1a,4,4,4,4,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,6,
+8,8,6,8,8,0x17,8,6,0,0,9,9,9,9,9,9,
+9,9,9,9,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0,0,0,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,2,2,2,2,2,0,0,0,0,0,
+5,6,5,5,5,5,5,5,5,5,5,5,0x18,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,
+0,5,0,5,5,0,5,5,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0x15,0x14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,0x19,0x1b,0,0,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x14,0x15,0x17,0,0,0,0,0,0,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,0x17,0x13,0x13,0x16,0x16,0x14,
+0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x14,0x15,0x17,
+0x17,0x17,0x17,0x16,0x16,0x16,0x17,0x17,0x17,0,0x17,0x17,0x17,0x17,0x13,0x14,
+0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x17,0x18,0x13,0x18,0x18,0x18,0,0x17,0x19,
+0x17,0x17,0,0,0,0,5,5,5,5,5,0,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0x10,0,0x17,0x17,0x17,
+0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,9,9,9,9,
+9,9,9,9,9,9,0x17,0x17,0x18,0x18,0x18,0x17,0x17,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x14,0x17,0x15,0x1a,0x16,0x1a,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0x14,0x18,0x15,0x18,0x14,0x15,0x17,0x14,0x15,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,4,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,4,4,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0,0,5,5,
+5,5,5,5,0,0,5,5,5,5,5,5,0,0,5,5,
+5,5,5,5,0,0,5,5,5,0,0,0,0x19,0x19,0x18,0x1a,
+0x1b,0x19,0x19,0,0x1b,0x18,0x18,0x18,0x18,0x1b,0x1b,0,0,0,0,0,
+0,0,0,0,0,0x10,0x10,0x10,0x1b,0x1b,0,0,5,5,5,5,
+5,5,5,5,5,5,5,0,5,5,0,5,0x17,0x17,0x17,0,
+0,0,0,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0,0,0,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xa,0xa,0xa,0xa,0xa,0xb,0xb,0xb,
+0xb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xb,0xb,0x1b,0x1b,0x1b,
+0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0,
+0,6,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0,0,0,0,0,0,0,0,0,5,5,5,0xa,5,5,
+5,5,5,5,5,5,0xa,0,0,0,0,0,5,5,5,5,
+5,5,6,6,6,6,6,0,0,0,0,0,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,0x17,0xa,0xa,0xa,0xa,
+0xa,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,
+0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,0,
+0,0,0x17,5,5,5,5,5,5,0,0,5,0,5,5,5,
+5,5,5,0,5,5,0,0,0,5,0,0,5,5,5,5,
+5,5,0,0x17,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,5,5,5,5,
+5,5,5,0x1b,0x1b,0xb,0xb,0xb,0xb,0xb,0xb,0xb,5,5,5,0,
+5,5,0,0,0,0,0,0xb,0xb,0xb,0xb,0xb,5,5,5,5,
+5,5,0xb,0xb,0xb,0xb,0xb,0xb,0,0,0,0x17,5,5,5,5,
+5,5,5,5,5,5,0,0,0,0,0,0x17,5,5,5,5,
+5,5,5,5,0,0,0,0,0xb,0xb,5,5,6,6,6,0,
+6,6,0,0,0,0,0,6,6,6,6,5,5,5,5,5,
+5,0,0,6,6,6,0,0,0,0,6,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0xb,0xb,0x17,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0xb,0xb,0xb,5,5,5,5,5,
+5,5,5,0x1b,5,5,5,5,5,5,5,6,6,0,0,0,
+0,0xb,0xb,0xb,0xb,0xb,5,5,5,5,5,5,0,0,0,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,5,5,5,0,0,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,5,5,5,0,0,0,0,0,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,5,5,0,0,0,0,0,0,0,0x17,
+0x17,0x17,0x17,0,0,0,1,1,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,2,2,0,0,0,0,0,0,0,
+0xb,0xb,0xb,0xb,0xb,0xb,5,5,5,5,6,6,6,6,0,0,
+0,0,0,0,0,0,0xb,0xb,0xb,0xb,0xb,0xb,0xb,5,0,0,
+0,0,0,0,0,0,6,0xb,0xb,0xb,0xb,0x17,0x17,0x17,0x17,0x17,
+0,0,0,0,0,0,6,6,6,6,6,6,6,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0,0,0xb,0xb,0xb,0xb,0xb,0xb,9,9,9,9,
+9,9,9,9,9,9,8,8,8,6,6,6,6,8,8,6,
+6,0x17,0x17,0x10,0x17,0x17,0,0,0,0,0,0,0,0,0,0,
+0,0x10,0,0,6,6,6,5,5,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,6,8,6,6,6,6,6,0,
+9,9,9,9,9,9,9,9,9,9,0x17,0x17,0x17,0x17,5,8,
+8,0,0,0,0,0,0,0,0,0,5,5,5,6,0x17,0x17,
+5,0,0,0,0,0,0,0,0,0,5,5,5,8,8,8,
+6,6,6,6,6,6,6,6,6,8,5,5,5,5,0x17,0x17,
+0x17,0x17,6,6,6,6,0x17,0,0,9,9,9,9,9,9,9,
+9,9,9,5,0x17,5,0x17,0x17,0x17,0xb,0xb,0xb,0xb,0xb,0,0,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,8,8,8,6,6,8,8,6,8,6,6,
+0x17,0x17,0x17,0x17,0x17,0x17,6,0,5,5,5,5,5,5,5,0,
+5,0,5,5,5,5,0,5,5,5,5,5,5,5,5,5,
+0x17,0,0,0,0,0,0,8,8,8,6,6,6,6,6,6,
+6,6,0,0,0,0,0,6,6,8,8,0,5,5,5,5,
+5,5,5,5,0,0,5,0,5,5,0,5,5,5,5,5,
+0,6,6,5,8,8,6,8,8,8,8,0,0,8,8,0,
+0,8,8,8,0,0,5,0,0,0,0,0,0,8,0,0,
+0,0,0,5,5,5,8,8,0,0,6,6,6,6,6,6,
+6,0,0,0,5,5,5,5,5,8,8,8,6,6,6,6,
+6,6,6,6,8,8,6,6,6,8,6,5,5,5,5,0x17,
+0x17,0x17,0x17,0x17,9,9,9,9,9,9,9,9,9,9,0,0x17,
+0,0x17,6,0,8,8,8,6,6,6,6,6,6,8,6,8,
+8,8,8,6,8,6,6,5,5,0x17,5,0,0,0,0,0,
+0,0,0,8,8,6,6,6,6,0,0,8,8,8,8,6,
+6,8,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,5,5,5,5,6,6,0,0,8,8,8,6,6,6,
+6,6,6,6,6,8,8,6,8,6,0x17,0x17,0x17,5,0,0,
+0,0,0,0,0,0,0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,6,8,6,8,8,6,6,6,6,6,6,8,
+6,0,0,0,0,0,0,0,0,8,8,6,6,6,6,8,
+6,6,6,6,6,0,0,0,0,9,9,9,9,9,9,9,
+9,9,9,0xb,0xb,0x17,0x17,0x17,0x1b,6,6,6,6,6,6,6,
+6,8,6,6,0x17,0,0,0,0,0xb,0xb,0xb,0,0,0,0,
+0,0,0,0,0,0,0,0,5,6,6,6,6,6,6,6,
+6,6,6,5,5,5,5,5,6,6,6,6,6,6,8,5,
+6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,6,0,0,0,0,
+0,0,0,0,5,6,6,6,6,6,6,8,8,6,6,6,
+5,5,5,5,0,0,5,5,5,5,6,6,6,6,6,6,
+6,8,6,6,0x17,0x17,0x17,5,0x17,0x17,6,6,6,6,6,6,
+6,0,6,6,6,6,6,6,8,6,5,0x17,0x17,0x17,0x17,0x17,
+0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,6,
+6,6,0,8,6,6,6,6,6,6,8,6,6,8,6,6,
+0,0,0,0,0,0,0,0,0,5,6,6,6,6,6,6,
+0,0,0,6,0,6,6,0,6,6,6,6,6,6,5,6,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,5,
+5,0,5,5,5,5,5,5,5,5,5,5,8,8,8,8,
+8,0,6,6,0,8,8,6,8,6,5,0,0,0,0,0,
+0,0,5,5,5,6,6,8,8,0x17,0x17,0,0,0,0,0,
+0,0,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0,6,6,6,6,6,0x17,0,0,0,0,0,0,0,0,
+0,0,6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,
+0x1b,0x1b,4,4,4,4,0x17,0x1b,0,0,0,0,0,0,0,0,
+0,0,9,9,9,9,9,9,9,9,9,9,0,0xb,0xb,0xb,
+0xb,0xb,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,5,5,5,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x17,
+0x17,0x17,0x17,0,0,0,0,0,5,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,0,6,6,6,4,4,4,
+4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,0,0,0x1b,6,6,0x17,0x10,0x10,0x10,0x10,0,0,0,0,
+0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,8,8,6,
+6,6,0x1b,0x1b,0x1b,8,8,8,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+6,6,6,6,6,0x1b,0x1b,6,6,6,6,6,6,6,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,0x1b,0x1b,6,6,
+6,0x1b,0,0,0,0,0,0,0,0,0,0,0xb,0xb,0xb,0xb,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,
+1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+2,0,2,2,2,2,2,2,2,2,2,2,2,2,1,0,
+1,1,0,0,1,0,0,1,1,0,0,1,1,1,1,0,
+1,1,1,1,1,1,2,2,2,2,0,2,0,2,2,2,
+2,1,1,0,1,1,1,1,0,0,1,1,1,1,1,0,
+1,1,1,1,1,1,1,0,2,2,2,2,2,2,2,2,
+1,1,0,1,1,1,1,0,1,1,1,1,1,0,1,0,
+0,0,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+2,2,2,2,1,1,1,1,2,2,2,2,2,2,0,0,
+1,1,1,1,1,1,1,1,0x18,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,
+1,1,0x18,2,2,2,2,2,0x18,2,2,2,2,2,2,1,
+1,1,1,1,1,1,1,1,0x18,2,2,2,2,2,2,0x18,
+2,2,2,2,2,2,1,2,0,0,9,9,9,9,9,9,
+9,9,9,9,9,9,9,9,9,9,6,6,6,6,6,6,
+6,0x1b,0x1b,0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,
+6,6,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,6,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0,0,0,0,6,6,
+6,6,6,6,6,6,6,0,0,6,6,6,6,6,0,6,
+6,0,6,6,6,6,6,0,0,0,0,0,5,5,5,5,
+5,0,0,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,2,2,2,2,
+6,6,6,6,6,6,6,0,0,0,0,0,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x1b,0xb,0xb,0xb,0x19,0xb,0xb,0xb,
+0xb,0,0,0,0,0,0,0,0,0,0,0,5,5,0,5,
+0,0,5,0,5,5,5,5,5,5,5,0,5,5,5,5,
+0,5,0,5,0,0,0,0,5,0,0,0,0,5,0,5,
+0,5,0,5,5,5,0,5,5,0,5,0,0,5,0,5,
+0,5,0,5,0,5,5,0,5,0,0,5,5,5,5,0,
+5,5,5,5,0,5,5,5,5,0,5,0,5,5,5,0,
+5,5,5,5,5,0,5,5,5,5,5,0x18,0x18,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1a,0x1a,0x1a,0x1a,0x1a,0x1b,0,0,0x1b,0x1b,
+0x1b,0x1b,0,0,0,0x1b,0,0x1b,0x1b,0x1b,0x1b,0,0x10,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0,0,0,0,0
+};
+
+constexpr uint16_t whiteSpace_index[1024]={
+0,0x40,0x7b,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x20,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0xbb,0xeb,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x20,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40
+};
+
+constexpr uint8_t whiteSpace_data[300]={
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+constexpr uint16_t alphabetic_index[2357]={
+0,0x40,0x7b,0xbb,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x131,0,0x16c,0x1ac,0x1cf,
+0xf3,0xf3,0x20d,0xf3,0x21d,0x24e,0x285,0x2c3,0x2f6,0x31e,0xf3,0x34c,0x38c,0x38f,0x39d,0x3d3,
+0x413,0x453,0x47e,0x4bc,0x4ec,0x51b,0x557,0x594,0x5d3,0x611,0x650,0x68d,0x6cc,0x709,0x747,0x785,
+0x7c5,0x802,0x842,0x87f,0x8bf,0x8fc,0x93c,0x97c,0x9bb,0x9ef,0xa2e,0xa6e,0xa8d,0xacd,0xb0b,0,
+0xb4b,0xb8b,0xbc4,0xbfe,0xf3,0xf3,0xf3,0xf3,0xf3,0xc30,0xc67,0xca5,0xcd4,0xcf9,0xd39,0xd59,
+0xf2,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xd99,0xdc7,0xde7,0xe27,0xe47,0xe87,0xebe,
+0xede,0xefe,0xf3e,0xf6e,0xfae,0xfe7,0x1027,0x105d,0x109d,0x10be,0x10f3,0,0x219,0x1133,0x1173,0x11ad,
+0xf6e,0x11e0,0x1215,0x1255,0xf3,0xf3,0xf3,0x128c,0xf3,0xf3,0xf3,0xf3,0xd79,0x12cc,0x130c,0x134b,
+0,0x1388,0x13c8,0,0x1406,0x1446,0x147d,0,0,0,0,0,0,0,0,0,
+0,0,0xb,0x14bd,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x21e,0xd3,0xf3,0x14fd,0x153d,0x156d,0x15ad,0x15cd,0x160d,0,0,0,0,0,0,0,
+0x1648,0xf2,0x1688,0x16a9,0x16e9,0xf3,0x171a,0x11,0,0,0,0,0,0,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf6e,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x175a,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0x105a,0x178a,0xf3,0xf3,0xf3,0xf3,0x17bb,0x17fb,0xf3,0x175a,0x183b,0xf3,0x1852,0xa,
+0x1892,0x18d2,0xf3,0x1912,0x1951,0x1981,0x21a,0x19be,0x19fe,0x1a27,0xf4,0x1a66,0x1aa5,0x1ad5,0xf3,0x1b05,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x1b45,0x1b7e,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf3,0xf3,0xf3,0xf3,0xf3,0x1bbe,0xf3,0x61,0x1bf7,0x1c37,0x39d,0xeeb,
+0xf3,0xf3,0xf3,0xf3,0xf5,0x38c,0x12fa,0x1c6f,0,0x1cab,0xf3,0xf6,0x20,0x1ce0,0xf4,0x1d20,
+0x873,0x891,0x8ae,0x8cd,0x8ed,0x8ed,0x8fa,0x917,0xc6,0xf3,0xcb,0x2b8,0x4d,0x4d,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x50,0,0,0,0,0xf3,0xf3,0xf3,0x76,
+0,0,0,0,0,0,0,0,0xf3,0x4e,0xf3,0xf3,0xf3,0x7a,0,0,
+0xf3,0xf3,0x34,0xf3,0x50,0xf3,0xf3,0x50,0xf3,0x4d,0xf3,0xf3,0x12f,0x5b2,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x4d,0,0xf3,0xf3,0x12f,0xf3,0x4f,
+0xf3,0xf3,0x73,0xf3,0xf3,0xf3,0x77,0,0,0,0,0,0,0,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0x74,0xf3,0x75,0x73,0,0,0,0,0,0,0,0,0,
+0x1d60,0xf3,0xf3,0x1d6a,0xf3,0x75,0xf3,0x74,0xf3,0x4c,0,0,0,0,0xf3,0xe75,
+0xf3,0x75,0xf3,0x51,0,0,0,0,0xf3,0xf3,0xf3,0x53,0,0,0,0,
+0x1d79,0x65a,0xf3,0x75,0,0,0xf3,0x4e,0xf3,0x4e,0,0,0xca,0xf3,0x76,0,
+0xf3,0xf3,0xf3,0x75,0xf3,0x75,0xf3,0x78,0xf3,0x79,0,0,0,0,0,0,
+0xf3,0xf3,0xf3,0xf3,0x72,0,0,0,0xf3,0xf3,0xf3,0x78,0xf3,0xf3,0xf3,0x78,
+0xf3,0xf3,0x73,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf3,0x4e,0x9e,0xf3,0x75,0,0,0,0,0,0,0,0,
+0,0,0,0xf3,0xf3,0xf3,0xf3,0x75,0,0,0,0x3f,0xf3,0xf3,0x72,0,
+0xf3,0x72,0,0xf3,0xf3,0xf3,0x78,0x375,0xf3,0xf3,0x1834,0xf3,0xf3,0xf3,0xf3,0x2f1,
+0x1d89,0,0,0xf3,0xd0,0xf3,0x1d99,0,0,0,0,0x1da9,0xc4,0x72,0xf3,0xf3,
+0xf3,0x72,0,0x557,0x42a,0xc9,0x680,0x709,0x1db8,0x77,0,0,0,0,0,0,
+0,0,0,0xf3,0xf3,0xf3,0xf3,0x1dc6,0,0,0,0xf3,0xf3,0xf3,0xf3,0x59b,
+0,0,0,0,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,0x1dd6,0,
+0x639,0,0,0xf3,0xf3,0xf3,0x4c,0x699,0,0,0,0xf3,0xf3,0xf3,0x75,0,
+0,0,0,0xf3,0x420,0x50,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf3,0xf3,0xf3,0x72,0,0,0,0,0,0,0xf3,0xf3,0xf3,
+0xf3,0,0x32,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf3,0xf3,0xf3,0xeb8,0,0xf3,0xf3,0xf3,0x427,0x1de6,0,0,0xf3,
+0xf3,0xf3,0x72,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xc9,0xf3,0xf3,0x32f,0x7a,0,0,0x3f,0xf3,0x3f,0xca,0x74,0,
+0,0,0,0x67a,0xf3,0xf3,0x1df6,0x1e02,0,0x1e12,0xf3,0x4c,0x1e20,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf3,0x74,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x51,0,0,0,0,0,0,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0x4c,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0x77,0,0,0,0,0,0,0,0,0,0,0,0xf3,0xf3,0x4c,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,
+0xf3,0x74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,
+0x72,0xf3,0x4c,0,0,0,0,0,0,0,0xf3,0x4d,0,0xf3,0xf3,0xf3,
+0x74,0x77,0,0x3e,0x309,0xf3,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,
+0xf3,0,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,0xf3,0x76,0xf3,0xf3,
+0x4c,0,0x3e,0,0,0,0,0x79,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x79,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x78,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x4c,0,0,0,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x4f,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x50,0x4e,0x72,0xd0a,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xcd,0xf3,0xf3,0xf3,0xc5,0x1e2e,0x1e3c,0xce,0xf3,0xf3,0xf3,
+0xc33,0x5f7,0xf3,0xc2f,0x1e49,0xd1,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0x425,0xf3,0xd1,0xc7,0xf3,0xc7,0xf3,0xcd,0xf3,0xcd,0x4c,0xf3,0x4c,0xf3,0xc9,0xf3,
+0xc9,0xf3,0x35d,0,0,0,0xcb,0x422,0x1e57,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0x76,0,0,0,0xf3,0xf3,0xf3,0xf3,0x1833,0,0,0,0,0,
+0,0,0,0,0,0,0xce,0xf3,0x1e66,0x1e73,0x1e81,0x1e91,0x1e9f,0x1ea7,0xc8,0x4f,
+0x1eb6,0x4f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf3,0x51,0xf3,0x51,0xf3,0x51,0,0,0,0,
+0,0,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0x74,0,0,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0x76,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0x4d,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0x79,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+0xf3,0x7a,0,0xf3,0x4d,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x408,0x420,0x440,0x460,0x480,0x4a0,0x4c0,0x4d3,0x4f3,0x513,0x533,0x553,0x573,
+0x593,0x5b3,0x5cd,0xd0,0x5ed,0x60d,0x360,0x360,0x360,0x360,0x360,0xd0,0xd0,0x62d,0x360,0x360,
+0x360,0x360,0x360,0xd0,0x64d,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0xd0,0x66d,0x360,0x689,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0x6a9,0xd0,0x6c9,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0x360,0x6e9,0x700,0x360,0x360,0x360,0x360,0x720,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x740,0x756,0x360,0x360,0x360,0x360,0x776,0x360,0x360,
+0x360,0x796,0x360,0x360,0x7b6,0x7c3,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x7e3,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0x7f3,0x812,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x828,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x833,0x360,0x360,0x360,
+0x360,0x360,0x360,0xd0,0x853
+};
+
+constexpr uint8_t alphabetic_data[7882]={
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,0,0,0,0,0,0,0,1,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+1,0,1,1,0,0,1,1,1,1,0,1,0,0,0,0,
+0,0,1,0,1,1,1,0,1,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,1,0,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+1,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,
+1,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,
+0,0,0,0,0,0,1,1,1,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,1,1,0,0,0,0,1,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,1,1,1,1,1,1,1,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,1,1,1,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,
+1,1,1,1,0,0,1,1,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,1,1,1,0,1,0,0,0,1,1,1,
+1,0,0,0,1,1,1,1,1,0,0,1,1,0,0,1,
+1,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,
+1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,1,1,1,0,1,1,1,1,1,1,0,0,
+0,0,1,1,0,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,
+1,1,1,1,0,1,1,0,1,1,0,1,1,0,0,0,
+0,1,1,1,0,0,0,0,1,1,0,0,1,1,0,0,
+0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+0,1,1,1,0,1,1,1,1,1,1,1,1,1,0,1,
+1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,
+1,0,1,1,0,1,1,1,1,1,0,0,0,1,1,1,
+1,1,1,0,1,1,1,0,1,1,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,0,0,0,1,1,1,
+0,1,1,1,1,1,1,1,1,0,0,1,1,0,0,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,
+0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,
+1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,1,
+1,0,0,0,0,1,1,0,1,1,1,1,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,1,
+1,1,0,0,0,1,1,1,0,1,1,1,1,0,0,0,
+1,1,0,1,0,1,1,0,0,0,1,1,0,0,0,1,
+1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+1,0,0,0,0,1,1,1,0,0,0,1,1,1,0,1,
+1,1,0,0,0,1,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,1,1,0,1,1,1,1,1,1,
+1,1,0,1,1,1,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+0,0,1,1,1,1,1,0,1,1,1,0,1,1,1,0,
+0,0,0,0,0,0,0,1,1,0,1,1,1,0,0,0,
+0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,1,1,1,0,1,1,1,1,1,1,1,1,0,
+1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,
+1,1,1,1,1,1,0,1,1,1,1,1,0,0,0,1,
+1,1,1,1,0,1,1,1,0,1,1,1,0,0,0,0,
+0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,1,1,0,1,1,1,1,1,1,1,1,0,1,1,1,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,
+1,0,1,1,1,0,1,1,1,0,1,0,0,0,0,0,
+1,1,1,1,0,0,0,0,0,0,0,1,1,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+1,1,1,1,1,1,1,1,0,1,0,0,1,1,1,1,
+1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,
+1,0,1,0,1,1,1,1,1,1,1,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,0,1,0,0,1,1,0,1,0,0,1,0,0,0,0,
+0,0,1,1,1,1,0,1,1,1,1,1,1,1,0,1,
+1,1,0,1,0,1,0,0,1,1,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,1,1,1,0,0,1,1,
+1,1,1,0,1,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,1,0,0,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+1,1,1,1,0,0,0,0,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,1,0,0,0,0,0,1,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,1,1,1,1,0,0,
+1,1,1,1,1,1,1,0,1,0,1,1,1,1,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,1,1,1,1,0,0,1,
+1,1,1,1,1,1,0,1,1,1,1,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,1,1,1,1,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,1,1,1,0,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,
+1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,
+1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,1,1,1,1,1,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,0,1,1,1,1,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+1,1,0,1,1,1,1,1,1,0,1,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,
+1,1,1,1,0,1,0,1,0,1,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0,1,1,1,1,1,1,1,0,1,0,0,1,1,1,
+0,1,1,1,1,1,1,1,0,0,0,1,1,1,1,0,
+0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,1,
+0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,
+1,1,1,1,1,1,1,1,1,1,0,1,0,0,0,1,
+1,1,1,1,0,0,0,0,0,0,1,0,1,0,1,0,
+1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,
+0,0,1,1,1,1,0,0,0,0,0,1,1,1,1,1,
+0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,1,
+1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,1,0,0,0,0,0,1,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,
+1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,
+1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,
+1,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,
+1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+0,0,0,0,0,1,1,1,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,1,1,1,1,0,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,
+1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,1,1,1,1,1,1,1,1,0,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+0,0,1,1,0,1,1,1,0,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,1,1,1,1,0,0,0,1,0,1,
+1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+1,1,1,0,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,1,0,0,0,1,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,
+1,1,1,1,0,0,1,1,1,1,1,1,0,0,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,0,1,1,1,
+1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,
+0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+1,1,1,1,0,1,0,1,1,0,1,1,0,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,
+0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,0,0,1,0,1,1,1,1,1,1,
+0,1,1,0,0,0,1,0,0,1,1,1,1,0,1,1,
+0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,
+0,0,0,1,0,1,0,0,0,1,1,1,1,1,0,0,
+1,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,
+0,1,0,1,1,1,1,0,1,0,0,0,0,0,0,1,
+0,0,0,0,0,1,1,1,0,1,1,1,0,1,1,1,
+1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,
+1,1,1,1,1,0,1,1,1,1,1,1,1,1,0,0,
+0,0,0,1,0,0,1,1,1,1,1,1,1,0,0,0,
+1,0,1,1,0,1,0,0,1,1,0,0,0,0,0,0,
+0,0,1,1,1,1,1,1,0,1,1,0,1,1,1,1,
+1,1,0,1,1,1,1,0,1,0,0,0,0,0,0,0,
+1,0,0,1,1,0,0,1,1,1,1,0,1,1,1,1,
+1,1,1,1,1,1,0,1,0,1,1,1,1,1,0,1,
+0,0,0,1,1,1,1,1,1,0,1,1,0,1,1,1,
+1,1,0,0,0,0,0,1,1,0,1,0,0,1,0,1,
+1,1,1,1,1,1,0,1,1,1,1,0,1,0,1,0,
+0,0,0,1,0,0,0,0,1,0,1,0,1,0,1,1,
+1,0,1,1,0,1,0,0,1,0,1,0,1,0,1,0,
+1,1,0,1,0,0,1,1,1,1,0,1,1,1,1,0,
+1,1,1,1,0,1,0,1,1,1,0,1,1,1,1,1,
+0,1,1,1,1,1,0,0,0,0
+};
+
+constexpr uint16_t script_index[2873]={
+0,0x40,0x7b,0xbb,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xfa,0x133,0x173,0x183,0x1c3,0x1e6,
+0x226,0x226,0x261,0x226,0x271,0x2a2,0x2d9,0x311,0x351,0x391,0x3c2,0x3e5,0x425,0x45a,0x49a,0x4da,
+0x51a,0x55a,0x585,0x5c3,0x603,0x632,0x672,0x6ae,0x6ed,0x72b,0x76a,0x7a6,0x7e6,0x822,0x860,0x89e,
+0x8de,0x91b,0x95b,0x997,0x9d7,0xa12,0xa52,0xa92,0xad1,0xb11,0xb50,0xb90,0xbd0,0xc08,0xc39,0xc69,
+0xca9,0xca9,0xcc9,0xd03,0xd43,0xd43,0xd43,0xd43,0xd83,0xdba,0xdf1,0xe2f,0xe5e,0xe83,0xea6,0xec6,
+0xf06,0xf06,0xf06,0xf06,0xf06,0xf06,0xf06,0xf06,0xf06,0xf06,0xf46,0xf66,0xfa6,0xfe6,0x1026,0x1048,
+0x1088,0x10a8,0x10e8,0x1118,0x1158,0x1198,0x11d8,0x120e,0x124e,0x126f,0x12ae,0x12ed,0x132d,0x1361,0x13a1,0x13e1,
+0x1421,0x145c,0x149c,0x14dc,0x151c,0x1548,0x1581,0x15c1,0xf3,0xf3,0xf3,0xf3,0x1601,0x163b,0x167b,0x16ab,
+0x16eb,0x1706,0x1746,0x1786,0x17c6,0x17f9,0x1830,0,0,0,0,0,0,0,0,0,
+0x1849,0x1889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x18c9,0x18c9,0x18c9,0x18c9,0,0,0,0,0,0,0,0,0,0x1909,0x1927,0x195e,
+0x199e,0x19ce,0x1a0e,0x1a1a,0x1a5a,0x1a8a,0x1aca,0x1aea,0,0x1b2a,0x1b6a,0x1b85,0x1bc5,0x1bc5,0x1bc5,0x1bef,
+0x1c2f,0x1c6f,0x1c98,0x1cb9,0x1cf9,0xd43,0x1d2a,0x1d6a,0x1daa,0x1dca,0,0x1e09,0x1e49,0x1e71,0,0,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bcf,0,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bd5,
+0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,0x1eb1,
+0x1eb1,0x1eb1,0x1ee4,0x1f1d,0x1f5d,0x1f5d,0x1f5d,0x1f5d,0x1f71,0x226,0x1fb1,0x1fd1,0x2011,0xf3,0x2049,0x2083,
+0x20c3,0x2103,0x2143,0x217d,0x21bd,0x21ed,0x222d,0x225f,0x229f,0x22df,0x231f,0x235c,0x239b,0x23cb,0x23fb,0x243b,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,
+0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0xd43,0x247b,0x24b4,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x24f4,0x1bc5,0x2524,0x2564,0x25a4,0x3c2,0x25e2,
+0x3c2,0x3c2,0x3c2,0x3c2,0x25f5,0x25e5,0x2635,0x266d,0x26ad,0x26dd,0x3c2,0x2713,0x2751,0x2771,0x27a2,0x27e1,
+0xa56,0xa74,0xa91,0xab0,0xad0,0xad0,0xadd,0xafa,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,
+0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,
+0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,0xb18,
+0xb18,0xb18,0xb18,0xb18,0xb38,0x2821,0x282e,0x2826,0x2833,0x2842,0x2842,0x12ed,0x12ed,0x282e,0x282e,0x282e,
+0x282e,0x282e,0x282e,0x282e,0x2845,0x1839,0,0,0x2855,0x1d1,0x1d1,0x1d1,0x1d1,0x1d6,0x177a,0x2865,
+0x12ed,0x12ed,0,0,0x2875,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2885,0x2888,0x2898,
+0x2898,0x2898,0x28a7,0x16f8,0x177a,0x28b7,0x28b7,0x28c3,0x28d3,0x28d8,0x28e8,0x28e8,0x28ed,0x28fd,0x28ff,0x290f,
+0x290f,0x291b,0x2925,0x12ed,0x12ed,0x2935,0x2935,0x2935,0x2935,0x2935,0x2945,0x2945,0x2945,0x2955,0x2957,0x295b,
+0x296b,0x296b,0x2977,0x296b,0x296f,0x2987,0x2987,0x298f,0x299f,0x299f,0x299f,0x29ab,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,
+0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29bb,0x29c4,0x29bb,0x29c5,0x29c3,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x29d5,0x29df,0x29df,0x29e9,0x29f9,0x2a03,0x2a13,0x2a13,0x2a23,0x2a24,0x2a33,
+0x12ed,0x12ed,0x12ed,0x2a43,0x2a50,0x2a60,0x2a64,0x2a74,0x2a7a,0x12ed,0x12ed,0x12ed,0x12ed,0x2a8a,0x2a8a,0x2a9a,
+0x2aa2,0x2a9a,0x2aac,0x2a9a,0x2a9a,0x2abc,0x2ac8,0x2ad1,0x2adb,0x2aea,0x2aea,0x2afa,0x2afa,0x2b0a,0x2b0a,0x12ed,
+0x12ed,0x2b1a,0x2b1a,0x2b23,0x2b2e,0x2b3e,0x2b3e,0x2b3e,0x2b48,0x2b58,0x2b62,0x2b72,0x2b7f,0x2b8f,0x2b9d,0x2baa,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2bba,0x2bba,0x2bba,0x2bba,0x2bc1,0x12ed,0x12ed,0x12ed,0x2bd1,0x2bd1,0x2bd1,
+0x2bde,0x2bd1,0x2bd1,0x2bd1,0x2bee,0x2bfe,0x2bfe,0x2c06,0x2c04,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x3c2,0x5ab,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2c16,
+0x2c16,0x2c1e,0x2c2e,0x2c2e,0x2c34,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2c44,
+0x2c44,0x2c44,0x2c44,0x2c46,0x2c42,0x2c44,0x2c54,0x2c64,0x2c64,0x2c64,0x2c64,0x2c72,0x2c82,0x2c89,0x2c88,0x2c99,
+0x2c99,0x2c99,0x2ca4,0x2cad,0x2cbd,0x2cbd,0x2cc6,0x2cd6,0x2cd6,0x2cd6,0x2cd6,0x2cd8,0x2cd6,0xa56,0x2ce8,0x2cf8,
+0x2d06,0x2cf8,0x2cf9,0x12ed,0x12ed,0x12ed,0x12ed,0x2d16,0x2d25,0x2d34,0x2d44,0x2d44,0x2d44,0x2d49,0x2d4a,0x2d5a,
+0x2d66,0x2d6d,0x2d7c,0x2d88,0x2d95,0x2da2,0x2daa,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2dba,
+0x2dba,0x2dba,0x2dba,0x2dba,0x2dc0,0x12ed,0x12ed,0x2dd0,0x2dd0,0x2dd0,0x2dd0,0x2dd8,0x2dd6,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2de8,0x2de8,0x2de8,0x2df2,0x2de8,0x2dea,0x12ed,0x12ed,0x2e02,
+0x2e02,0x2e02,0x2e02,0x2e0d,0x2e08,0x10d4,0x12ed,0x2e1d,0x2e1d,0x2e1d,0x2e25,0x2e23,0x12ed,0x12ed,0x12ed,0x2e35,
+0x2e3a,0x2e47,0x2e35,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2e57,
+0x2e57,0x2e57,0x2e5b,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2e6b,0x2e6b,0x2e6b,0x2e6b,0x2e6b,0x2e78,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2e88,
+0x2e88,0x2e88,0x2e88,0x2e90,0x2ea0,0x2ea0,0x2ea0,0x2eac,0x2ea0,0x2eb9,0x12ed,0x2ec9,0x2ec9,0x2ec9,0x2ed0,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2ee0,
+0x2eea,0x2eea,0x2ee2,0x2ef4,0x2eea,0x2eed,0x2f04,0x2f04,0x2f02,0x2f0c,0x2f15,0x12ed,0x12ed,0x12ed,0x12ed,0x2f25,
+0x2f30,0x2f30,0x2f39,0x2f48,0x2f58,0x2f68,0x2f72,0x2f73,0x2f80,0x2f90,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2fa0,0x2fa7,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,
+0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,
+0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fbd,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb8,0x2fc2,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,
+0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fb7,0x2fc3,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,
+0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,0x2fd3,
+0x2fd3,0x2fd4,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x2fe4,
+0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,
+0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fe4,0x2fed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,
+0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,
+0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x1fd1,0x2000,0x2ffd,0x2ffe,0x3003,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x3013,0x3015,0x301d,0x302d,0x302d,0x302d,0x302d,0x3037,0x3047,0x304f,0x3057,
+0x302d,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x3067,0x3067,0x3067,0x3067,0x3067,0x306c,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x307c,0x307c,0x307c,0x307c,0x3087,0x307c,0x307c,0x307d,0x308c,0x307c,0x12ed,0x12ed,
+0x12ed,0x12ed,0x309c,0x12ed,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,
+0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,
+0x30ac,0x30ac,0x30ac,0x30ac,0x30ba,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,0x30ac,
+0x30ac,0x30ac,0x30ac,0x30ac,0x30b9,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x30ca,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,
+0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1c70,0x1ca0,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x30da,0x30da,0x30da,0x30da,
+0x30da,0x30da,0x30da,0x30da,0x30da,0x30da,0x30da,0x30da,0x30da,0x30da,0x30da,0x30de,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x30ee,0x30ee,0x30ee,0x30ee,
+0x30ee,0x30ee,0x30f3,0x30f1,0x30f5,0x3105,0x1782,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x1780,0,0,0x1936,0,
+0,0,0x3115,0x168,0x3125,0,0x3131,0,0,0,0x177d,0x12ed,0x1d1,0x1d1,0x1d1,0x1d1,
+0x3141,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0,0x1782,0,0,0,0,
+0,0x177f,0,0x177d,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0,0,0,0,
+0,0x1726,0,0,0,0x171e,0x314f,0x315d,0x1727,0,0,0,0x316a,0x3177,0,0x26fa,
+0x3185,0x1966,0,0,0,0,0,0,0,0,0,0,0x1937,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1931,0,
+0,0,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,
+0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,0x3195,
+0x3195,0x3195,0x3199,0x31a5,0x31af,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x19c6,0x31bf,0x31cd,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x31dd,0x31dd,0x31dd,0x31dd,0x31dd,0x31dd,
+0x31dd,0x31dd,0x31dd,0x31dd,0x31dd,0x31dd,0x31e8,0x31f1,0x12ed,0x12ed,0x3201,0x3201,0x3201,0x3201,0x3206,0x3216,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x1765,0,0,0,0x1781,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x270e,0x3c2,0x3226,0x3233,0x3241,0x3251,0x325f,0x3267,0x5b0,0x25d8,0x3276,0x25d8,0x12ed,
+0x12ed,0x12ed,0x5c1,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0,0,0x177a,0,0,0,0,0,0,0x1782,0x171c,0x1765,0x1765,
+0x1765,0,0x1780,0x1779,0,0,0,0,0,0x177a,0,0,0,0x1779,0x12ed,0x12ed,
+0x12ed,0x17c0,0,0x3286,0,0,0x177a,0x177d,0x1784,0x1780,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x1781,0x1779,0x177c,0,0,0,0,0,0,0,0x1782,0,0,
+0,0,0,0x177d,0x12ed,0x12ed,0x177a,0,0,0,0x177e,0x177c,0,0,0x177e,0,
+0x1778,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x177a,0,0,0x171c,0,0,0,0x3296,0,0,
+0x1783,0x177c,0x1783,0,0,0,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x1778,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bb2,0x12ed,0x12ed,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bb4,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bab,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1c03,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1bc5,
+0x1bc5,0x1bc5,0x1bc5,0x1bc5,0x1c04,0x12ed,0x1bc5,0x1bab,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x32a6,0x12ed,0,0,0,0,0,0,0x12ed,0x12ed,
+0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x173,0x173,0x173,0x173,0x173,0x173,0x173,0x173,0x173,0x173,
+0x173,0x173,0x173,0x173,0x173,0x12ed,0x435,0x455,0x475,0x495,0x4b5,0x4d5,0x4f5,0x50f,0x52f,0x54f,
+0x56f,0x58f,0x5af,0x5cf,0x5ef,0x60a,0x62a,0x631,0x651,0x360,0x360,0x360,0x360,0x360,0x671,0x671,
+0x68f,0x360,0x360,0x360,0x360,0x360,0x6af,0x6cb,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x6eb,0x708,0x360,0x724,0x744,0x744,0x744,0x744,
+0x744,0x744,0x744,0x744,0x745,0x744,0x765,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x785,0x79c,0x360,0x360,0x360,0x360,0x7bc,
+0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x7dc,0x7fc,0x81c,0x832,0x852,0x86a,0x360,0x360,
+0x88a,0x360,0x360,0x360,0x8aa,0x360,0x8c3,0x8e3,0x903,0x923,0x933,0x946,0x966,0x986,0x360,0x360,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0x9a6,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x9b6,0x9d5,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,
+0xd0,0x9eb,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0xd0,0x9f6,
+0x360,0x360,0x360,0x360,0x360,0x360,0xd0,0xa16,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,
+0x360,0x360,0x360,0x360,0x360,0x360,0x360,0x360,0xa36
+};
+
+constexpr uint8_t script_data[12982]={
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,0,0,
+0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x19,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x19,0,0,0,0,0,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x19,0x19,0x19,0x19,0x19,0,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0xe,0xe,0xe,0xe,0,0xe,0xe,0xe,0x67,0x67,0xe,0xe,0xe,
+0xe,0,0xe,0x67,0x67,0x67,0x67,0xe,0,0xe,0,0xe,0xe,0xe,0x67,0xe,
+0x67,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0x67,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,7,7,7,7,7,7,7,7,
+7,7,7,7,7,7,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,1,1,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,0x67,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,0x67,0x67,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,0,3,0x67,0x67,3,3,3,0x67,0x13,0x13,0x13,0x13,0x13,0x13,
+0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
+0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
+0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
+0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x67,0x67,0x67,0x67,
+0x13,0x13,0x13,0x13,0x13,0x13,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,2,2,2,2,2,0,2,2,2,2,2,2,0,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,2,0x67,2,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,0,2,2,2,2,2,2,2,2,2,2,1,1,1,1,
+1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,0,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+0x22,0x22,0x22,0x67,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x67,0x67,0x22,0x22,0x22,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0x25,0x25,0x25,0x25,0x25,0x25,
+0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x57,0x57,0x57,0x57,0x57,0x57,
+0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+0x57,0x57,0x57,0x57,0x57,0x67,0x67,0x57,0x57,0x57,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,
+0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,
+0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,
+0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x67,0x67,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,
+0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x67,0x54,0x54,0x54,0x54,0x54,0x54,
+0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,
+0x54,0x54,0x54,0x54,0x54,0x54,0x67,0x67,0x54,0x67,0x22,0x22,0x22,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0x67,2,2,2,2,2,
+2,2,2,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,1,1,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0,0,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,4,4,4,4,0x67,4,4,4,4,4,4,4,4,0x67,
+0x67,4,4,0x67,0x67,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,0x67,4,4,4,4,
+4,4,4,0x67,4,0x67,0x67,0x67,4,4,4,4,0x67,0x67,4,4,
+4,4,4,0x67,0x67,4,4,0x67,0x67,4,4,4,4,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,4,0x67,0x67,0x67,0x67,4,4,0x67,4,4,4,
+4,4,0x67,0x67,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,0x67,0x10,0x10,
+0x10,0x67,0x10,0x10,0x10,0x10,0x10,0x10,0x67,0x67,0x67,0x67,0x10,0x10,0x67,0x67,
+0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,0x67,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x67,0x10,
+0x10,0x67,0x10,0x10,0x67,0x10,0x10,0x67,0x67,0x10,0x67,0x10,0x10,0x10,0x67,0x67,
+0x67,0x67,0x10,0x10,0x67,0x67,0x10,0x10,0x10,0x67,0x67,0x67,0x10,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x10,0x10,0x10,0x10,0x67,0x10,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xf,0xf,0xf,0x67,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0x67,0xf,0xf,0xf,0x67,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+0xf,0xf,0xf,0x67,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0x67,0xf,0xf,0x67,0xf,
+0xf,0xf,0xf,0xf,0x67,0x67,0xf,0xf,0xf,0xf,0xf,0xf,0x67,0xf,0xf,0xf,
+0x67,0xf,0xf,0xf,0x67,0x67,0xf,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0xf,0xf,0xf,0xf,0x67,0x67,0xf,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0x67,0x1f,0x1f,0x1f,0x67,0x1f,0x1f,0x1f,0x1f,0x1f,
+0x1f,0x1f,0x1f,0x67,0x67,0x1f,0x1f,0x67,0x67,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,
+0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x67,
+0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x67,0x1f,0x1f,0x67,0x1f,0x1f,0x1f,0x1f,0x1f,
+0x67,0x67,0x1f,0x1f,0x1f,0x1f,0x1f,0x67,0x67,0x1f,0x1f,0x67,0x67,0x1f,0x1f,0x1f,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x1f,0x1f,0x67,0x67,0x67,0x67,0x1f,0x1f,
+0x67,0x1f,0x1f,0x1f,0x1f,0x1f,0x67,0x67,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,
+0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x23,0x23,0x67,0x23,0x23,0x23,0x23,0x23,0x23,0x67,0x67,0x67,0x23,0x23,
+0x23,0x67,0x23,0x23,0x23,0x23,0x67,0x67,0x67,0x23,0x23,0x67,0x23,0x67,0x23,0x23,
+0x67,0x67,0x67,0x23,0x23,0x67,0x67,0x67,0x23,0x23,0x23,0x67,0x67,0x67,0x23,0x23,
+0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x67,0x67,0x67,0x67,0x23,0x23,
+0x23,0x67,0x67,0x67,0x23,0x23,0x23,0x67,0x23,0x23,0x23,0x23,0x67,0x67,0x23,0x67,
+0x67,0x67,0x67,0x67,0x67,0x23,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,
+0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x67,0x67,0x67,0x67,0x67,0x24,0x24,
+0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x67,0x24,0x24,0x24,0x67,
+0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
+0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x67,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
+0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x67,0x67,0x67,0x24,0x24,0x24,0x24,0x24,
+0x67,0x24,0x24,0x24,0x67,0x24,0x24,0x24,0x24,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x24,0x24,0x67,0x24,0x24,0x24,0x67,0x67,0x67,0x67,0x67,0x24,0x24,0x24,0x24,0x67,
+0x67,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x15,0x15,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x67,0x15,0x15,0x15,0x67,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x67,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x67,
+0x15,0x15,0x15,0x15,0x15,0x67,0x67,0x15,0x15,0x15,0x15,0x15,0x67,0x15,0x15,0x15,
+0x67,0x15,0x15,0x15,0x15,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x15,0x15,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x15,0x67,0x15,0x15,0x15,0x15,0x67,0x67,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x67,0x15,0x15,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x1a,0x1a,0x1a,0x1a,0x67,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x67,0x1a,0x1a,0x1a,0x67,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x67,0x1a,0x1a,0x1a,0x67,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x67,0x67,0x67,0x67,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x67,0x67,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x67,0x67,0x21,0x21,0x67,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
+0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x67,0x67,0x67,0x21,0x21,0x21,0x21,
+0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
+0x21,0x21,0x21,0x21,0x67,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x67,0x21,
+0x67,0x67,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x67,0x67,0x67,0x21,0x67,0x67,0x67,
+0x67,0x21,0x21,0x21,0x21,0x21,0x21,0x67,0x21,0x67,0x21,0x21,0x21,0x21,0x21,0x21,
+0x21,0x21,0x67,0x67,0x67,0x67,0x67,0x67,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
+0x21,0x21,0x67,0x67,0x21,0x21,0x21,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,
+0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,
+0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,
+0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x67,0x67,0x67,0x67,
+0,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,
+0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x18,0x18,0x67,0x18,0x67,0x67,0x18,0x18,0x67,0x18,0x67,0x67,0x18,0x67,0x67,
+0x67,0x67,0x67,0x67,0x18,0x18,0x18,0x18,0x67,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x67,0x18,0x18,0x18,0x67,0x18,0x67,0x18,0x67,0x67,0x18,0x18,0x67,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x67,0x18,0x18,0x18,0x67,0x67,
+0x18,0x18,0x18,0x18,0x18,0x67,0x18,0x67,0x18,0x18,0x18,0x18,0x18,0x18,0x67,0x67,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x67,0x67,0x18,0x18,0x18,0x18,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x67,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x67,0x67,0x67,0x67,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x67,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x67,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0,0,
+0,0,0x27,0x27,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x67,0xc,0x67,0x67,0x67,0x67,0x67,
+0xc,0x67,0x67,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0,0xc,
+0xc,0xc,0xc,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0x67,0xb,0xb,0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0x67,0xb,0x67,0xb,0xb,0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x67,0xb,0xb,0xb,0xb,0x67,
+0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0x67,0xb,0xb,0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0x67,0xb,0xb,0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x67,
+0xb,0xb,0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x67,0x67,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0x67,0x67,0x67,0x67,0x67,0x67,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,0x67,0x67,6,6,
+6,6,6,6,0x67,0x67,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,
+0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,
+0x1d,0x1d,0x1d,0x67,0x67,0x67,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0,0,0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x67,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,
+0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0,0,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,
+0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x67,0x2d,0x2d,0x2d,0x67,0x2d,0x2d,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x67,0x67,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x67,0x67,0x67,0x67,0x67,0x67,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x67,0x67,0x67,0x67,0x67,0x67,0x1b,0x1b,0,0,0x1b,0,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x67,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x67,0x67,0x67,0x67,0x67,0x67,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x67,0x67,0x67,0x67,0x67,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x67,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x67,0x67,0x67,0x67,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x67,0x67,0x67,0x67,0x30,0x67,0x67,0x67,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+0x34,0x34,0x34,0x34,0x34,0x34,0x67,0x67,0x34,0x34,0x34,0x34,0x34,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x67,0x67,0x67,0x67,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x67,0x67,0x67,0x67,0x67,0x67,0x3b,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x67,0x67,0x67,0x3b,0x3b,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x67,0x67,0x37,0x37,0x6a,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x67,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x67,0x67,0x6a,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x67,0x67,0x67,0x67,0x67,0x67,0x6a,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x67,0x67,0x67,0x67,0x67,0x67,0x6a,0x6a,
+0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x67,0x67,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x67,0x67,0x67,
+0x67,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x67,0x67,
+0x67,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,
+0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,
+0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,
+0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,
+0x71,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,
+0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,
+0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,
+0x3f,0x3f,0x3f,0x3f,0x3f,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x3f,0x3f,0x3f,
+0x3f,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,
+0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,
+0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,
+0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x67,0x67,0x67,0x52,0x52,0x52,0x52,
+0x52,0x52,0x52,0x52,0x52,0x52,0x67,0x67,0x67,0x52,0x52,0x52,0x6d,0x6d,0x6d,0x6d,
+0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,
+0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,
+0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,8,8,8,8,
+8,8,8,8,8,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x67,0x67,0xc,0xc,0xc,0x71,0x71,0x71,0x71,
+0x71,0x71,0x71,0x71,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,1,1,1,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,
+1,0,0,0,1,1,0x67,0x67,0x67,0x67,0x67,0x67,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0xe,0xe,0xe,0xe,0xe,8,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0xe,0xe,0xe,0xe,0xe,0x19,0x19,0x19,0x19,0xe,0xe,
+0xe,0xe,0xe,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+8,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0xe,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0x67,1,1,1,1,
+1,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0x67,0xe,0xe,0xe,0xe,0xe,0xe,0x67,
+0x67,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0x67,0x67,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0x67,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0x67,0xe,0x67,0xe,0x67,0xe,0x67,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0x67,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0x67,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0x67,
+0x67,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0x67,0xe,0xe,0xe,
+0x67,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x67,0,0,0,0,
+0,0,0,0,0,0,0,0x19,0x67,0x67,0,0,0,0,0,0,
+0,0,0,0,0,0x19,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x67,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x67,0x67,0x67,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xe,0,0,0,
+0x19,0x19,0,0,0,0,0,0,0x19,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x19,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,0x67,0x67,0x67,0x67,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0,0,0,0,0,0,0,
+0,0,0,0,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,
+0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,
+0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,
+0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,
+0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x67,0x67,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x67,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x67,0x38,0x38,
+0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,
+0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,
+0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x67,0x38,0x38,
+0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,
+0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x67,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,0x67,0x67,
+0x67,0x67,0x67,7,7,7,7,7,7,7,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
+0x67,0xc,0x67,0x67,0x67,0x67,0x67,0xc,0x67,0x67,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,
+0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,
+0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,
+0x3c,0x3c,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x3c,0x3c,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x3c,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x67,0xb,0xb,0xb,0xb,0xb,0xb,
+0xb,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x67,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x67,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0,
+0,0,0,0,0,0,0,0,0,0,0,0x67,0x67,0x67,0x67,0,
+0,0,0,0,0x11,0,0x11,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,1,1,1,1,0x12,0x12,0,
+0,0,0,0,0,0,0,0x11,0x11,0x11,0x11,0,0,0,0,0x67,
+0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x67,
+0x67,1,1,0,0,0x14,0x14,0x14,0,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0,0,0x16,0x16,0x16,0x67,0x67,0x67,0x67,0x67,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x67,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x67,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0x67,0x67,0x67,0x67,0x67,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x67,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x67,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x67,0x67,0x67,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,
+0x29,0x29,0x29,0x29,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x83,0x83,0x83,
+0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,
+0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,
+0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x63,0x63,0x63,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,
+0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,
+0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,
+0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0,0,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x67,
+0x67,0x67,0x67,0,0,0,0,0,0,0,0,0,0,0x67,0x67,0x67,
+0x67,0x67,0x67,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x6f,0x6f,0x6f,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x67,0x67,0x67,0x67,0x67,0x67,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0x4f,0x4f,0x4f,
+0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,
+0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,
+0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0,0x4f,0x6e,0x6e,0x6e,
+0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,
+0x6e,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x6e,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x67,0x67,0x67,0x4e,0x4e,0x4e,
+0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,
+0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,
+0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,
+0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x67,0,0x4e,
+0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x67,0x67,0x67,0x67,0x4e,0x4e,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x67,0x42,
+0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+0x42,0x42,0x42,0x42,0x42,0x42,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x42,
+0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x67,0x67,0x42,
+0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x67,0x67,0x42,0x42,0x42,0x42,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x7f,
+0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,
+0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,
+0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,
+0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x7f,0x7f,0x7f,0x7f,0x7f,0x73,0x73,0x73,0x73,
+0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,
+0x73,0x73,0x73,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xb,0xb,0xb,0xb,
+0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0x67,0x67,0xb,0xb,0xb,0xb,
+0xb,0xb,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xb,0xb,0xb,0xb,0xb,
+0xb,0xb,0x67,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x67,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0xe,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,0x73,0x73,0x73,0x73,0x73,
+0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,
+0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,
+0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x67,0x67,0x73,0x73,0x73,0x73,0x73,
+0x73,0x73,0x73,0x73,0x73,0x67,0x67,0x67,0x67,0x67,0x67,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x67,0x67,0x67,0x67,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x67,0x67,0x67,0x67,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x67,0x67,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,3,3,3,3,3,0x67,0x67,0x67,0x67,
+0x67,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
+0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x67,0x13,0x13,0x13,0x13,
+0x13,0x67,0x13,0x67,0x13,0x13,0x67,0x13,0x13,0x67,0x13,0x13,0x13,0x13,0x13,0x13,
+0x13,0x13,0x13,0x13,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,0,0,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0x67,0x67,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0x67,0x67,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,
+0,0,0,0,0,0,0,0x67,0x67,0x67,0x67,0x67,0x67,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,8,8,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x67,0,0,0,0,0x67,0x67,0x67,0x67,2,2,2,
+2,2,0x67,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0x67,0x67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,0,
+0,0,0,0,0,0,0,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0,0,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x67,0x67,0x12,0x12,0x12,0x12,0x12,0x12,0x67,0x67,0x12,0x12,0x12,0x12,0x12,
+0x12,0x67,0x67,0x12,0x12,0x12,0x12,0x12,0x12,0x67,0x67,0x12,0x12,0x12,0x67,0x67,
+0x67,0,0,0,0,0,0,0,0x67,0,0,0,0,0,0,0,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0,0,0,0,0,0x67,
+0x67,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x67,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x67,0x31,
+0x31,0x67,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,
+0x67,0x67,0x67,0x67,0x67,0,0,0,0,0x67,0x67,0x67,0,0,0,0,
+0,0,0,0,0,0xe,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0x67,0x67,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6b,0x6b,0x6b,0x6b,0x67,0x67,0x67,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,
+0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x1e,0x1e,0x1e,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,
+0xd,0xd,0xd,0x67,0x67,0x67,0x67,0x67,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,
+0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x67,0x67,0x67,0x67,0x67,0x35,0x35,0x35,
+0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x67,0x35,0x3d,
+0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x67,
+0x67,0x67,0x67,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,9,9,9,9,9,9,9,9,9,9,9,
+9,9,9,9,9,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,
+0x32,0x32,0x32,0x32,0x32,0x67,0x67,0x67,0x67,0x67,0x67,0xab,0xab,0xab,0xab,0xab,
+0xab,0xab,0xab,0xab,0xab,0xab,0xab,0xab,0xab,0xab,0xab,0x67,0x67,0x67,0x67,0xab,
+0xab,0xab,0xab,0xab,0xab,0xab,0xab,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x9f,
+0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x9f,0x53,0x53,0x53,0x53,0x53,
+0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x67,0x67,0x2f,0x67,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x67,
+0x2f,0x2f,0x67,0x67,0x67,0x2f,0x67,0x67,0x2f,0x74,0x74,0x74,0x74,0x74,0x74,0x74,
+0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x67,0x74,0x74,0x74,0x74,0x74,0x74,
+0x74,0x74,0x74,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
+0x90,0x90,0x90,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,
+0x8f,0x8f,0x8f,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,
+0x8f,0x8f,0x8f,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,
+0xa2,0xa2,0xa2,0x67,0xa2,0xa2,0x67,0x67,0x67,0x67,0x67,0xa2,0xa2,0xa2,0xa2,0xa2,
+0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,
+0x67,0x67,0x67,0x5b,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,
+0x6c,0x6c,0x6c,0x6c,0x67,0x67,0x67,0x67,0x67,0x6c,0x56,0x56,0x56,0x56,0x56,0x56,
+0x56,0x56,0x56,0x56,0x56,0x56,0x56,0x56,0x56,0x56,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,
+0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x67,0x67,0x67,0x67,0x8d,0x8d,
+0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x39,0x39,0x39,0x39,
+0x67,0x39,0x39,0x67,0x67,0x67,0x67,0x67,0x39,0x39,0x39,0x39,0x67,0x39,0x39,0x39,
+0x67,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+0x39,0x67,0x67,0x39,0x39,0x39,0x67,0x67,0x67,0x67,0x39,0x39,0x39,0x39,0x39,0x39,
+0x39,0x39,0x39,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x85,0x85,0x85,0x85,0x85,0x85,
+0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,
+0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x79,0x79,0x79,0x79,0x79,0x79,
+0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x67,0x67,0x67,0x67,0x79,0x79,
+0x79,0x79,0x79,0x79,0x79,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x75,0x75,
+0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x67,0x67,
+0x67,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,
+0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x67,0x67,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,
+0x7d,0x7d,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+0x7a,0x7a,0x67,0x67,0x67,0x67,0x67,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7b,
+0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x7b,0x7b,0x7b,0x7b,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x58,0x58,0x58,0x58,0x58,0x58,
+0x58,0x58,0x58,0x58,0x58,0x58,0x58,0x58,0x58,0x58,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,
+0x4c,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x4c,0x4c,
+0x4c,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x4c,0x4c,0x4c,0x4c,0x4c,0x4c,0xb6,0xb6,
+0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,
+0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xb7,0xb7,
+0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0x67,0x67,
+0x67,0x67,0x67,0x67,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,
+0x41,0x41,0x41,0x41,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x41,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,
+0x78,0x78,0x78,0x78,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x78,
+0x67,0x67,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,0x98,
+0x98,0x98,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x67,0x76,0x76,0x76,0x76,0x76,0x76,
+0x76,0x76,0x76,0x76,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xa0,0xa0,0xa0,
+0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x97,0x97,0x97,0x97,0x97,0x97,0x97,0x97,0x97,0x97,
+0x97,0x97,0x97,0x97,0x97,0x97,0x67,0x67,0x21,0x21,0x21,0x21,0x21,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,
+0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0x67,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,
+0x9d,0x9d,0x9d,0x9d,0x9d,0x9d,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0x67,0xa4,0x67,
+0xa4,0xa4,0xa4,0xa4,0x67,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,
+0xa4,0xa4,0xa4,0x67,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0x67,0x67,
+0x67,0x67,0x67,0x67,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,
+0x91,0x91,0x91,0x91,0x67,0x67,0x67,0x67,0x67,0x67,0x89,0x89,0x89,0x89,0x67,0x89,
+0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x67,0x67,0x89,0x89,0x89,0x89,0x89,0x89,0x89,
+0x89,0x89,0x89,0x89,0x89,0x89,0x67,0x89,0x89,0x89,0x89,0x89,0x89,0x67,0x89,0x89,
+0x67,0x89,0x89,0x89,0x89,0x89,0x67,1,0x89,0x89,0x89,0x89,0x89,0x67,0x67,0x89,
+0x89,0x67,0x67,0x89,0x89,0x89,0x67,0x67,0x67,0x67,0x67,0x67,0x89,0x67,0x67,0x67,
+0x67,0x67,0x89,0x89,0x89,0x89,0x67,0x67,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x67,0xaa,0x67,0xaa,0xaa,0x67,
+0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,
+0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,0x67,0x67,0xa6,0xa6,0xa6,0xa6,0xa6,0xa6,
+0xa6,0xa6,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+0xa3,0xa3,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x99,0x99,0x99,
+0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,
+0xa1,0xa1,0xa1,0xa1,0xa1,0x67,0x67,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,
+0xa1,0xa1,0xa1,0x67,0x67,0x67,0x67,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,
+0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0x67,0x67,0x67,0x67,0x92,0x92,0x92,0x92,0x92,
+0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x92,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,
+0x67,0x67,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,
+0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0x67,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
+0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,
+0xa9,0xa9,0xa9,0xa9,0x67,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0x67,0xaf,0xaf,0x67,
+0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,
+0x67,0x67,0x67,0xaf,0x67,0xaf,0xaf,0x67,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,
+0xaf,0xaf,0x67,0x67,0x67,0x67,0x67,0x67,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0x67,0xb3,
+0xb3,0x67,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,
+0xb3,0xb3,0x67,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0x67,0x67,0x67,0x67,0x67,0x67,
+0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,
+0x47,0x47,0x47,0x67,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,
+0x9c,0x9c,0x9c,0x9c,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x95,0x95,0x95,
+0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x67,0x67,0x67,
+0x67,0x95,0x95,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,
+0x86,0x86,0x86,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x4b,0x4b,0x4b,
+0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,
+0x4b,0x67,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x67,
+0x67,0x67,0x67,0x67,0x4b,0x4b,0x4b,0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,
+0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,0x67,0x67,0x67,0x67,0x67,0x5c,0x5c,0x5c,0x5c,
+0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x5c,0x9a,0x96,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x9a,0x9a,0x9a,0x9a,
+0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x16,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x96,0x96,0x96,0x96,0x96,0x96,
+0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x67,0x67,0x67,0x67,0x87,0x87,
+0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x67,
+0x67,0x87,0x87,0x87,0x87,0,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,1,1,1,0,0,1,1,1,1,1,1,
+1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,
+0,0xe,0xe,0xe,0xe,0xe,0xe,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0,0x67,0x67,0,0,0x67,0x67,0,0,0,0,0x67,0,0,0,
+0,0,0,0,0,0,0,0x67,0,0x67,0,0,0,0,0,0,
+0x67,0,0,0,0,0x67,0x67,0,0,0,0,0,0x67,0,0,0,
+0,0,0,0,0x67,0,0,0,0,0,0x67,0,0x67,0x67,0x67,0,
+0,0,0,0,0,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
+0x70,0x70,0x70,0x70,0x70,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x38,
+0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x67,0x67,0x38,0x38,0x38,0x38,0x38,0x67,
+0x38,0x38,0x67,0x38,0x38,0x38,0x38,0x38,0x67,0x67,0x67,0x67,0x67,0x8c,0x8c,0x8c,
+0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x67,0x67,0x8c,
+0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x8c,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,
+0xa7,0x67,0x67,0x67,0x67,0x67,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,0xa7,
+0x67,0x67,0x67,0x67,0xa7,0xa7,0x67,2,2,0x67,2,0x67,0x67,2,0x67,2,
+2,2,2,2,2,2,0x67,2,2,2,2,0x67,2,0x67,2,0x67,
+0x67,0x67,0x67,2,0x67,0x67,0x67,0x67,2,0x67,2,0x67,2,0x67,2,2,
+2,0x67,2,2,0x67,2,0x67,0x67,2,0x67,2,0x67,2,0x67,2,0x67,
+2,2,0x67,2,0x67,0x67,2,2,2,2,0x67,2,2,2,2,0x67,
+2,2,2,2,0x67,2,0x67,2,2,2,0x67,2,2,2,2,2,
+0x67,2,2,2,2,2,0x14,0,0,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67,0,0x67,0x67,0,0,0,0,0x67,0x67,0x67,
+0,0x67,0,0,0,0,0x67,0,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+0x67,0x67,0x67,0x67,0x67,0x67
+};
+
+constexpr uint16_t simpleCaseFolding_index[1198]={
+0,0x40,0x5b,0x9b,0xdb,0x113,0x153,0x190,0x1c8,0x207,0,0,0,0x242,0x282,0x2c0,
+0x300,0xbb,0x340,0x380,0x390,0x3c1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x3e1,0x41b,0,0,0,0,0,0,0,0,0,0,0,0x429,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x469,0,0,0,0,0,0x4a9,0x4a9,0x4d3,0x4a9,0x512,0x552,0x58a,0x5c9,
+0,0,0,0,0x606,0x639,0x676,0,0,0,0,0,0,0,0,0,
+0,0,0x680,0x6b6,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x6f6,0x725,0x4a9,0x765,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x7a5,0x7b7,0,0x7d5,0x807,0x845,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x87e,0x8ae,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x20,0,0,0,
+0x468,0x475,0x48d,0x499,0x8ee,0x8ee,0x8f6,0,0,0,0,0,0,0,0,0x8ee,
+0x8ee,0x8fa,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x90a,0x90a,0x90a,0x917,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x41,0x41,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x927,0x927,0x935,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x16,0x16,0x404,0x16,0x16,0x16,0x41c,0x16,
+0x16,0x16,0x16,0x16,0x432,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x438,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x448
+};
+
+constexpr uint32_t simpleCaseFolding_data[2373]={
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x307,0,0,0,0,0,0,0,0,0,0,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,0,0,1,0,1,
+0,1,0,0,1,0,1,0,1,0,1,0,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,0xffffff87,1,0,1,0,
+1,0,0xfffffef4,0,0xd2,1,0,1,0,0xce,1,0,0xcd,0xcd,1,0,
+0,0x4f,0xca,0xcb,1,0,0xcd,0xcf,0,0xd3,0xd1,1,0,0,0,0xd3,
+0xd5,0,0xd6,1,0,1,0,1,0,0xda,1,0,0xda,0,0,1,
+0,0xda,1,0,0xd9,0xd9,1,0,1,0,0xdb,1,0,0,0,1,
+0,0,0,0,2,1,0,2,1,0,2,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,2,1,0,1,0,0xffffff9f,0xffffffc8,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,0xffffff7e,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,
+0,0,0x2a2b,1,0,0xffffff5d,0x2a28,0,1,0,0xffffff3d,0x45,0x47,1,0,1,
+0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x74,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,
+0,0x74,0,0,0,0,0,0,0x26,0,0x25,0x25,0x25,0,0x40,0,
+0x3f,0x3f,0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,8,
+0xffffffe2,0xffffffe7,0,0,0,0xfffffff1,0xffffffea,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0xffffffca,0xffffffd0,0,0,0xffffffc4,0xffffffc0,0,1,0,0xfffffff9,1,0,0,0xffffff7e,0xffffff7e,0xffffff7e,
+0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0xf,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,
+0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,0x1c60,
+0x1c60,0,0x1c60,0,0,0,0,0,0x1c60,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0,0,0xffffe7b2,0xffffe7b3,0xffffe7bc,0xffffe7be,0xffffe7be,0xffffe7bd,0xffffe7c4,
+0xffffe7dc,0x89c3,0,0,0,0,0,0,0,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,
+0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,
+0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,0xfffff440,
+0xfffff440,0xfffff440,0xfffff440,0xfffff440,0,0,0xfffff440,0xfffff440,0xfffff440,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,0,0,0,0,0,0xffffffc6,0,
+0,0xffffe241,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,0,0,0,0,0,0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,
+0xfffffff8,0xfffffff8,0,0,0,0,0,0,0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,
+0,0,0,0,0,0,0,0,0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,
+0xfffffff8,0xfffffff8,0,0,0,0,0,0,0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,
+0xfffffff8,0xfffffff8,0,0,0,0,0,0,0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,
+0,0,0,0,0,0,0,0,0,0,0,0xfffffff8,0,0xfffffff8,0,0xfffffff8,
+0,0xfffffff8,0,0,0,0,0,0,0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,
+0xfffffff8,0xfffffff8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0,0,0,0,0,0,
+0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0,0,0,0,0,0,
+0,0,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0xfffffff8,0,0,0,0,0,0,
+0,0,0xfffffff8,0xfffffff8,0xffffffb6,0xffffffb6,0xfffffff7,0,0xffffe3fb,0,0,0,0,0,0,0,
+0,0xffffffaa,0xffffffaa,0xffffffaa,0xffffffaa,0xfffffff7,0,0,0,0,0,0,0,0,0,0,
+0,0xfffffff8,0xfffffff8,0xffffff9c,0xffffff9c,0,0,0,0,0,0,0,0,0,0,0,
+0,0xfffffff8,0xfffffff8,0xffffff90,0xffffff90,0xfffffff9,0,0,0,0,0,0,0,0,0,0,
+0,0xffffff80,0xffffff80,0xffffff82,0xffffff82,0xfffffff7,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xffffe2a3,0,0,0,
+0xffffdf41,0xffffdfba,0,0,0,0,0,0,0x1c,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0xffffd609,0xfffff11a,0xffffd619,0,0,1,0,1,0,
+1,0,0xffffd5e4,0xffffd603,0xffffd5e1,0xffffd5e2,0,1,0,0,1,0,0,0,0,0,
+0,0,0,0xffffd5c1,0xffffd5c1,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,
+1,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,0,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,
+1,0,1,0,0xffff75fc,1,0,1,0,1,0,1,0,0,0,0,
+1,0,0xffff5ad8,0,0,1,0,1,0,0,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0xffff5abc,
+0xffff5ab1,0xffff5ab5,0xffff5abf,0xffff5abc,0,0xffff5aee,0xffff5ad6,0xffff5aeb,0x3a0,1,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xffff6830,0xffff6830,
+0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,
+0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,
+0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,
+0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0xffff6830,0x28,0x28,
+0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0,0,
+0,0,0,0,0,0,0,0,0,0,0x40,0x40,0x40,0x40,0x40,0x40,
+0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0
+};
+
+}  // namespace detail
+
+/** @return the General_Category (gc) property value of code point c, as in u_getIntPropertyValue(). */
+constexpr int32_t generalCategory(int32_t c) {
+    return detail::generalCategory_data[detail::cpIndex(detail::generalCategory_index, 14254, 0x110000, c)];
+}
+
+/** @return true if code point c has the binary property White_Space (WSpace). */
+constexpr bool isWhiteSpace(int32_t c) {
+    return detail::whiteSpace_data[detail::cpIndex(detail::whiteSpace_index, 300, 0x3200, c)] != 0;
+}
+
+/** @return true if code point c has the binary property Alphabetic (Alpha). */
+constexpr bool isAlphabetic(int32_t c) {
+    return detail::alphabetic_data[detail::cpIndex(detail::alphabetic_index, 7882, 0x2fc00, c)] != 0;
+}
+
+/** @return the Script (sc) property value of code point c, as in u_getIntPropertyValue(). */
+constexpr int32_t script(int32_t c) {
+    return detail::script_data[detail::cpIndex(detail::script_index, 12982, 0xe0200, c)];
+}
+
+/** @return the Simple_Case_Folding (scf) of code point c. */
+constexpr int32_t simpleCaseFolding(int32_t c) {
+    return c + int32_t(detail::simpleCaseFolding_data[detail::cpIndex(detail::simpleCaseFolding_index, 2373, 0x1ea00, c)]);
+}
+
+}  // namespace genprophdrtest
+
+#endif  // GENPROPHDRTEST_H
@@ -43,6 +43,7 @@ NormalizerConformanceTest::NormalizerConformanceTest() :
     nfd = Normalizer2::getNFDInstance(errorCode);
     nfkc = Normalizer2::getNFKCInstance(errorCode);
     nfkd = Normalizer2::getNFKDInstance(errorCode);
+    fcdNorm2 = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
     assertSuccess("", errorCode, true, __FILE__, __LINE__);
 }
 
@@ -340,6 +341,24 @@ UBool NormalizerConformanceTest::checkConformance(const UnicodeString* field,
         errln("Normalizer error: quickCheck(NFKD(s), UNORM_NFKD) is UNORM_NO");
         pass = FALSE;
     }
+    if(options==0) {
+        if(!isNormalizedUTF8(*nfd, field[2], status)) {
+            dataerrln("Normalizer error: nfd.isNormalizedUTF8(NFD(s)) is FALSE");
+            pass = FALSE;
+        }
+        if(!isNormalizedUTF8(*nfkd, field[4], status)) {
+            dataerrln("Normalizer error: nfkd.isNormalizedUTF8(NFKD(s)) is FALSE");
+            pass = FALSE;
+        }
+        if(field[0]!=field[2] && isNormalizedUTF8(*nfd, field[0], status)) {
+            errln("Normalizer error: nfd.isNormalizedUTF8(s) is TRUE");
+            pass = FALSE;
+        }
+        if(field[0]!=field[4] && isNormalizedUTF8(*nfkd, field[0], status)) {
+            errln("Normalizer error: nfkd.isNormalizedUTF8(s) is TRUE");
+            pass = FALSE;
+        }
+    }
 
     // branch on options==0 for better code coverage
     if(options==0) {
@@ -405,6 +424,19 @@ UBool NormalizerConformanceTest::checkConformance(const UnicodeString* field,
         dataerrln("Normalizer error: NFD(FCD(s))!=NFD(s)");
         pass = FALSE;
     }
+    if(options==0) {
+        std::string s8, fcd8, out8;
+        StringByteSink<std::string> sink(&out8);
+        fcdNorm2->normalizeUTF8(0, field[0].toUTF8String(s8), sink, nullptr, status);
+        if(out8 != fcd.toUTF8String(fcd8)) {
+            errln("Normalizer error: fcd.normalizeUTF8(s)!=FCD(s)");
+            pass = FALSE;
+        }
+        if(!fcdNorm2->isNormalizedUTF8(out8, status)) {
+            errln("Normalizer error: fcd.isNormalizedUTF8(FCD(s)) is FALSE");
+            pass = FALSE;
+        }
+    }
 
     if (U_FAILURE(status)) {
         dataerrln("Normalizer::normalize returned error status: %s", u_errorName(status));
@@ -481,9 +513,8 @@ UBool NormalizerConformanceTest::checkNorm(UNormalizationMode mode, int32_t opti
     exp.toUTF8String(exp8);
     std::string out8;
     Edits edits;
-    Edits *editsPtr = (mode == UNORM_NFC || mode == UNORM_NFKC) ? &edits : nullptr;
     StringByteSink<std::string> sink(&out8, exp8.length());
-    norm2->normalizeUTF8(0, s8, sink, editsPtr, errorCode);
+    norm2->normalizeUTF8(0, s8, sink, &edits, errorCode);
     if (U_FAILURE(errorCode)) {
         errln("Normalizer2.%s.normalizeUTF8(%s) failed: %s",
               modeString, s8.c_str(), u_errorName(errorCode));
@@ -494,9 +525,6 @@ UBool NormalizerConformanceTest::checkNorm(UNormalizationMode mode, int32_t opti
               modeString, s8.c_str(), out8.c_str(), exp8.c_str());
         return FALSE;
     }
-    if (editsPtr == nullptr) {
-        return TRUE;
-    }
 
     // Do the Edits cover the entire input & output?
     UBool pass = TRUE;
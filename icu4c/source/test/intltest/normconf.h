@@ -22,7 +22,7 @@ typedef struct _FileStream FileStream;
 
 class NormalizerConformanceTest : public IntlTest {
     Normalizer normalizer;
-    const Normalizer2 *nfc, *nfd, *nfkc, *nfkd;
+    const Normalizer2 *nfc, *nfd, *nfkc, *nfkd, *fcdNorm2;
 
  public:
     NormalizerConformanceTest();
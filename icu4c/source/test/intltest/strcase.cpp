@@ -69,6 +69,7 @@ class StringCaseTest: public IntlTest {
     void TestInPlaceTitle();
     void TestCaseMapEditsIteratorDocs();
     void TestCaseMapGreekExtended();
+    void TestLongASCIIRuns();
 
 private:
     void assertGreekUpper(const char16_t *s, const char16_t *expected);
@@ -115,6 +116,7 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
 #endif
     TESTCASE_AUTO(TestCaseMapEditsIteratorDocs);
     TESTCASE_AUTO(TestCaseMapGreekExtended);
+    TESTCASE_AUTO(TestLongASCIIRuns);
     TESTCASE_AUTO_END;
 }
 
@@ -1700,4 +1702,59 @@ void StringCaseTest::TestCaseMapGreekExtended() {
 #endif
 }
 
+void StringCaseTest::TestLongASCIIRuns() {
+    // ASCII runs are skipped and mapped in blocks;
+    // check block boundaries, non-ASCII text in between, and Turkic I/i.
+    static const struct {
+        const char16_t *src, *lower, *upper, *fold, *lowerTr;
+    } cases[] = {
+        {
+            u"Content-Type: text/html; charset=UTF-8\r\nX-Request-Id: 0123456789ABCDEF",
+            u"content-type: text/html; charset=utf-8\r\nx-request-id: 0123456789abcdef",
+            u"CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8\r\nX-REQUEST-ID: 0123456789ABCDEF",
+            u"content-type: text/html; charset=utf-8\r\nx-request-id: 0123456789abcdef",
+            u"content-type: text/html; charset=utf-8\r\nx-request-\u0131d: 0123456789abcdef"
+        },
+        {
+            u"@[`{ ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz \u00C4\u00DF\u03A3x Iiz",
+            u"@[`{ abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz \u00E4\u00DF\u03C3x iiz",
+            u"@[`{ ABCDEFGHIJKLMNOPQRSTUVWXYZ ABCDEFGHIJKLMNOPQRSTUVWXYZ \u00C4SS\u03A3X IIZ",
+            u"@[`{ abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz \u00E4ss\u03C3x iiz",
+            u"@[`{ abcdefgh\u0131jklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz \u00E4\u00DF\u03C3x \u0131iz"
+        }
+    };
+    IcuTestErrorCode errorCode(*this, "TestLongASCIIRuns");
+    Locale tr("tr");
+    for (const auto &c : cases) {
+        UnicodeString src(c.src);
+        assertEquals("lower", c.lower, UnicodeString(src).toLower(Locale::getRoot()));
+        assertEquals("upper", c.upper, UnicodeString(src).toUpper(Locale::getRoot()));
+        assertEquals("fold", c.fold, UnicodeString(src).foldCase());
+        assertEquals("lower tr", c.lowerTr, UnicodeString(src).toLower(tr));
+
+        // With Edits and U_OMIT_UNCHANGED_TEXT, only the changed text is written.
+        char16_t dest[200];
+        Edits edits;
+        int32_t length = CaseMap::toLower("", U_OMIT_UNCHANGED_TEXT,
+                                          src.getBuffer(), src.length(),
+                                          dest, UPRV_LENGTHOF(dest), &edits, errorCode);
+        UnicodeString expected;
+        for (int32_t i = 0; i < src.length(); ++i) {
+            if (src[i] != c.lower[i]) { expected.append(c.lower[i]); }
+        }
+        assertEquals("lower omit unchanged", expected, UnicodeString(dest, length));
+        assertEquals("lower numberOfChanges", expected.length(), edits.numberOfChanges());
+
+        std::string src8, lower8, upper8, fold8;
+        src.toUTF8String(src8);
+        StringByteSink<std::string> lowerSink(&lower8), upperSink(&upper8), foldSink(&fold8);
+        CaseMap::utf8ToLower("", 0, src8, lowerSink, nullptr, errorCode);
+        CaseMap::utf8ToUpper("", 0, src8, upperSink, nullptr, errorCode);
+        CaseMap::utf8Fold(0, src8, foldSink, nullptr, errorCode);
+        assertEquals("utf8 lower", UnicodeString(c.lower), UnicodeString::fromUTF8(lower8));
+        assertEquals("utf8 upper", UnicodeString(c.upper), UnicodeString::fromUTF8(upper8));
+        assertEquals("utf8 fold", UnicodeString(c.fold), UnicodeString::fromUTF8(fold8));
+    }
+}
+
 //#endif
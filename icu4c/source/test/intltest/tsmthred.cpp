@@ -25,6 +25,7 @@
 #include "tsmthred.h"
 #include "unicode/ushape.h"
 #include "unicode/translit.h"
+#include "unicode/ucnv.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
 #include "uassert.h"
@@ -79,6 +80,9 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(TestAnyTranslit);
     TESTCASE_AUTO(TestConditionVariables);
     TESTCASE_AUTO(TestUnifiedCache);
+#if !UCONFIG_NO_CONVERSION
+    TESTCASE_AUTO(TestConverterOpenClose);
+#endif
 #if !UCONFIG_NO_TRANSLITERATION
     TESTCASE_AUTO(TestBreakTranslit);
     TESTCASE_AUTO(TestIncDec);
@@ -1460,6 +1464,82 @@ void MultithreadTest::TestUnifiedCache() {
     }
 }
 
+#if !UCONFIG_NO_CONVERSION
+//
+//  Converter open/close Threading Test
+//     Threads open, use and close data-driven converters, which are found in
+//     the shared converter cache without locking, while another thread
+//     repeatedly flushes unused converters from the cache.
+//
+
+static const char *const gConverterNames[] = {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    "windows-1252", "shift_jis", "ibm-37", "gb18030",
+#endif
+    "utf-8", "iso-8859-1", "utf-16be"
+};
+
+static u_atomic_int32_t gConverterThreadsRunning;
+
+class ConverterOpenCloseThread: public SimpleThread {
+  public:
+    ConverterOpenCloseThread() {};
+    ~ConverterOpenCloseThread() {};
+    void run();
+};
+
+void ConverterOpenCloseThread::run() {
+    static const UChar text[] = { 0x41, 0x62, 0x31, 0x20, 0x7a };
+    for (int32_t i = 0; i < 2000; ++i) {
+        const char *name = gConverterNames[i % UPRV_LENGTHOF(gConverterNames)];
+        UErrorCode status = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(name, &status);
+        if (U_FAILURE(status)) {
+            IntlTest::gTest->dataerrln("%s:%d ucnv_open(%s) failed - %s",
+                                       __FILE__, __LINE__, name, u_errorName(status));
+            break;
+        }
+        char bytes[32];
+        UChar back[16];
+        int32_t length = ucnv_fromUChars(cnv, bytes, UPRV_LENGTHOF(bytes), text, UPRV_LENGTHOF(text), &status);
+        length = ucnv_toUChars(cnv, back, UPRV_LENGTHOF(back), bytes, length, &status);
+        if (U_FAILURE(status) || length != UPRV_LENGTHOF(text) ||
+                u_memcmp(text, back, length) != 0) {
+            IntlTest::gTest->errln("%s:%d %s roundtrip failure - %s",
+                                   __FILE__, __LINE__, name, u_errorName(status));
+        }
+        ucnv_close(cnv);
+    }
+    umtx_atomic_dec(&gConverterThreadsRunning);
+}
+
+class ConverterFlushThread: public SimpleThread {
+  public:
+    ConverterFlushThread() {};
+    ~ConverterFlushThread() {};
+    void run() {
+        while (umtx_loadAcquire(gConverterThreadsRunning) > 0) {
+            ucnv_flushCache();
+        }
+    }
+};
+
+void MultithreadTest::TestConverterOpenClose() {
+    static constexpr int NUM_THREADS = 4;
+    gConverterThreadsRunning = NUM_THREADS;
+    ConverterOpenCloseThread threads[NUM_THREADS];
+    ConverterFlushThread flushThread;
+    for (auto &thread:threads) {
+        thread.start();
+    }
+    flushThread.start();
+    for (auto &thread:threads) {
+        thread.join();
+    }
+    flushThread.join();
+}
+#endif /* !UCONFIG_NO_CONVERSION */
+
 #if !UCONFIG_NO_TRANSLITERATION
 //
 //  BreakTransliterator Threading Test
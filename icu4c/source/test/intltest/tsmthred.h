@@ -51,6 +51,7 @@ class MultithreadTest : public IntlTest
     void TestAnyTranslit();
     void TestConditionVariables();
     void TestUnifiedCache();
+    void TestConverterOpenClose();
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
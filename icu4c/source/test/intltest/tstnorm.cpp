@@ -10,6 +10,7 @@
 
 #if !UCONFIG_NO_NORMALIZATION
 
+#include "unicode/appendable.h"
 #include "unicode/uchar.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
@@ -55,11 +56,15 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
 #endif
     TESTCASE_AUTO(TestFilteredNormalizer2Coverage);
     TESTCASE_AUTO(TestNormalizeUTF8WithEdits);
+    TESTCASE_AUTO(TestDecomposeUTF8WithEdits);
+    TESTCASE_AUTO(TestFCDUTF8WithEdits);
     TESTCASE_AUTO(TestLowMappingToEmpty_D);
     TESTCASE_AUTO(TestLowMappingToEmpty_FCD);
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestStreamingNormalizer2);
+    TESTCASE_AUTO(TestParallelNormalizer2);
     TESTCASE_AUTO_END;
 }
 
@@ -1071,7 +1076,19 @@ BasicNormalizerTest::TestCompare() {
 
         // empty string
         // 46
-        ""
+        "",
+
+        // long ASCII prefixes before the first non-ASCII character
+        // or before the first ASCII difference
+        // 47..54
+        "Hello, World 0123456789 \\u00C4x",
+        "hello, world 0123456789 A\\u0308X",
+        "HELLO, WORLD 0123456789 a\\u0323\\u0308x",
+        "hello, world 0123456789 I",
+        "hello, world 0123456789 \\u0131",
+        "hello, world 0123456789 i\\u0300",
+        "hello, world 0123456789 [",
+        "HELLO, WORLD 0123456789 _"
     };
 
     UnicodeString s[100]; // at least as many items as in strings[] !
@@ -1669,6 +1686,129 @@ BasicNormalizerTest::TestNormalizeUTF8WithEdits() {
             TRUE, errorCode);
 }
 
+void
+BasicNormalizerTest::TestDecomposeUTF8WithEdits() {
+    IcuTestErrorCode errorCode(*this, "TestDecomposeUTF8WithEdits");
+    const Normalizer2 *nfkd=Normalizer2::getNFKDInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFKDInstance() call failed")) {
+        return;
+    }
+    static const char *const src =
+        u8"  AÄA\u0308A\u0308\u0323Ä\u0323,가\u3133\uFB01  ";
+    std::string expected = u8"  AA\u0308A\u0308A\u0323\u0308A\u0323\u0308,\u1100\u1161\u11AAfi  ";
+    std::string result;
+    StringByteSink<std::string> sink(&result, expected.length());
+    Edits edits;
+    nfkd->normalizeUTF8(0, src, sink, &edits, errorCode);
+    assertSuccess("normalizeUTF8 with Edits", errorCode.get());
+    assertEquals("normalizeUTF8 with Edits", expected.c_str(), result.c_str());
+    static const EditChange expectedChanges[] = {
+        { FALSE, 3, 3 },  // 2 spaces + A
+        { TRUE, 2, 3 },  // Ä→A\u0308
+        { FALSE, 4, 4 },  // A\u0308A
+        { TRUE, 4, 4 },  // \u0308\u0323→\u0323\u0308
+        { TRUE, 4, 5 },  // Ä\u0323→A\u0323\u0308
+        { FALSE, 1, 1 },  // comma
+        { TRUE, 3, 6 },  // 가→\u1100\u1161
+        { TRUE, 3, 3 },  // \u3133→\u11AA
+        { TRUE, 3, 2 },  // \uFB01→fi
+        { FALSE, 2, 2 }  // 2 spaces
+    };
+    assertTrue("normalizeUTF8 with Edits hasChanges", edits.hasChanges());
+    assertEquals("normalizeUTF8 with Edits numberOfChanges", 6, edits.numberOfChanges());
+    TestUtility::checkEditsIter(*this, u"normalizeUTF8 with Edits",
+            edits.getFineIterator(), edits.getFineIterator(),
+            expectedChanges, UPRV_LENGTHOF(expectedChanges),
+            TRUE, errorCode);
+
+    assertFalse("isNormalizedUTF8(source)", nfkd->isNormalizedUTF8(src, errorCode));
+    assertTrue("isNormalizedUTF8(normalized)", nfkd->isNormalizedUTF8(result, errorCode));
+
+    // Omit unchanged text.
+    expected = u8"A\u0308\u0323\u0308A\u0323\u0308\u1100\u1161\u11AAfi";
+    result.clear();
+    edits.reset();
+    nfkd->normalizeUTF8(U_OMIT_UNCHANGED_TEXT, src, sink, &edits, errorCode);
+    assertSuccess("normalizeUTF8 omit unchanged", errorCode.get());
+    assertEquals("normalizeUTF8 omit unchanged", expected.c_str(), result.c_str());
+    assertTrue("normalizeUTF8 omit unchanged hasChanges", edits.hasChanges());
+    assertEquals("normalizeUTF8 omit unchanged numberOfChanges", 6, edits.numberOfChanges());
+    TestUtility::checkEditsIter(*this, u"normalizeUTF8 omit unchanged",
+            edits.getFineIterator(), edits.getFineIterator(),
+            expectedChanges, UPRV_LENGTHOF(expectedChanges),
+            TRUE, errorCode);
+
+    // With filter: The normalization code does not see the "Ä" substrings.
+    UnicodeSet filter(u"[^Ä]", errorCode);
+    FilteredNormalizer2 fn2(*nfkd, filter);
+    expected = u8"  AÄA\u0308A\u0323\u0308Ä\u0323,\u1100\u1161\u11AAfi  ";
+    result.clear();
+    edits.reset();
+    fn2.normalizeUTF8(0, src, sink, &edits, errorCode);
+    assertSuccess("filtered normalizeUTF8", errorCode.get());
+    assertEquals("filtered normalizeUTF8", expected.c_str(), result.c_str());
+    static const EditChange filteredChanges[] = {
+        { FALSE, 9, 9 },  // 2 spaces + AÄA\u0308A
+        { TRUE, 4, 4 },  // \u0308\u0323→\u0323\u0308
+        { FALSE, 5, 5 },  // Ä\u0323,
+        { TRUE, 3, 6 },  // 가→\u1100\u1161
+        { TRUE, 3, 3 },  // \u3133→\u11AA
+        { TRUE, 3, 2 },  // \uFB01→fi
+        { FALSE, 2, 2 }  // 2 spaces
+    };
+    assertTrue("filtered normalizeUTF8 hasChanges", edits.hasChanges());
+    assertEquals("filtered normalizeUTF8 numberOfChanges", 4, edits.numberOfChanges());
+    TestUtility::checkEditsIter(*this, u"filtered normalizeUTF8",
+            edits.getFineIterator(), edits.getFineIterator(),
+            filteredChanges, UPRV_LENGTHOF(filteredChanges),
+            TRUE, errorCode);
+}
+
+void
+BasicNormalizerTest::TestFCDUTF8WithEdits() {
+    IcuTestErrorCode errorCode(*this, "TestFCDUTF8WithEdits");
+    const Normalizer2 *fcd=Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getInstance(FCD) call failed")) {
+        return;
+    }
+    static const char *const src =
+        u8"  AÄA\u0308A\u0308\u0323Ä\u0323,가\u3133\uFB01  ";
+    std::string expected = u8"  AÄA\u0308A\u0323\u0308A\u0323\u0308,가\u3133\uFB01  ";
+    std::string result;
+    StringByteSink<std::string> sink(&result, expected.length());
+    Edits edits;
+    fcd->normalizeUTF8(0, src, sink, &edits, errorCode);
+    assertSuccess("normalizeUTF8 with Edits", errorCode.get());
+    assertEquals("normalizeUTF8 with Edits", expected.c_str(), result.c_str());
+    static const EditChange expectedChanges[] = {
+        { FALSE, 9, 9 },  // 2 spaces + AÄA\u0308A
+        { TRUE, 4, 4 },  // \u0308\u0323→\u0323\u0308
+        { TRUE, 4, 5 },  // Ä\u0323→A\u0323\u0308
+        { FALSE, 12, 12 }  // comma + 가\u3133\uFB01 + 2 spaces
+    };
+    assertTrue("normalizeUTF8 with Edits hasChanges", edits.hasChanges());
+    assertEquals("normalizeUTF8 with Edits numberOfChanges", 2, edits.numberOfChanges());
+    TestUtility::checkEditsIter(*this, u"normalizeUTF8 with Edits",
+            edits.getFineIterator(), edits.getFineIterator(),
+            expectedChanges, UPRV_LENGTHOF(expectedChanges),
+            TRUE, errorCode);
+
+    assertFalse("isNormalizedUTF8(source)", fcd->isNormalizedUTF8(src, errorCode));
+    assertTrue("isNormalizedUTF8(normalized)", fcd->isNormalizedUTF8(result, errorCode));
+
+    // Omit unchanged text.
+    expected = u8"\u0323\u0308A\u0323\u0308";
+    result.clear();
+    edits.reset();
+    fcd->normalizeUTF8(U_OMIT_UNCHANGED_TEXT, src, sink, &edits, errorCode);
+    assertSuccess("normalizeUTF8 omit unchanged", errorCode.get());
+    assertEquals("normalizeUTF8 omit unchanged", expected.c_str(), result.c_str());
+    TestUtility::checkEditsIter(*this, u"normalizeUTF8 omit unchanged",
+            edits.getFineIterator(), edits.getFineIterator(),
+            expectedChanges, UPRV_LENGTHOF(expectedChanges),
+            TRUE, errorCode);
+}
+
 void
 BasicNormalizerTest::TestLowMappingToEmpty_D() {
     IcuTestErrorCode errorCode(*this, "TestLowMappingToEmpty_D");
@@ -1806,3 +1946,170 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
 }
 
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
+
+namespace {
+
+UnicodeString streamInChunks(StreamingNormalizer2 &stream, const UnicodeString &src,
+                             int32_t chunkLength, UErrorCode &errorCode) {
+    UnicodeString result;
+    UnicodeStringAppendable app(result);
+    for(int32_t i=0; i<src.length(); i+=chunkLength) {
+        stream.normalize(src.tempSubString(i, chunkLength), app, errorCode);
+    }
+    stream.finish(app, errorCode);
+    return result;
+}
+
+std::string streamUTF8InChunks(StreamingNormalizer2 &stream, const std::string &src,
+                               int32_t chunkLength, UErrorCode &errorCode) {
+    std::string result;
+    StringByteSink<std::string> sink(&result);
+    for(int32_t i=0; i<(int32_t)src.length(); i+=chunkLength) {
+        int32_t length=(int32_t)src.length()-i;
+        if(length>chunkLength) { length=chunkLength; }
+        stream.normalizeUTF8(StringPiece(src.data()+i, length), sink, errorCode);
+    }
+    stream.finishUTF8(sink, errorCode);
+    return result;
+}
+
+}  // namespace
+
+void
+BasicNormalizerTest::TestStreamingNormalizer2() {
+    IcuTestErrorCode errorCode(*this, "TestStreamingNormalizer2");
+    const Normalizer2 *nfc=Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd=Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf=Normalizer2::getNFKCCasefoldInstance(errorCode);
+    const Normalizer2 *fcd=Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getInstance() call failed")) {
+        return;
+    }
+    UnicodeSet filter(UnicodeString(u"[^\u00a0-\u00ff\u0310-\u031f]"), errorCode);
+    filter.freeze();
+    FilteredNormalizer2 fn2(*nfc, filter);
+    const Normalizer2 *const norms[] = { nfc, nfd, nfkc_cf, fcd, &fn2 };
+    const char *const names[] = { "NFC", "NFD", "NFKC_CF", "FCD", "filtered NFC" };
+
+    // Chunks of up to 7 units split surrogate pairs, UTF-8 sequences,
+    // combining sequences and Hangul syllables.
+    UnicodeString src(TRUE,
+        u"  AÄA\u0308A\u0308\u0323Ä\u0323,가\u3133\uFB01 \U0001D15E\U0001D15F "
+        u"a\u0301\u0327\u0316 \u1100\u1161\u11A8\u1100\u1161 ñ\u0303 Å\u0301 "
+        u"\u0D4A\u0D3E\u0D57 \u0F73\u0F75 \u00AD\u1E9B\u0323 xyz", -1);
+    UnicodeString src2=src+src+src;
+    src2.append((UChar)0xd800).append(u'x').append((UChar)0xdc00).append(u'\u0301');
+    std::string src8;
+    src2.toUTF8String(src8);
+    src8.append("\xE3\x81 \xCC\xC3\xA4\xCC\x81\xF0\x9D\x85\x80");
+    src8.append("\x80\xC3\xCC\x88 e");
+
+    for(int32_t n=0; n<UPRV_LENGTHOF(norms); ++n) {
+        const Normalizer2 &n2=*norms[n];
+        StreamingNormalizer2 stream(n2);
+        UnicodeString expected=n2.normalize(src2, errorCode);
+        std::string expected8;
+        StringByteSink<std::string> sink(&expected8);
+        n2.normalizeUTF8(0, src8, sink, nullptr, errorCode);
+        for(int32_t chunkLength=1; chunkLength<=500; chunkLength+=(chunkLength<8 ? 1 : 97)) {
+            UnicodeString result=streamInChunks(stream, src2, chunkLength, errorCode);
+            std::string result8=streamUTF8InChunks(stream, src8, chunkLength, errorCode);
+            if(errorCode.errIfFailureAndReset("%s chunkLength=%d", names[n], (int)chunkLength)) {
+                return;
+            }
+            assertEquals(UnicodeString(names[n])+u" UTF-16 chunkLength="+Int64ToUnicodeString(chunkLength),
+                         expected, result);
+            assertEquals(UnicodeString(names[n])+u" UTF-8 chunkLength="+Int64ToUnicodeString(chunkLength),
+                         expected8.c_str(), result8.c_str());
+        }
+    }
+
+    // reset() discards held-back text.
+    StreamingNormalizer2 stream(*nfc);
+    UnicodeString result;
+    UnicodeStringAppendable app(result);
+    stream.normalize(u"ab", app, errorCode);
+    stream.reset();
+    stream.normalize(u"A\u030A", app, errorCode);
+    stream.finish(app, errorCode);
+    assertEquals("reset()", u"aÅ", result);
+
+    // A run without any boundary that is longer than the internal buffer
+    // is normalized in pieces, and the result is still normalized.
+    UnicodeString longRun(u'a');
+    for(int32_t i=0; i<2000; ++i) {
+        longRun.append((UChar)(0x300+(i%3)*0x10));  // ccc 230, 230, 220
+    }
+    result=streamInChunks(stream, longRun, 100, errorCode);
+    errorCode.errIfFailureAndReset("long run");
+    assertEquals("long run length", longRun.length()-1, result.length());
+    assertEquals("long run starts with a-grave", u'\u00E0', result.charAt(0));
+}
+
+void
+BasicNormalizerTest::TestParallelNormalizer2() {
+    IcuTestErrorCode errorCode(*this, "TestParallelNormalizer2");
+    const Normalizer2 *nfc=Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd=Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf=Normalizer2::getNFKCCasefoldInstance(errorCode);
+    const Normalizer2 *fcd=Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getInstance() call failed")) {
+        return;
+    }
+    const Normalizer2 *const norms[] = { nfc, nfd, nfkc_cf, fcd };
+    const char *const names[] = { "NFC", "NFD", "NFKC_CF", "FCD" };
+
+    // Long enough to be split into several pieces.
+    // Odd-length repetitions make the cut points fall in the middle of
+    // surrogate pairs, UTF-8 sequences and combining sequences.
+    UnicodeString unit(TRUE,
+        u"AÄA\u0308A\u0308\u0323Ä\u0323,가\u3133\uFB01\U0001D15E\U0001D15F"
+        u"a\u0301\u0327\u0316\u1100\u1161\u11A8ñ\u0303Å\u0301\u0F73\u0F75\u1E9B\u0323", -1);
+    UnicodeString src;
+    while(src.length()<500000) {
+        src.append(unit);
+    }
+    std::string src8;
+    src.toUTF8String(src8);
+    src8.append("\xE3\x81 \xCC\xC3\xA4\xCC\x81\xF0\x9D\x85");
+
+    for(int32_t n=0; n<UPRV_LENGTHOF(norms); ++n) {
+        const Normalizer2 &n2=*norms[n];
+        UnicodeString expected=n2.normalize(src, errorCode);
+        std::string expected8;
+        StringByteSink<std::string> expectedSink(&expected8);
+        n2.normalizeUTF8(0, src8, expectedSink, nullptr, errorCode);
+        for(int32_t numThreads=1; numThreads<=8; numThreads*=2) {
+            ParallelNormalizer2 pn2(n2, numThreads);
+            UnicodeString result;
+            pn2.normalize(src, result, errorCode);
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            pn2.normalizeUTF8(src8, sink, errorCode);
+            UNormalizationCheckResult qc=pn2.quickCheck(src, errorCode);
+            UNormalizationCheckResult qcNormalized=pn2.quickCheck(expected, errorCode);
+            if(errorCode.errIfFailureAndReset("%s numThreads=%d", names[n], (int)numThreads)) {
+                return;
+            }
+            UnicodeString message=UnicodeString(names[n], -1, US_INV)+u" numThreads="+
+                Int64ToUnicodeString(numThreads);
+            assertTrue(message+u" normalize()", expected==result);
+            assertTrue(message+u" normalizeUTF8()", expected8==result8);
+            assertEquals(message+u" quickCheck(src)", n2.quickCheck(src, errorCode), qc);
+            assertEquals(message+u" quickCheck(normalized)",
+                         n2.quickCheck(expected, errorCode), qcNormalized);
+        }
+    }
+
+    // A "no" only in the last piece.
+    UnicodeString ascii;
+    while(ascii.length()<500000) {
+        ascii.append(u"abcdefghijklmnopqrstuvwxyz ");
+    }
+    ascii.append(u'\u212B');  // Angstrom sign, NFC_QC=No
+    ParallelNormalizer2 pnfc(*nfc, 4);
+    assertEquals("quickCheck(ASCII+Angstrom sign)", UNORM_NO, pnfc.quickCheck(ascii, errorCode));
+
+    pnfc.normalize(ascii, ascii, errorCode);
+    assertEquals("normalize(src, src)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
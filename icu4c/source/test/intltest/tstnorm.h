@@ -48,11 +48,15 @@ class BasicNormalizerTest : public IntlTest {
     void TestCustomFCC();
     void TestFilteredNormalizer2Coverage();
     void TestNormalizeUTF8WithEdits();
+    void TestDecomposeUTF8WithEdits();
+    void TestFCDUTF8WithEdits();
     void TestLowMappingToEmpty_D();
     void TestLowMappingToEmpty_FCD();
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestStreamingNormalizer2();
+    void TestParallelNormalizer2();
 
 private:
     UnicodeString canonTests[24][3];
@@ -13,6 +13,7 @@
 #include "unicode/uscript.h"
 #include "unicode/uset.h"
 #include "cstring.h"
+#include "genprophdrtest.h"
 #include "hash.h"
 #include "patternprops.h"
 #include "normalizer2impl.h"
@@ -72,6 +73,7 @@ void UnicodeTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestInvalidCodePointFolding);
     TESTCASE_AUTO(TestBinaryCharacterProperties);
     TESTCASE_AUTO(TestIntCharacterProperties);
+    TESTCASE_AUTO(TestGeneratedPropertyHeader);
     TESTCASE_AUTO_END;
 }
 
@@ -690,3 +692,34 @@ void UnicodeTest::TestIntCharacterProperties() {
             u_getIntPropertyValue(0x61, (UProperty)prop), ucpmap_get(map, 0x61));
     }
 }
+
+// genprophdrtest.h is generated by tools/genprophdr:
+// genprophdr -d test/intltest -o genprophdrtest.h -n genprophdrtest gc WSpace Alpha sc scf
+// Regenerate it when the Unicode data changes.
+void UnicodeTest::TestGeneratedPropertyHeader() {
+    // The lookups must be usable in constant expressions.
+    static_assert(genprophdrtest::generalCategory(0x41) == U_UPPERCASE_LETTER, "gc(A)");
+    static_assert(genprophdrtest::isWhiteSpace(0x3000), "WSpace(U+3000)");
+    static_assert(!genprophdrtest::isAlphabetic(0x30), "!Alpha(0)");
+    static_assert(genprophdrtest::script(0x10400) == USCRIPT_DESERET, "sc(U+10400)");
+    static_assert(genprophdrtest::simpleCaseFolding(0x10400) == 0x10428, "scf(U+10400)");
+
+    for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+        if (genprophdrtest::generalCategory(c) != u_charType(c) ||
+                genprophdrtest::isWhiteSpace(c) != (bool)u_isUWhiteSpace(c) ||
+                genprophdrtest::isAlphabetic(c) != (bool)u_isUAlphabetic(c) ||
+                genprophdrtest::simpleCaseFolding(c) != u_foldCase(c, U_FOLD_CASE_DEFAULT)) {
+            errln("genprophdrtest.h gc/WSpace/Alpha/scf mismatch at U+%04lx (regenerate the header?)", (long)c);
+            return;
+        }
+        UErrorCode errorCode = U_ZERO_ERROR;
+        if (genprophdrtest::script(c) != uscript_getScript(c, &errorCode)) {
+            errln("genprophdrtest.h sc mismatch at U+%04lx (regenerate the header?)", (long)c);
+            return;
+        }
+    }
+    // Out-of-range inputs return the error value, and case mappings map them to themselves.
+    assertEquals("gc(-1)", 0, genprophdrtest::generalCategory(-1));
+    assertFalse("WSpace(0x110000)", genprophdrtest::isWhiteSpace(0x110000));
+    assertEquals("scf(0x110000)", 0x110000, genprophdrtest::simpleCaseFolding(0x110000));
+}
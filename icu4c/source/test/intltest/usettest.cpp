@@ -26,6 +26,7 @@
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "unicode/uversion.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "hash.h"
 
@@ -86,6 +87,8 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestPosixClasses);
     TESTCASE_AUTO(TestIteration);
     TESTCASE_AUTO(TestFreezable);
+    TESTCASE_AUTO(TestFreezeWithCodePointTrie);
+    TESTCASE_AUTO(TestSpanASCIIRuns);
     TESTCASE_AUTO(TestSpan);
     TESTCASE_AUTO(TestStringSpan);
     TESTCASE_AUTO(TestUCAUnsafeBackwards);
@@ -2341,6 +2344,152 @@ void UnicodeSetTest::TestFreezable() {
     }
 }
 
+// Compares alternating span()/spanBack() results of two sets with the same code points.
+static UBool sameSpans(const UnicodeSet &a, const UnicodeSet &b, const UnicodeString &s16, const CharString &s8) {
+    const UChar *s=s16.getBuffer();
+    int32_t length=s16.length();
+    int32_t i, limit;
+    int cond;
+    for(i=0, cond=0; i<length; i+=limit, cond^=1) {
+        limit=a.span(s+i, length-i, (USetSpanCondition)cond);
+        if(limit!=b.span(s+i, length-i, (USetSpanCondition)cond)) { return FALSE; }
+    }
+    for(i=length, cond=0; i>0; cond^=1) {
+        limit=a.spanBack(s, i, (USetSpanCondition)cond);
+        if(limit!=b.spanBack(s, i, (USetSpanCondition)cond)) { return FALSE; }
+        i=limit;
+    }
+    length=s8.length();
+    for(i=0, cond=0; i<length; i+=limit, cond^=1) {
+        limit=a.spanUTF8(s8.data()+i, length-i, (USetSpanCondition)cond);
+        if(limit!=b.spanUTF8(s8.data()+i, length-i, (USetSpanCondition)cond)) { return FALSE; }
+    }
+    for(i=length, cond=0; i>0; cond^=1) {
+        limit=a.spanBackUTF8(s8.data(), i, (USetSpanCondition)cond);
+        if(limit!=b.spanBackUTF8(s8.data(), i, (USetSpanCondition)cond)) { return FALSE; }
+        i=limit;
+    }
+    return TRUE;
+}
+
+void UnicodeSetTest::TestFreezeWithCodePointTrie() {
+    IcuTestErrorCode errorCode(*this, "TestFreezeWithCodePointTrie");
+    static const char *const patterns[]={
+        "[:ID_Continue:]", "[:Lu:]", "[:White_Space:]",
+        "[[:sc=Arab:][\\U0001F600-\\U0001F64F]]", "[^[:L:]]", "[\\U0010FFF0-\\U0010FFFF]"
+    };
+    static const uint32_t freezeOptions[]={
+        0, USET_FREEZE_CODE_POINT_TRIE
+    };
+    // Sample code points from all planes, including unpaired surrogates,
+    // plus some ill-formed UTF-8.
+    UnicodeString s16;
+    CharString s8;
+    for(UChar32 c=0; c<=0x10ffff; c+=0x3b) {
+        s16.append(c);
+        if(U_IS_SURROGATE(c)) {
+            s8.append("\xed\xa0\x80", errorCode);
+        } else {
+            char buffer[U8_MAX_LENGTH];
+            int32_t length=0;
+            U8_APPEND_UNSAFE(buffer, length, c);
+            s8.append(buffer, length, errorCode);
+        }
+    }
+    s8.append("\xf4\x90\x80\x80\xc0\x80", errorCode);
+
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UnicodeSet set(UnicodeString(patterns[i], -1, US_INV), errorCode);
+        if(errorCode.errDataIfFailureAndReset("UnicodeSet(%s)", patterns[i])) {
+            continue;
+        }
+        UnicodeSet reference(set);
+        reference.freeze();
+        for(int32_t j=0; j<UPRV_LENGTHOF(freezeOptions); ++j) {
+            UnicodeSet frozen(set);
+            frozen.freeze(freezeOptions[j]);
+            // The second copy copies a trie that was itself copied from serialized data.
+            UnicodeSet copy(frozen);
+            UnicodeSet copy2(copy);
+            if(!frozen.isFrozen() || !copy.isFrozen() || !copy2.isFrozen() ||
+                    frozen!=set || copy!=set || copy2!=set) {
+                errln("FAIL: %s freeze(0x%x) or copy of the frozen set", patterns[i], (int)freezeOptions[j]);
+                continue;
+            }
+            for(UChar32 c=-1; c<=0x110000; ++c) {
+                UBool expected=set.contains(c);
+                if(frozen.contains(c)!=expected || copy.contains(c)!=expected || copy2.contains(c)!=expected) {
+                    errln("FAIL: %s freeze(0x%x).contains(U+%04lx)!=%d",
+                          patterns[i], (int)freezeOptions[j], (long)c, expected);
+                    break;
+                }
+            }
+            if(!sameSpans(frozen, reference, s16, s8) || !sameSpans(copy, reference, s16, s8) ||
+                    !sameSpans(copy2, reference, s16, s8)) {
+                errln("FAIL: %s freeze(0x%x) spans differ from freeze()",
+                      patterns[i], (int)freezeOptions[j]);
+            }
+        }
+    }
+}
+
+// Long and short runs of ASCII characters, for the vectorized ASCII spans
+// of frozen sets whose ASCII characters form few ranges.
+void UnicodeSetTest::TestSpanASCIIRuns() {
+    IcuTestErrorCode errorCode(*this, "TestSpanASCIIRuns");
+    static const char *const patterns[]={
+        "[:White_Space:]", "[a-zA-Z0-9_]", "[^\\n]", "[\\u0000-\\u007f]", "[]",
+        "[:L:]", "[[:P:][:S:]]", "[\\u0000\\u007f\\u0080\\u00ff\\uffff]"
+    };
+    static const UChar32 nonASCII[]={ 0xe9, 0x80, 0x3000, 0xffff, 0x1f600, 0x10ffff };
+    // Pseudo-random runs of ASCII characters of lengths 0..40,
+    // separated by non-ASCII characters.
+    UnicodeString s16;
+    CharString s8;
+    uint32_t r=1;
+    for(int32_t i=0; i<2000; ++i) {
+        r=r*1103515245+12345;
+        int32_t runLength=(int32_t)((r>>16)%41);
+        // Each run uses one class of characters, to get long spans.
+        static const struct {
+            const char *chars;
+            int32_t length;
+        } runChars[]={ { "abcXYZ09_", 9 }, { " \t\n\r", 4 }, { "!?-,.;\\\"", 8 }, { "\0\x7f", 2 } };
+        int32_t k=(int32_t)((r>>8)%UPRV_LENGTHOF(runChars));
+        for(int32_t j=0; j<runLength; ++j) {
+            r=r*1103515245+12345;
+            char c=runChars[k].chars[(r>>16)%runChars[k].length];
+            s16.append((UChar)(uint8_t)c);
+            s8.append(c, errorCode);
+        }
+        UChar32 c=nonASCII[(r>>4)%UPRV_LENGTHOF(nonASCII)];
+        s16.append(c);
+        char buffer[U8_MAX_LENGTH];
+        int32_t length=0;
+        U8_APPEND_UNSAFE(buffer, length, c);
+        s8.append(buffer, length, errorCode);
+    }
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UnicodeSet set(UnicodeString(patterns[i], -1, US_INV), errorCode);
+        if(errorCode.errDataIfFailureAndReset("UnicodeSet(%s)", patterns[i])) {
+            continue;
+        }
+        UnicodeSet frozen(set);
+        frozen.freeze();
+        if(!sameSpans(frozen, set, s16, s8)) {
+            errln("FAIL: %s frozen set spans differ from the thawed set", patterns[i]);
+        }
+        // All starting offsets within one block of units.
+        for(int32_t start=1; start<20; ++start) {
+            if(!sameSpans(frozen, set, s16.tempSubString(start), CharString(s8.data()+start, s8.length()-start, errorCode))) {
+                errln("FAIL: %s frozen set spans from offset %d differ from the thawed set",
+                      patterns[i], (int)start);
+                break;
+            }
+        }
+    }
+}
+
 // Test span() etc. -------------------------------------------------------- ***
 
 // Append the UTF-8 version of the string to t and return the appended UTF-8 length.
@@ -85,6 +85,8 @@ class UnicodeSetTest: public IntlTest {
     void TestPosixClasses();
 
     void TestFreezable();
+    void TestFreezeWithCodePointTrie();
+    void TestSpanASCIIRuns();
 
     void TestSpan();
 
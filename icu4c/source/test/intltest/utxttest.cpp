@@ -13,6 +13,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string>
 #include "unicode/utypes.h"
 #include "unicode/utext.h"
 #include "unicode/utf8.h"
@@ -61,6 +62,7 @@ UTextTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(Ticket10983);
     TESTCASE_AUTO(Ticket12130);
     TESTCASE_AUTO(Ticket13344);
+    TESTCASE_AUTO(FileTextTest);
     TESTCASE_AUTO_END;
 }
 
@@ -150,8 +152,57 @@ void  UTextTest::TextTest() {
         }
     }
     TestString(s);
+
+    // Mostly-ASCII string, with ASCII runs around the lengths of UTF-8 chunks,
+    //   separated by single non-ASCII characters of each UTF-8 length.
+    //   Exercises the ASCII-only chunks, and chunks ending before ASCII text.
+    static const int32_t runLengths[] = { 1, 15, 31, 32, 33, 95, 127, 128, 129, 300, 2, 64 };
+    static const UChar32 separators[] = { 0xe9, 0x20ac, 0x1f600 };
+    s.truncate(0);
+    for (i=0; i<UPRV_LENGTHOF(runLengths); i++) {
+        for (j=0; j<runLengths[i]; j++) {
+            s.append((UChar)(0x61 + (i + j) % 26));
+        }
+        s.append(separators[i % UPRV_LENGTHOF(separators)]);
+    }
+    TestString(s);
+}
+
+
+//
+//  writeTestFile()  Write the bytes to a file in the current directory.
+//
+static UBool writeTestFile(const char *name, const char *bytes, int32_t length) {
+    FILE *f = fopen(name, "wb");
+    if (f == NULL) {
+        return FALSE;
+    }
+    UBool ok = (int32_t)fwrite(bytes, 1, length, f) == length;
+    return fclose(f) == 0 && ok;
 }
 
+//
+//  toUTF16Bytes()   Returns a string whose code units, in memory, are the
+//                   UTF-16BE or UTF-16LE bytes of s.
+//
+static UnicodeString toUTF16Bytes(const UnicodeString &s, UBool littleEndian) {
+    UnicodeString bytes;
+    for (int32_t i = 0; i < s.length(); ++i) {
+        UChar c = s.charAt(i);
+        uint8_t b[2];
+        if (littleEndian) {
+            b[0] = (uint8_t)c;
+            b[1] = (uint8_t)(c >> 8);
+        } else {
+            b[0] = (uint8_t)(c >> 8);
+            b[1] = (uint8_t)c;
+        }
+        UChar unit;
+        uprv_memcpy(&unit, b, 2);
+        bytes.append(unit);
+    }
+    return bytes;
+}
 
 //
 //  TestString()     Run a suite of UText tests on a string.
@@ -278,8 +329,48 @@ void UTextTest::TestString(const UnicodeString &s) {
     TestAccess(sa, ut, cpCount, u8Map);
     utext_close(ut);
 
+    //
+    // UTF-8 and UTF-16 file tests
+    //
+    static const char *const fileName = "utxttest-file.txt";
+    if (writeTestFile(fileName, u8String, u8Len)) {
+        status = U_ZERO_ERROR;
+        ut = utext_openUTF8File(NULL, fileName, &status);
+        TEST_SUCCESS(status);
+        TestAccess(sa, ut, cpCount, u8Map);
+        utext_close(ut);
+    }
 
+    // UTF-16BE without a BOM has the same native indexes as the UChar string.
+    UnicodeString bytes16 = toUTF16Bytes(sa, FALSE);
+    if (writeTestFile(fileName, (const char *)bytes16.getBuffer(), saLen * 2)) {
+        status = U_ZERO_ERROR;
+        ut = utext_openUTF16File(NULL, fileName, &status);
+        TEST_SUCCESS(status);
+        TestAccess(sa, ut, cpCount, cpMap);
+        utext_close(ut);
+    }
+
+    // UTF-16LE with a BOM, which is part of the text.
+    UnicodeString saBOM = UnicodeString((UChar)0xfeff).append(sa);
+    bytes16 = toUTF16Bytes(saBOM, TRUE);
+    m *bomMap = new m[cpCount + 2];
+    bomMap[0].nativeIdx = 0;
+    bomMap[0].cp = 0xfeff;
+    for (j=0; j<=cpCount; j++) {
+        bomMap[j+1].nativeIdx = cpMap[j].nativeIdx + 1;
+        bomMap[j+1].cp = cpMap[j].cp;
+    }
+    if (writeTestFile(fileName, (const char *)bytes16.getBuffer(), (saLen + 1) * 2)) {
+        status = U_ZERO_ERROR;
+        ut = utext_openUTF16File(NULL, fileName, &status);
+        TEST_SUCCESS(status);
+        TestAccess(saBOM, ut, cpCount + 1, bomMap);
+        utext_close(ut);
+    }
+    remove(fileName);
 
+    delete []bomMap;
     delete []cpMap;
     delete []u8Map;
     delete []u8String;
@@ -1605,3 +1696,189 @@ void UTextTest::Ticket13344() {
     assertEquals("UTextTest::Ticket13344-bmp-2", (int64_t)5, utext_getNativeIndex(ut.getAlias()));
 }
 
+//
+// FileTextTest  Errors, and UTF-16 files longer than the chunks
+//               of direct UTF-16 access, in both byte orders.
+//
+void UTextTest::FileTextTest() {
+    static const char *const fileName = "utxttest-file.txt";
+    UErrorCode status = U_ZERO_ERROR;
+    UText *ut = utext_openUTF8File(NULL, "utxttest-no-such-file.txt", &status);
+    assertEquals("missing UTF-8 file", U_FILE_ACCESS_ERROR, status);
+    utext_close(ut);
+    status = U_ZERO_ERROR;
+    ut = utext_openUTF16File(NULL, "utxttest-no-such-file.txt", &status);
+    assertEquals("missing UTF-16 file", U_FILE_ACCESS_ERROR, status);
+    utext_close(ut);
+
+    // An odd byte at the end of a UTF-16 file is ignored.
+    if (!writeTestFile(fileName, "\0a\0b\0", 5)) {
+        dataerrln("unable to write %s", fileName);
+        return;
+    }
+    status = U_ZERO_ERROR;
+    LocalUTextPointer odd(utext_openUTF16File(NULL, fileName, &status));
+    if (!assertSuccess("open odd-length UTF-16 file", status)) {
+        return;
+    }
+    assertEquals("odd-length UTF-16 file length", (int64_t)2, utext_nativeLength(odd.getAlias()));
+    assertEquals("odd-length UTF-16 file [1]", (UChar32)0x62, utext_char32At(odd.getAlias(), 1));
+    odd.adoptInstead(NULL);
+
+    // Backward access from a trail byte of the first character in a buffer,
+    // and of the first character in the file.
+    if (!writeTestFile(fileName, "abc\xC3\xA9xyz", 8)) {
+        dataerrln("unable to write %s", fileName);
+        return;
+    }
+    status = U_ZERO_ERROR;
+    LocalUTextPointer trail(utext_openUTF8File(NULL, fileName, &status));
+    if (!assertSuccess("open UTF-8 file", status)) {
+        return;
+    }
+    assertEquals("UTF-8 file char32At(3)", (UChar32)0xe9, utext_char32At(trail.getAlias(), 3));
+    assertEquals("UTF-8 file previous32From(4)", (UChar32)0x63, utext_previous32From(trail.getAlias(), 4));
+    assertEquals("UTF-8 file index after previous32From(4)", (int64_t)2, utext_getNativeIndex(trail.getAlias()));
+    trail.adoptInstead(NULL);
+    if (!writeTestFile(fileName, "\xC3\xA9" "abc", 5)) {
+        dataerrln("unable to write %s", fileName);
+        return;
+    }
+    status = U_ZERO_ERROR;
+    trail.adoptInstead(utext_openUTF8File(NULL, fileName, &status));
+    if (!assertSuccess("open UTF-8 file", status)) {
+        return;
+    }
+    assertEquals("UTF-8 file char32At(1)", (UChar32)0xe9, utext_char32At(trail.getAlias(), 1));
+    assertEquals("UTF-8 file previous32From(1)", (UChar32)U_SENTINEL, utext_previous32From(trail.getAlias(), 1));
+    assertEquals("UTF-8 file index after previous32From(1)", (int64_t)0, utext_getNativeIndex(trail.getAlias()));
+    assertEquals("UTF-8 file previous32From(3)", (UChar32)0x61, utext_previous32From(trail.getAlias(), 3));
+    trail.adoptInstead(NULL);
+
+    // Every index of multi-byte characters that straddle buffer boundaries,
+    // visited after forward and after backward iteration.
+    {
+        UnicodeString text;
+        for (int32_t i = 0; text.length() < 2000; ++i) {
+            static const UChar32 nonASCII[] = { 0xe9, 0x4e00, 0x1f600 };
+            if (i % 7 < 4) {
+                text.append((UChar)(0x61 + i % 26));
+            } else {
+                text.append(nonASCII[i % 3]);
+            }
+        }
+        std::string u8;
+        text.toUTF8String(u8);
+        if (!writeTestFile(fileName, u8.data(), (int32_t)u8.length())) {
+            dataerrln("unable to write %s", fileName);
+            return;
+        }
+        int32_t u8Length = (int32_t)u8.length();
+        const uint8_t *s8 = (const uint8_t *)u8.data();
+        for (int32_t pass = 0; pass < 2; ++pass) {
+            for (int32_t i = 1; i < u8Length; ++i) {
+                if (!U8_IS_TRAIL(s8[i])) {
+                    continue;
+                }
+                status = U_ZERO_ERROR;
+                LocalUTextPointer ut8(utext_openUTF8File(NULL, fileName, &status));
+                if (!assertSuccess("open UTF-8 file", status)) {
+                    return;
+                }
+                UText *t = ut8.getAlias();
+                // Leave the buffers around index i in the state of
+                // forward or backward iteration.
+                if (pass == 0) {
+                    utext_setNativeIndex(t, 0);
+                    while (UTEXT_GETNATIVEINDEX(t) < i && UTEXT_NEXT32(t) >= 0) {}
+                } else {
+                    utext_setNativeIndex(t, u8Length);
+                    while (UTEXT_GETNATIVEINDEX(t) > i && UTEXT_PREVIOUS32(t) >= 0) {}
+                }
+                int32_t start = i;
+                U8_SET_CP_START(s8, 0, start);
+                UChar32 c, expected;
+                int32_t j = start;
+                U8_NEXT(s8, j, u8Length, expected);
+                c = utext_char32At(t, i);
+                if (c != expected) {
+                    errln("UTF-8 file (pass %d) char32At(%d)=U+%04lx instead of U+%04lx",
+                          (int)pass, (int)i, (long)c, (long)expected);
+                }
+                expected = U_SENTINEL;
+                if (start > 0) {
+                    j = start;
+                    U8_PREV(s8, 0, j, expected);
+                }
+                c = utext_previous32From(t, i);
+                if (c != expected) {
+                    errln("UTF-8 file (pass %d) previous32From(%d)=U+%04lx instead of U+%04lx",
+                          (int)pass, (int)i, (long)c, (long)expected);
+                }
+            }
+        }
+    }
+
+    // Text with supplementary code points at various positions,
+    // including straddling the power-of-two boundaries of direct access chunks.
+    // The little-endian file starts with a BOM.
+    for (int32_t le = 0; le <= 1; ++le) {
+        UnicodeString text;
+        if (le) {
+            text.append((UChar)0xfeff);
+        }
+        for (int32_t i = 0; text.length() < 0x24000; ++i) {
+            if ((text.length() & 0x3fff) == 0x3fff || (i % 1000) == 999) {
+                text.append((UChar32)(0x10000 + i));
+            } else {
+                text.append((UChar)(0x20 + i % 0x5f));
+            }
+        }
+        UnicodeString bytes16 = toUTF16Bytes(text, le);
+        if (!writeTestFile(fileName, (const char *)bytes16.getBuffer(), bytes16.length() * 2)) {
+            dataerrln("unable to write %s", fileName);
+            return;
+        }
+        status = U_ZERO_ERROR;
+        LocalUTextPointer ut16(utext_openUTF16File(NULL, fileName, &status));
+        if (!assertSuccess("open UTF-16 file", status)) {
+            return;
+        }
+        UText *t = ut16.getAlias();
+        assertEquals("UTF-16 file length", (int64_t)text.length(), utext_nativeLength(t));
+        int32_t i = 0;
+        UChar32 c;
+        while ((c = UTEXT_NEXT32(t)) >= 0) {
+            if (c != text.char32At(i)) {
+                errln("UTF-16 file (le=%d) forward: wrong code point at %d", (int)le, (int)i);
+                break;
+            }
+            i += U16_LENGTH(c);
+            if (UTEXT_GETNATIVEINDEX(t) != i) {
+                errln("UTF-16 file (le=%d) forward: wrong native index after %d", (int)le, (int)i);
+                break;
+            }
+        }
+        assertEquals("UTF-16 file forward to the end", text.length(), i);
+        while ((c = UTEXT_PREVIOUS32(t)) >= 0) {
+            i -= U16_LENGTH(c);
+            if (c != text.char32At(i) || UTEXT_GETNATIVEINDEX(t) != i) {
+                errln("UTF-16 file (le=%d) backward: wrong code point or index at %d", (int)le, (int)i);
+                break;
+            }
+        }
+        assertEquals("UTF-16 file backward to the start", 0, i);
+        for (i = 0x3ffc; i < text.length(); i += 0x4000) {
+            UChar buffer[8];
+            status = U_ZERO_ERROR;
+            int32_t length = utext_extract(t, i, i + 6, buffer, UPRV_LENGTHOF(buffer), &status);
+            assertSuccess("UTF-16 file extract", status);
+            int32_t start = text.getChar32Start(i);
+            int32_t limit = text.getChar32Limit(i + 6);
+            if (UnicodeString(buffer, length) != text.tempSubString(start, limit - start)) {
+                errln("UTF-16 file (le=%d) wrong extract at %d", (int)le, (int)i);
+            }
+        }
+    }
+    remove(fileName);
+}
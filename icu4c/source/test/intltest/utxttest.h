@@ -39,6 +39,7 @@ class UTextTest : public IntlTest {
     void Ticket10983();
     void Ticket12130();
     void Ticket13344();
+    void FileTextTest();
 
 private:
     struct m {                              // Map between native indices & code points.
@@ -59,6 +59,9 @@
     "GB2312 From Unicode",      ["$p1,TestICU_GB2312_FromUnicode",      "$p2,TestICU_GB2312_FromUnicode" ],
     "GB2312 To Unicode",        ["$p1,TestICU_GB2312_ToUnicode",        "$p2,TestICU_GB2312_ToUnicode" ],
     ####
+    "GB18030 From Unicode",     ["$p1,TestICU_GB18030_FromUnicode",     "$p2,TestICU_GB18030_FromUnicode" ],
+    "GB18030 To Unicode",       ["$p1,TestICU_GB18030_ToUnicode",       "$p2,TestICU_GB18030_ToUnicode" ],
+    ####
     "ISO2022KR From Unicode",   ["$p1,TestICU_ISO2022KR_FromUnicode",   "$p2,TestICU_ISO2022KR_FromUnicode" ],
     "ISO2022KR To Unicode",     ["$p1,TestICU_ISO2022KR_ToUnicode",     "$p2,TestICU_ISO2022KR_ToUnicode" ],
     ####
@@ -116,6 +116,13 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_GB18030_FromUnicode);
+        TESTCASE(55,TestICU_GB18030_ToUnicode);
+        TESTCASE(56,TestWinIML2_GB18030_ToUnicode);
+        TESTCASE(57,TestWinIML2_GB18030_FromUnicode);
+        TESTCASE(58,TestWinANSI_GB18030_ToUnicode);
+        TESTCASE(59,TestWinANSI_GB18030_FromUnicode);
+
         default: 
             name = ""; 
             return NULL;
@@ -546,6 +553,64 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_GB2312_ToUnicode(){
 //#################
 
 
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("gb18030",gb18030_uniSource, UPRV_LENGTHOF(gb18030_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_GB18030_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("gb18030",(char*)gb18030_encSource, UPRV_LENGTHOF(gb18030_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+
+UPerfFunction* ConverterPerformanceTest::TestWinIML2_GB18030_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("gb18030",gb18030_uniSource, UPRV_LENGTHOF(gb18030_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinIML2_GB18030_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2ToUnicodePerfFunction("gb18030",(char*)gb18030_encSource, UPRV_LENGTHOF(gb18030_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinANSI_GB18030_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIFromUnicodePerfFunction("gb18030",gb18030_uniSource, UPRV_LENGTHOF(gb18030_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinANSI_GB18030_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIToUnicodePerfFunction("gb18030",(char*)gb18030_encSource, UPRV_LENGTHOF(gb18030_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+//#################
+
+
 UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022KR_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
     ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("iso-2022-kr",iso2022kr_uniSource, UPRV_LENGTHOF(iso2022kr_uniSource), status);
@@ -551,6 +551,13 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_GB2312_ToUnicode();
     UPerfFunction* TestWinIML2_GB2312_FromUnicode();
 
+    UPerfFunction* TestICU_GB18030_ToUnicode();
+    UPerfFunction* TestICU_GB18030_FromUnicode();
+    UPerfFunction* TestWinANSI_GB18030_ToUnicode();
+    UPerfFunction* TestWinANSI_GB18030_FromUnicode();
+    UPerfFunction* TestWinIML2_GB18030_ToUnicode();
+    UPerfFunction* TestWinIML2_GB18030_FromUnicode();
+
 
     UPerfFunction* TestICU_ISO2022KR_ToUnicode();
     UPerfFunction* TestICU_ISO2022KR_FromUnicode();
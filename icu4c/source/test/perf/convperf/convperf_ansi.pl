@@ -53,6 +53,9 @@
     ####
     "GB2312 From Unicode",         ["$p,TestWinANSI_GB2312_FromUnicode"  ,  "$p,TestICU_GB2312_FromUnicode" ],
     "GB2312 To Unicode",           ["$p,TestWinANSI_GB2312_ToUnicode"    ,  "$p,TestICU_GB2312_ToUnicode" ],
+    ####
+    "GB18030 From Unicode",        ["$p,TestWinANSI_GB18030_FromUnicode"  , "$p,TestICU_GB18030_FromUnicode" ],
+    "GB18030 To Unicode",          ["$p,TestWinANSI_GB18030_ToUnicode"    , "$p,TestICU_GB18030_ToUnicode" ],
 };
 
 my $dataFiles = "";
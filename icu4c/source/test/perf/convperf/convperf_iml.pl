@@ -54,6 +54,9 @@
     "GB2312 From Unicode",         ["$p,TestWinIML2_GB2312_FromUnicode"  ,  "$p,TestICU_GB2312_FromUnicode" ],
     "GB2312 To Unicode",           ["$p,TestWinIML2_GB2312_ToUnicode"    ,  "$p,TestICU_GB2312_ToUnicode" ],
     ####
+    "GB18030 From Unicode",        ["$p,TestWinIML2_GB18030_FromUnicode"  , "$p,TestICU_GB18030_FromUnicode" ],
+    "GB18030 To Unicode",          ["$p,TestWinIML2_GB18030_ToUnicode"    , "$p,TestICU_GB18030_ToUnicode" ],
+    ####
     "ISO2022KR From Unicode",      ["$p,TestWinIML2_ISO2022KR_FromUnicode",  "$p,TestICU_ISO2022KR_FromUnicode" ],
     "ISO2022KR To Unicode",        ["$p,TestWinIML2_ISO2022KR_ToUnicode"  ,  "$p,TestICU_ISO2022KR_ToUnicode" ],
     ####
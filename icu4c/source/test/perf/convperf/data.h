@@ -924,6 +924,266 @@ unsigned char gb2312_encSmSource[]={
         0x82,0x6C,0x82,0x6D,0x82,0x6E,0x82,0x6F,0x82,0x70,0x82,0x71,0x82,0x72,0x82,0x73,0x82,0x74,0x82,0x75
 };
 
+/*
+ * GB 18030 text with much four-byte content: Chinese mixed with names from
+ * CJK Extension B, and Tibetan, Mongolian and Hangul passages.
+ */
+unsigned char gb18030_encSource[]={
+    0x95,0x35,0x96,0x36,0x98,0x35,0xD7,0x36,0x96,0x36,0xD3,0x37,0x3B,0x20,0x98,0x35,0xCE,0x33,0x95,0x33,
+    0xC9,0x36,0x81,0x32,0xF0,0x39,0x81,0x32,0xF0,0x38,0x81,0x32,0xF1,0x37,0x81,0x32,0xF1,0x30,0x81,0x32,
+    0xF2,0x39,0x81,0x32,0xF1,0x33,0x81,0x32,0xEF,0x37,0x81,0x32,0xF0,0x34,0x81,0x32,0xEF,0x30,0x81,0x32,
+    0xEF,0x33,0x81,0x32,0xF2,0x33,0x81,0x32,0xF1,0x32,0x95,0x34,0xD8,0x32,0x97,0x39,0xDF,0x36,0x95,0x33,
+    0xDA,0x31,0x96,0x33,0xEB,0x34,0x98,0x33,0xEA,0x30,0x97,0x37,0xAE,0x34,0x98,0x31,0xD6,0x36,0x95,0x32,
+    0x99,0x36,0x95,0x36,0xF6,0x30,0x96,0x30,0x9D,0x31,0x96,0x34,0xDC,0x39,0x96,0x31,0xF1,0x31,0x96,0x31,
+    0xC2,0x34,0x97,0x30,0xBA,0x38,0x82,0x38,0xCB,0x35,0x83,0x35,0xF0,0x34,0x83,0x34,0xD5,0x37,0x81,0x32,
+    0xF3,0x30,0x81,0x32,0xF0,0x35,0x81,0x32,0xEF,0x31,0x81,0x32,0xEF,0x38,0x81,0x32,0xF1,0x37,0x81,0x32,
+    0xF1,0x39,0x81,0x32,0xF1,0x33,0x81,0x32,0xF1,0x33,0x81,0x32,0xF0,0x34,0x81,0x32,0xF1,0x32,0x81,0x32,
+    0xF1,0x32,0x95,0x39,0xBA,0x35,0x95,0x39,0xC9,0x37,0x95,0x33,0xFB,0x37,0xB2,0xBD,0xBC,0xD3,0xC7,0xBF,
+    0xCA,0xFD,0xBE,0xDD,0xB9,0xDC,0x81,0x32,0xEF,0x30,0x81,0x32,0xF2,0x38,0x81,0x32,0xF0,0x35,0x81,0x32,
+    0xEF,0x31,0x81,0x32,0xF1,0x34,0x81,0x32,0xF2,0x30,0x81,0x32,0xF1,0x30,0x81,0x32,0xF1,0x34,0x81,0x32,
+    0xF0,0x33,0x81,0x32,0xEF,0x32,0x81,0x34,0xD8,0x39,0x81,0x34,0xDA,0x38,0x81,0x34,0xD8,0x30,0x81,0x34,
+    0xD7,0x32,0x81,0x34,0xD6,0x35,0x81,0x34,0xDB,0x33,0x81,0x34,0xD9,0x33,0x81,0x34,0xD7,0x37,0x81,0x34,
+    0xDD,0x38,0x81,0x32,0xF0,0x33,0x81,0x32,0xEF,0x32,0x81,0x32,0xF1,0x32,0x81,0x32,0xEF,0x32,0x81,0x32,
+    0xEF,0x37,0x81,0x32,0xF1,0x33,0x81,0x32,0xF0,0x32,0x81,0x32,0xF2,0x37,0x98,0x33,0xFC,0x34,0x96,0x36,
+    0xD3,0x32,0x95,0x35,0xB3,0x39,0x97,0x35,0xFC,0x34,0x97,0x39,0xFB,0x35,0x96,0x34,0xC2,0x33,0x97,0x38,
+    0xDD,0x36,0x97,0x33,0xB3,0x31,0x98,0x33,0xC8,0x34,0x97,0x32,0x83,0x36,0x97,0x37,0xFD,0x34,0x95,0x37,
+    0xCC,0x34,0x95,0x38,0x8B,0x39,0x95,0x32,0xD4,0x32,0x98,0x30,0x93,0x31,0x98,0x30,0xD2,0x30,0x97,0x30,
+    0xD5,0x37,0xB5,0xC4,0xCD,0xA8,0xD6,0xAA,0xB8,0xF7,0xCA,0xA1,0xD7,0xD4,0x81,0x32,0xF0,0x37,0x81,0x32,
+    0xEF,0x31,0x81,0x32,0xF2,0x30,0x81,0x32,0xF0,0x34,0x81,0x32,0xF0,0x38,0x81,0x32,0xF2,0x33,0x81,0x32,
+    0xF1,0x37,0x81,0x32,0xEF,0x37,0x81,0x32,0xF2,0x34,0x81,0x32,0xEE,0x38,0x96,0x30,0xA5,0x33,0x95,0x32,
+    0xB8,0x39,0x97,0x34,0xC7,0x32,0x81,0x32,0xF2,0x37,0x81,0x32,0xF1,0x37,0x81,0x32,0xF0,0x37,0x81,0x32,
+    0xEF,0x38,0x81,0x32,0xF2,0x32,0x97,0x31,0xB7,0x39,0x96,0x35,0xE5,0x37,0x95,0x37,0xAE,0x30,0x97,0x32,
+    0x91,0x39,0x95,0x39,0xD8,0x35,0x96,0x36,0xC2,0x39,0x97,0x33,0xCD,0x30,0x98,0x31,0x85,0x38,0x98,0x33,
+    0xB0,0x39,0x81,0x32,0xEF,0x32,0x81,0x32,0xF2,0x36,0x81,0x32,0xF0,0x35,0x81,0x32,0xF0,0x30,0x81,0x32,
+    0xEF,0x34,0x81,0x32,0xF0,0x37,0x81,0x32,0xF1,0x31,0x81,0x32,0xF1,0x36,0x81,0x32,0xF1,0x31,0x81,0x32,
+    0xEE,0x39,0x81,0x32,0xF2,0x30,0x81,0x32,0xF1,0x33,0x81,0x32,0xF2,0x32,0x98,0x32,0xF1,0x38,0x97,0x31,
+    0xB6,0x38,0x97,0x33,0xE4,0x39,0x95,0x36,0xBE,0x38,0x97,0x36,0xFC,0x30,0x81,0x34,0xD9,0x33,0x81,0x34,
+    0xDA,0x34,0x81,0x34,0xD9,0x36,0x81,0x34,0xD7,0x39,0x81,0x34,0xDE,0x35,0x81,0x34,0xDA,0x39,0x81,0x32,
+    0xF2,0x30,0x81,0x32,0xF0,0x36,0x81,0x32,0xEF,0x33,0x81,0x32,0xEE,0x39,0x81,0x32,0xF3,0x30,0x81,0x32,
+    0xF2,0x35,0x81,0x32,0xF2,0x36,0xA1,0xA3,0x98,0x32,0xA8,0x37,0x98,0x30,0x81,0x32,0x96,0x36,0x97,0x34,
+    0x96,0x39,0xEF,0x34,0x97,0x38,0xCE,0x35,0x97,0x36,0xF5,0x38,0xB8,0xF7,0xCA,0xA1,0xD7,0xD4,0xD6,0xCE,
+    0xC7,0xF8,0xD6,0xB1,0xB9,0xA4,0xD7,0xF7,0xB5,0xC4,0xCD,0xA8,0xD6,0xAA,0xB8,0xF7,0x98,0x33,0xFE,0x38,
+    0x96,0x37,0xA8,0x32,0x95,0x37,0xEE,0x38,0x97,0x33,0xC9,0x34,0x97,0x38,0xBB,0x38,0x83,0x35,0xBD,0x33,
+    0x83,0x30,0xE2,0x31,0x83,0x31,0xD0,0x32,0x82,0x38,0x83,0x30,0x83,0x35,0xCF,0x32,0x83,0x31,0x88,0x31,
+    0x82,0x38,0x98,0x36,0x98,0x33,0xEB,0x32,0x97,0x39,0x81,0x30,0x97,0x39,0xD6,0x32,0x97,0x36,0xEB,0x34,
+    0x97,0x39,0xF2,0x33,0x96,0x33,0xED,0x30,0x81,0x34,0xD7,0x30,0x81,0x34,0xD7,0x36,0x81,0x34,0xD8,0x30,
+    0x81,0x34,0xDA,0x36,0x81,0x34,0xDE,0x37,0x81,0x34,0xD7,0x30,0x81,0x34,0xDC,0x35,0x81,0x34,0xDB,0x32,
+    0x81,0x34,0xD8,0x34,0x81,0x34,0xDB,0x38,0xD6,0xCE,0xC7,0xF8,0xD6,0xB1,0xCF,0xBD,0xCA,0xD0,0xC8,0xCB,
+    0x96,0x37,0x85,0x37,0x98,0x31,0xFA,0x38,0x96,0x39,0xE6,0x37,0x97,0x37,0xE1,0x30,0x96,0x33,0xB2,0x35,
+    0x95,0x38,0xD2,0x37,0x82,0x39,0xD4,0x31,0x83,0x36,0x89,0x35,0x82,0x39,0xE4,0x35,0x82,0x38,0xBE,0x38,
+    0x83,0x34,0xE7,0x37,0x83,0x31,0xC3,0x31,0x81,0x34,0xDC,0x32,0x81,0x34,0xD8,0x36,0x81,0x34,0xD9,0x35,
+    0x81,0x34,0xD9,0x31,0x81,0x34,0xD6,0x37,0x81,0x34,0xDE,0x31,0x81,0x34,0xD6,0x32,0x81,0x34,0xD8,0x38,
+    0x81,0x34,0xD7,0x36,0x81,0x34,0xD9,0x30,0x81,0x34,0xD8,0x35,0x81,0x32,0xF0,0x34,0x81,0x32,0xF0,0x37,
+    0x81,0x32,0xF0,0x39,0x81,0x32,0xF1,0x38,0xC7,0xF8,0xD6,0xB1,0xCF,0xBD,0xCA,0xD0,0xC8,0xCB,0xC3,0xF1,
+    0xC0,0xED,0xB9,0xA4,0xD7,0xF7,0xB5,0xC4,0xCD,0xA8,0xD6,0xAA,0x81,0x32,0xEF,0x32,0x81,0x32,0xF2,0x35,
+    0x81,0x32,0xF0,0x34,0x81,0x32,0xEF,0x32,0x81,0x32,0xF0,0x31,0x81,0x32,0xF0,0x31,0x81,0x32,0xF1,0x38,
+    0x81,0x32,0xF2,0x38,0x81,0x32,0xEE,0x38,0x81,0x32,0xF2,0x37,0x96,0x36,0xE6,0x36,0x95,0x34,0x86,0x39,
+    0x96,0x36,0x8B,0x39,0x98,0x35,0xEC,0x35,0x97,0x36,0xC3,0x38,0x81,0x32,0xF0,0x33,0x81,0x32,0xF2,0x36,
+    0x81,0x32,0xEE,0x38,0x81,0x32,0xF2,0x33,0x81,0x32,0xF2,0x37,0x81,0x32,0xF0,0x33,0x81,0x32,0xF2,0x39,
+    0x81,0x32,0xEF,0x39,0x81,0x32,0xF0,0x38,0x81,0x32,0xF2,0x35,0x81,0x32,0xEF,0x33,0x81,0x32,0xF1,0x30,
+    0x81,0x32,0xEF,0x38,0x98,0x34,0x8C,0x33,0x95,0x33,0x84,0x32,0x96,0x31,0xBD,0x38,0x95,0x38,0x84,0x39,
+    0x95,0x38,0xFD,0x31,0xB9,0xDC,0xC0,0xED,0xB9,0xA4,0xD7,0xF7,0xB5,0xC4,0xCD,0xA8,0x83,0x33,0x96,0x36,
+    0x83,0x33,0xED,0x30,0x83,0x35,0xC9,0x31,0x83,0x32,0xA6,0x39,0x83,0x33,0xB3,0x33,0x83,0x34,0x8A,0x35,
+    0x81,0x34,0xDD,0x32,0x81,0x34,0xDD,0x31,0x81,0x34,0xDE,0x37,0x81,0x34,0xD8,0x35,0x81,0x34,0xDE,0x31,
+    0x81,0x34,0xD8,0x39,0x81,0x34,0xDD,0x33,0x81,0x34,0xDC,0x37,0x81,0x34,0xD6,0x36,0x81,0x34,0xDB,0x39,
+    0x81,0x34,0xDE,0x35,0x96,0x35,0xC4,0x35,0x96,0x31,0xEC,0x36,0x95,0x37,0xEE,0x32,0x98,0x35,0xE5,0x34,
+    0x95,0x32,0xE0,0x34,0x81,0x32,0xF2,0x36,0x81,0x32,0xEF,0x35,0x81,0x32,0xF1,0x33,0x81,0x32,0xF1,0x34,
+    0x97,0x36,0xD4,0x35,0x96,0x39,0x92,0x31,0xCA,0xFD,0xBE,0xDD,0xB9,0xDC,0xC0,0xED,0xB9,0xA4,0xD7,0xF7,
+    0x81,0x32,0xF1,0x39,0x81,0x32,0xEF,0x31,0x81,0x32,0xF2,0x38,0x81,0x32,0xF3,0x30,0xCA,0xFD,0xBE,0xDD,
+    0xB9,0xDC,0xC0,0xED,0xB9,0xA4,0xD7,0xF7,0x96,0x34,0xA5,0x37,0x97,0x39,0xF6,0x36,0x96,0x36,0xAF,0x36,
+    0x97,0x31,0x98,0x34,0x96,0x38,0xA0,0x38,0x98,0x31,0x84,0x34,0x95,0x38,0x81,0x37,0x98,0x30,0xEF,0x35,
+    0x96,0x37,0xE7,0x30,0x95,0x32,0xE8,0x31,0x97,0x34,0xE9,0x37,0x97,0x36,0xAA,0x33,0x97,0x32,0xD0,0x33,
+    0x98,0x32,0xE2,0x37,0x95,0x36,0xCB,0x34,0x98,0x35,0xD5,0x35,0x95,0x38,0xE0,0x39,0x96,0x30,0x90,0x32,
+    0x83,0x36,0x89,0x38,0x83,0x35,0xCF,0x39,0x83,0x36,0x9C,0x30,0x83,0x33,0x88,0x34,0x82,0x38,0xCC,0x35,
+    0x82,0x39,0x9F,0x36,0x83,0x31,0xD7,0x32,0x83,0x35,0xCC,0x38,0x97,0x39,0xB7,0x30,0x95,0x39,0xA2,0x39,
+    0x96,0x31,0x8E,0x37,0x83,0x35,0xCC,0x32,0x83,0x31,0x96,0x30,0x83,0x36,0xAF,0x37,0x83,0x35,0xD5,0x33,
+    0x83,0x33,0x82,0x38,0x83,0x32,0xA3,0x34,0x82,0x38,0x91,0x39,0x32,0x30,0x31,0x38,0xC4,0xEA,0xCA,0xA1,
+    0xD7,0xD4,0xD6,0xCE,0xC7,0xF8,0xD6,0xB1,0xCF,0xBD,0xB8,0xF7,0xCA,0xA1,0xD7,0xD4,0xD6,0xCE,0xC7,0xF8,
+    0xD6,0xB1,0x95,0x35,0x8E,0x36,0x96,0x37,0xAC,0x35,0x97,0x32,0xDF,0x37,0x98,0x32,0xF1,0x33,0x83,0x35,
+    0xCC,0x37,0x83,0x33,0x90,0x38,0x82,0x38,0xE0,0x34,0x83,0x30,0xB3,0x31,0x83,0x36,0x96,0x35,0x83,0x35,
+    0x8A,0x37,0x83,0x36,0x99,0x32,0x83,0x30,0xC5,0x37,0x81,0x34,0xDB,0x39,0x81,0x34,0xDB,0x32,0x81,0x34,
+    0xDA,0x39,0x81,0x34,0xDC,0x37,0x81,0x34,0xDE,0x37,0x81,0x34,0xD6,0x32,0x81,0x34,0xDD,0x37,0x81,0x34,
+    0xD6,0x39,0x81,0x34,0xDD,0x35,0x98,0x33,0x8B,0x30,0x98,0x35,0xB5,0x34,0x97,0x35,0xC7,0x32,0x98,0x33,
+    0xF8,0x39,0x97,0x30,0xC9,0x31,0x95,0x37,0xF0,0x36,0xD4,0xBA,0xB9,0xD8,0xD3,0xDA,0xBD,0xF8,0xD2,0xBB,
+    0xB2,0xBD,0x81,0x32,0xF1,0x30,0x81,0x32,0xF0,0x31,0x81,0x32,0xF1,0x37,0x81,0x32,0xEF,0x36,0x81,0x32,
+    0xF2,0x35,0x97,0x33,0x83,0x36,0x95,0x37,0xA1,0x37,0x96,0x39,0xB3,0x37,0x97,0x32,0xC9,0x34,0x97,0x33,
+    0xE3,0x33,0x97,0x31,0xBC,0x31,0x96,0x36,0xED,0x37,0xD6,0xB1,0xCF,0xBD,0xCA,0xD0,0xC8,0xCB,0xC3,0xF1,
+    0xD5,0xFE,0x81,0x34,0xDA,0x38,0x81,0x34,0xDE,0x37,0x81,0x34,0xD7,0x38,0x81,0x34,0xD7,0x37,0x81,0x34,
+    0xD8,0x35,0x81,0x34,0xD9,0x39,0xD6,0xD0,0xBB,0xAA,0xC8,0xCB,0xC3,0xF1,0xB9,0xB2,0xBA,0xCD,0x95,0x38,
+    0xE1,0x34,0x96,0x39,0xA3,0x39,0x95,0x33,0xD1,0x38,0x98,0x30,0x83,0x39,0x96,0x35,0xB7,0x39,0x97,0x34,
+    0xFB,0x31,0x81,0x32,0xF1,0x36,0x81,0x32,0xF1,0x37,0x81,0x32,0xEF,0x37,0x81,0x32,0xF1,0x39,0x81,0x32,
+    0xEE,0x39,0x81,0x32,0xF2,0x31,0x81,0x34,0xD6,0x30,0x81,0x34,0xD7,0x39,0x81,0x34,0xD8,0x30,0x81,0x34,
+    0xDE,0x31,0x81,0x34,0xD7,0x38,0x81,0x34,0xD9,0x38,0x81,0x34,0xDD,0x35,0x81,0x34,0xD8,0x38,0x81,0x34,
+    0xDC,0x36,0x81,0x34,0xD7,0x33,0x81,0x32,0xF1,0x32,0x81,0x32,0xF2,0x37,0x81,0x32,0xF1,0x35,0x81,0x32,
+    0xF1,0x35,0x81,0x32,0xEF,0x34,0x81,0x32,0xF1,0x39,0x81,0x32,0xF1,0x39,0x81,0x32,0xF2,0x31,0x81,0x32,
+    0xF0,0x32,0x81,0x32,0xEF,0x37,0x81,0x32,0xF1,0x31,0x81,0x32,0xF1,0x36,0x81,0x32,0xF1,0x36,0x81,0x32,
+    0xF1,0x30,0x81,0x32,0xEF,0x37,0x81,0x32,0xF0,0x33,0x81,0x32,0xEE,0x38,0x81,0x32,0xF1,0x31,0x81,0x32,
+    0xF3,0x30,0x81,0x32,0xEE,0x38,0x81,0x32,0xEF,0x37,0x81,0x32,0xF1,0x36,0x81,0x34,0xDC,0x30,0x81,0x34,
+    0xDC,0x30,0x81,0x34,0xDD,0x39,0x81,0x34,0xDA,0x30,0x81,0x34,0xDB,0x39,0x81,0x34,0xD9,0x32,0x81,0x34,
+    0xDD,0x34,0x81,0x34,0xD9,0x34,0x81,0x34,0xDC,0x35,0x81,0x34,0xD8,0x33,0x81,0x34,0xDD,0x30,0x81,0x34,
+    0xDB,0x38,0xB9,0xFA,0xCE,0xF1,0xD4,0xBA,0xB9,0xD8,0xD3,0xDA,0xBD,0xF8,0x83,0x35,0xA4,0x32,0x83,0x34,
+    0xCA,0x30,0x83,0x33,0x8F,0x33,0x83,0x36,0x9E,0x36,0x83,0x35,0xE4,0x37,0x82,0x38,0xE1,0x32,0x83,0x34,
+    0xE2,0x38,0x83,0x30,0xB8,0x33,0x83,0x33,0xE6,0x30,0x83,0x36,0xB1,0x36,0x81,0x32,0xEF,0x38,0x81,0x32,
+    0xEF,0x30,0x81,0x32,0xF0,0x33,0x81,0x32,0xF2,0x32,0x81,0x32,0xEE,0x39,0x81,0x32,0xF0,0x39,0x81,0x32,
+    0xF1,0x36,0x82,0x38,0xEA,0x32,0x83,0x31,0xEC,0x38,0x83,0x34,0xBF,0x33,0x95,0x36,0xF2,0x30,0x98,0x34,
+    0xF8,0x32,0x95,0x36,0xB6,0x33,0x95,0x34,0xE5,0x38,0x97,0x37,0xA2,0x35,0x81,0x34,0xD9,0x34,0x81,0x34,
+    0xD7,0x36,0x81,0x34,0xDB,0x36,0x81,0x34,0xD7,0x36,0x97,0x31,0xE7,0x35,0x96,0x38,0xE3,0x30,0x81,0x32,
+    0xF2,0x30,0x81,0x32,0xF0,0x39,0x81,0x32,0xF2,0x33,0x81,0x32,0xEF,0x39,0x81,0x34,0xD6,0x37,0x81,0x34,
+    0xD9,0x30,0x81,0x34,0xD6,0x39,0x81,0x34,0xDE,0x37,0x81,0x34,0xDC,0x36,0x81,0x34,0xDA,0x32,0x81,0x34,
+    0xD6,0x39,0x81,0x34,0xD8,0x30,0x81,0x34,0xD7,0x35,0x81,0x34,0xDA,0x34,0x81,0x34,0xD7,0x37,0x81,0x34,
+    0xD6,0x35,0x97,0x31,0xC8,0x38,0x96,0x32,0xD6,0x34,0xC7,0xBF,0xCA,0xFD,0xBE,0xDD,0xB9,0xDC,0xC0,0xED,
+    0xB9,0xA4,0x81,0x32,0xF1,0x38,0x81,0x32,0xF3,0x30,0x81,0x32,0xF0,0x39,0x81,0x32,0xF1,0x35,0x81,0x32,
+    0xF2,0x32,0x81,0x32,0xF0,0x33,0x81,0x32,0xEF,0x31,0x81,0x32,0xEF,0x31,0x81,0x32,0xEF,0x34,0x81,0x32,
+    0xF0,0x37,0x98,0x34,0xB8,0x31,0x97,0x38,0xCC,0x36,0x95,0x37,0xE3,0x38,0x98,0x33,0x8F,0x34,0x97,0x34,
+    0xA5,0x30,0x81,0x34,0xDC,0x39,0x81,0x34,0xDE,0x31,0x81,0x34,0xD8,0x38,0x81,0x34,0xDD,0x31,0x81,0x34,
+    0xD7,0x30,0x81,0x34,0xDC,0x31,0x81,0x34,0xDB,0x31,0x81,0x34,0xDD,0x38,0x98,0x30,0xC6,0x39,0x96,0x30,
+    0xAE,0x38,0x96,0x30,0xBB,0x37,0x97,0x33,0xC8,0x32,0x97,0x35,0x8D,0x35,0x95,0x33,0xE8,0x32,0x81,0x34,
+    0xDE,0x33,0x81,0x34,0xDD,0x30,0x81,0x34,0xD8,0x39,0x81,0x34,0xD8,0x36,0x82,0x38,0xE9,0x33,0x83,0x32,
+    0xDF,0x30,0x83,0x33,0xAB,0x33,0x0A,0xB9,0xFA,0xB9,0xFA,0xCE,0xF1,0xD4,0xBA,0xB9,0xD8,0xD3,0xDA,0x81,
+    0x34,0xDC,0x35,0x81,0x34,0xDC,0x33,0x81,0x34,0xD9,0x34,0x81,0x34,0xD9,0x38,0x81,0x34,0xDC,0x35,0x81,
+    0x34,0xD6,0x35,0x81,0x34,0xDC,0x31,0x81,0x34,0xD9,0x39,0x81,0x34,0xD7,0x30,0x81,0x32,0xEE,0x38,0x81,
+    0x32,0xF2,0x34,0x81,0x32,0xF2,0x33,0x81,0x32,0xF0,0x37,0x81,0x32,0xF3,0x30,0x81,0x32,0xEF,0x34,0x81,
+    0x32,0xF0,0x39,0x81,0x32,0xEF,0x33,0x81,0x34,0xD8,0x36,0x81,0x34,0xDB,0x37,0x81,0x34,0xD7,0x39,0x81,
+    0x34,0xDE,0x37,0x81,0x34,0xD9,0x32,0x81,0x34,0xD9,0x39,0x81,0x34,0xDD,0x31,0x81,0x34,0xDB,0x31,0x81,
+    0x34,0xD8,0x33,0x81,0x34,0xD8,0x39,0x81,0x34,0xDD,0x33,0x95,0x33,0x90,0x38,0x96,0x39,0xD7,0x33,0x83,
+    0x30,0xEA,0x36,0x83,0x35,0xCA,0x31,0x83,0x34,0xD6,0x30,0x83,0x30,0xB2,0x36,0xD3,0xDA,0xBD,0xF8,0xD2,
+    0xBB,0xB2,0xBD,0xBC,0xD3,0xC7,0xBF,0xD6,0xCE,0xC7,0xF8,0xD6,0xB1,0xCF,0xBD,0xCA,0xD0,0xC8,0xCB,0x81,
+    0x32,0xF2,0x32,0x81,0x32,0xEF,0x35,0x81,0x32,0xF0,0x33,0x81,0x32,0xF1,0x37,0x81,0x32,0xF1,0x38,0x81,
+    0x32,0xEF,0x31,0x81,0x32,0xF2,0x39,0x81,0x32,0xF1,0x37,0x81,0x32,0xEF,0x33,0x81,0x32,0xF2,0x31,0xB8,
+    0xF7,0xCA,0xA1,0xD7,0xD4,0xD6,0xCE,0xC7,0xF8,0xD6,0xB1,0x81,0x32,0xF2,0x32,0x81,0x32,0xEF,0x37,0x81,
+    0x32,0xF2,0x33,0x81,0x32,0xF2,0x31,0x81,0x32,0xF0,0x37,0x81,0x32,0xF1,0x32,0x81,0x32,0xF1,0x39,0x82,
+    0x38,0x8A,0x34,0x82,0x38,0xFA,0x34,0x83,0x31,0x9F,0x30,0x83,0x30,0xA3,0x37,0x83,0x32,0xA5,0x36,0x81,
+    0x32,0xF2,0x34,0x81,0x32,0xEF,0x31,0x81,0x32,0xF1,0x39,0x81,0x32,0xF0,0x30,0x81,0x32,0xF1,0x38,0x81,
+    0x32,0xF2,0x31,0x81,0x32,0xF0,0x31,0x81,0x32,0xF2,0x30,0x81,0x32,0xEF,0x35,0x81,0x32,0xF0,0x39,0x81,
+    0x32,0xF0,0x31,0x81,0x32,0xF2,0x37,0x81,0x32,0xEF,0x31,0x81,0x32,0xEF,0x37,0x81,0x32,0xEF,0x35,0x81,
+    0x32,0xF1,0x37,0x81,0x32,0xEF,0x34,0x81,0x32,0xEF,0x35,0x81,0x32,0xF1,0x36,0x81,0x32,0xF1,0x34,0xCD,
+    0xA8,0xD6,0xAA,0xB8,0xF7,0xCA,0xA1,0xD7,0xD4,0xD6,0xCE,0x97,0x34,0xC7,0x33,0x97,0x33,0xC5,0x33,0x96,
+    0x39,0x9B,0x39,0x97,0x31,0xBB,0x31,0x96,0x33,0xA0,0x32,0x96,0x34,0x97,0x32,0x83,0x32,0xA9,0x38,0x83,
+    0x34,0xC1,0x36,0x82,0x38,0x94,0x38,0x83,0x34,0xD4,0x36,0x83,0x35,0xD3,0x31,0x97,0x36,0xC1,0x39,0x95,
+    0x39,0xAB,0x36,0x98,0x33,0x92,0x32,0x96,0x39,0xE4,0x32,0x96,0x39,0x90,0x31,0xB2,0xBD,0xBC,0xD3,0xC7,
+    0xBF,0xCA,0xFD,0xBE,0xDD,0xB9,0xDC,0x81,0x34,0xDC,0x31,0x81,0x34,0xDA,0x36,0x81,0x34,0xD9,0x38,0x81,
+    0x34,0xDC,0x35,0x81,0x34,0xDE,0x36,0x81,0x34,0xD8,0x35,0x81,0x34,0xD9,0x31,0x81,0x34,0xDE,0x32,0x81,
+    0x34,0xDA,0x37,0x81,0x34,0xDC,0x30,0x81,0x34,0xDE,0x32,0x81,0x32,0xEF,0x38,0x81,0x32,0xF1,0x31,0x81,
+    0x32,0xF1,0x39,0x81,0x32,0xEE,0x38,0x81,0x32,0xEE,0x38,0x81,0x32,0xEE,0x38,0x81,0x32,0xF2,0x37,0x81,
+    0x32,0xF0,0x35,0x81,0x32,0xF0,0x37,0x81,0x32,0xF2,0x39,0x81,0x34,0xDE,0x32,0x81,0x34,0xD8,0x32,0x81,
+    0x34,0xDB,0x34,0x81,0x34,0xD8,0x38,0x81,0x34,0xDB,0x32,0x81,0x34,0xD8,0x39,0x81,0x34,0xDD,0x39,0x81,
+    0x32,0xF0,0x32,0x81,0x32,0xEE,0x39,0x81,0x32,0xF2,0x39,0x81,0x32,0xF1,0x30,0x81,0x32,0xF0,0x31,0x81,
+    0x32,0xF2,0x32,0x81,0x32,0xF0,0x36,0x81,0x32,0xEF,0x34,0x97,0x33,0xA8,0x33,0x96,0x33,0xE4,0x39,0x97,
+    0x39,0xE3,0x39,0x97,0x33,0xE3,0x31,0x95,0x38,0xA4,0x34,0x0A,0xA1,0xA3,0x81,0x34,0xDD,0x37,0x81,0x34,
+    0xD6,0x30,0x81,0x34,0xDC,0x34,0x81,0x34,0xD7,0x31,0x81,0x34,0xDB,0x31,0x81,0x34,0xDA,0x30,0x81,0x34,
+    0xD9,0x37,0x81,0x34,0xDA,0x38,0x82,0x39,0xE8,0x33,0x83,0x31,0xF8,0x30,0x83,0x31,0xF6,0x34,0x82,0x38,
+    0xB3,0x39,0x83,0x34,0xE9,0x33,0x83,0x32,0x84,0x38,0x83,0x31,0xB4,0x38,0x83,0x33,0xDE,0x35,0x96,0x37,
+    0xEB,0x39,0x98,0x30,0xEE,0x30,0x98,0x35,0xF2,0x35,0x96,0x32,0xF5,0x30,0xC7,0xBF,0xCA,0xFD,0xBE,0xDD,
+    0xB9,0xDC,0xC0,0xED,0xB9,0xA4,0x81,0x34,0xDA,0x31,0x81,0x34,0xDA,0x37,0x81,0x34,0xD6,0x38,0x81,0x34,
+    0xDB,0x39,0x81,0x34,0xDB,0x33,0x81,0x32,0xF2,0x33,0x81,0x32,0xEF,0x34,0x81,0x32,0xF0,0x32,0x81,0x32,
+    0xF0,0x35,0x81,0x32,0xF1,0x38,0x81,0x32,0xF2,0x31,0x81,0x32,0xEF,0x31,0x81,0x32,0xF0,0x32,0x81,0x32,
+    0xEF,0x30,0x81,0x32,0xF1,0x32,0x81,0x32,0xF3,0x30,0x81,0x32,0xF2,0x38,0x81,0x32,0xF1,0x33,0x81,0x32,
+    0xF0,0x33,0x81,0x32,0xF2,0x38,0x81,0x32,0xF2,0x34,0x81,0x32,0xF1,0x33
+};
+WCHAR gb18030_uniSource[]={
+    0xD843,0xDF8C,0xD869,0xDDBE,0xD852,0xDC13,0x003B,0x0020,0xD869,0xDD61,
+    0xD841,0xDFB2,0x0F55,0x0F54,0x0F5D,0x0F56,0x0F69,0x0F59,0x0F49,0x0F50,
+    0x0F42,0x0F45,0x0F63,0x0F58,0xD843,0xDD30,0xD862,0xDC86,0xD842,0xDC57,
+    0xD84E,0xDE3C,0xD867,0xDC9E,0xD85F,0xDCC2,0xD864,0xDE04,0xD840,0xDCE6,
+    0xD846,0xDC32,0xD84A,0xDC69,0xD84F,0xDE97,0xD84C,0xDC9D,0xD84B,0xDECA,
+    0xD856,0xDECA,0xB0C4,0xD4A9,0xCEB2,0x0F6A,0x0F51,0x0F43,0x0F4A,0x0F5D,
+    0x0F5F,0x0F59,0x0F59,0x0F50,0x0F58,0x0F58,0xD849,0xDCA3,0xD849,0xDD3B,
+    0xD842,0xDDA7,0x6B65,0x52A0,0x5F3A,0x6570,0x636E,0x7BA1,0x0F42,0x0F68,
+    0x0F51,0x0F43,0x0F5A,0x0F60,0x0F56,0x0F5A,0x0F4F,0x0F44,0x183D,0x1850,
+    0x1834,0x182C,0x1825,0x1855,0x1841,0x1831,0x186E,0x0F4F,0x0F44,0x0F58,
+    0x0F44,0x0F49,0x0F59,0x0F4E,0x0F67,0xD867,0xDD56,0xD852,0xDC0E,0xD844,
+    0xDCB1,0xD85D,0xDDF6,0xD862,0xDD9D,0xD84F,0xDD8D,0xD860,0xDF86,0xD85A,
+    0xDD41,0xD866,0xDF4E,0xD858,0xDE7A,0xD85F,0xDFD8,0xD846,0xDF7E,0xD847,
+    0xDDE5,0xD840,0xDF30,0xD862,0xDE75,0xD863,0xDCEA,0xD856,0xDFD7,0x7684,
+    0x901A,0x77E5,0x5404,0x7701,0x81EA,0x0F53,0x0F43,0x0F60,0x0F50,0x0F54,
+    0x0F63,0x0F5D,0x0F49,0x0F64,0x0F40,0xD84A,0xDCBB,0xD840,0xDE1F,0xD85B,
+    0xDEF6,0x0F67,0x0F5D,0x0F53,0x0F4A,0x0F62,0xD857,0xDF99,0xD850,0xDFDB,
+    0xD846,0xDE4E,0xD858,0xDF09,0xD849,0xDDCF,0xD851,0xDF6B,0xD85A,0xDE44,
+    0xD863,0xDEDC,0xD866,0xDE63,0x0F44,0x0F66,0x0F51,0x0F4C,0x0F46,0x0F53,
+    0x0F57,0x0F5C,0x0F57,0x0F41,0x0F60,0x0F59,0x0F62,0xD866,0xDC00,0xD857,
+    0xDF8E,0xD85A,0xDF33,0xD845,0xDE0A,0xD85E,0xDEDE,0x1841,0x184C,0x1844,
+    0x1833,0x1875,0x1851,0x0F60,0x0F52,0x0F45,0x0F41,0x0F6A,0x0F65,0x0F66,
+    0x3002,0xD865,0xDD25,0xD862,0xDDC2,0xD851,0xDDB8,0xD855,0xDFEC,0xD860,
+    0xDEEF,0xD85E,0xDEA0,0x5404,0x7701,0x81EA,0x6CBB,0x533A,0x76F4,0x5DE5,
+    0x4F5C,0x7684,0x901A,0x77E5,0x5404,0xD867,0xDD6E,0xD852,0xDF4C,0xD847,
+    0xDCD6,0xD85A,0xDE20,0xD860,0xDE34,0xD2AA,0xBB7E,0xBFB7,0xADEF,0xD35D,
+    0xBCE6,0xAEC7,0xD867,0xDCAA,0xD861,0xDCD4,0xD862,0xDC28,0xD85E,0xDE38,
+    0xD862,0xDD41,0xD84E,0xDE4C,0x182A,0x1830,0x1834,0x184E,0x1877,0x182A,
+    0x1861,0x1854,0x1838,0x185A,0x6CBB,0x533A,0x76F4,0x8F96,0x5E02,0x4EBA,
+    0xD852,0xDDF3,0xD864,0xDF6E,0xD855,0xDF95,0xD85F,0xDEBC,0xD84E,0xDC03,
+    0xD848,0xDCA9,0xB606,0xD590,0xB6AA,0xB045,0xCF66,0xBF34,0x185E,0x183A,
+    0x1843,0x183F,0x1827,0x1871,0x1822,0x183C,0x1830,0x183E,0x1839,0x0F50,
+    0x0F53,0x0F55,0x0F5E,0x533A,0x76F4,0x8F96,0x5E02,0x4EBA,0x6C11,0x7406,
+    0x5DE5,0x4F5C,0x7684,0x901A,0x77E5,0x0F44,0x0F65,0x0F50,0x0F44,0x0F4D,
+    0x0F4D,0x0F5E,0x0F68,0x0F40,0x0F67,0xD852,0xDCD0,0xD842,0xDE03,0xD851,
+    0xDD45,0xD869,0xDE8F,0xD85E,0xDCAC,0x0F4F,0x0F66,0x0F40,0x0F63,0x0F67,
+    0x0F4F,0x0F69,0x0F4B,0x0F54,0x0F65,0x0F45,0x0F56,0x0F4A,0xD867,0xDDE1,
+    0xD841,0xDCFC,0xD84B,0xDE9C,0xD847,0xDD9F,0xD848,0xDE51,0x7BA1,0x7406,
+    0x5DE5,0x4F5C,0x7684,0x901A,0xC74F,0xCAAF,0xD320,0xC306,0xC86E,0xCBC2,
+    0x1868,0x1867,0x1877,0x1839,0x1871,0x183D,0x1869,0x1863,0x1826,0x185B,
+    0x1875,0xD850,0xDE8F,0xD84C,0xDC70,0xD847,0xDCD0,0xD869,0xDE48,0xD840,
+    0xDFAA,0x0F66,0x0F47,0x0F59,0x0F5A,0xD85E,0xDD53,0xD855,0xDC47,0x6570,
+    0x636E,0x7BA1,0x7406,0x5DE5,0x4F5C,0x0F5F,0x0F43,0x0F68,0x0F6A,0x6570,
+    0x636E,0x7BA1,0x7406,0x5DE5,0x4F5C,0xD84F,0xDC6F,0xD862,0xDD6C,0xD851,
+    0xDEAA,0xD857,0xDE5E,0xD853,0xDFEE,0xD863,0xDECE,0xD847,0xDD7F,0xD863,
+    0xDE11,0xD853,0xDDC0,0xD840,0xDFF7,0xD85C,0xDC4F,0xD85D,0xDFAD,0xD859,
+    0xDD79,0xD865,0xDF69,0xD845,0xDE88,0xD869,0xDDA9,0xD848,0xDD37,0xD849,
+    0xDFE8,0xD593,0xD364,0xD649,0xC6C1,0xB0CE,0xB3F9,0xBFFD,0xD345,0xD861,
+    0xDEF0,0xD848,0xDFB7,0xD84B,0xDCC5,0xD33F,0xBD71,0xD70E,0xD39A,0xC689,
+    0xC2E3,0xAE84,0x0032,0x0030,0x0031,0x0038,0x5E74,0x7701,0x81EA,0x6CBB,
+    0x533A,0x76F4,0x8F96,0x5404,0x7701,0x81EA,0x6CBB,0x533A,0x76F4,0xD843,
+    0xDF3C,0xD852,0xDF77,0xD859,0xDE13,0xD865,0xDFFB,0xD344,0xC715,0xB195,
+    0xB9A8,0xD612,0xD0B0,0xD62D,0xBA62,0x185B,0x1854,0x1851,0x1863,0x1877,
+    0x1822,0x186D,0x1829,0x186B,0xD866,0xDCE8,0xD869,0xDC68,0xD85C,0xDFE2,
+    0xD867,0xDD33,0xD856,0xDF59,0xD847,0xDCE8,0x9662,0x5173,0x4E8E,0x8FDB,
+    0x4E00,0x6B65,0x0F56,0x0F4D,0x0F5D,0x0F48,0x0F65,0xD859,0xDF66,0xD846,
+    0xDDD3,0xD855,0xDD97,0xD859,0xDD34,0xD85A,0xDF23,0xD857,0xDFC3,0xD852,
+    0xDD17,0x76F4,0x8F96,0x5E02,0x4EBA,0x6C11,0x653F,0x1850,0x1877,0x1832,
+    0x1831,0x1839,0x1847,0x4E2D,0x534E,0x4EBA,0x6C11,0x5171,0x548C,0xD848,
+    0xDD3C,0xD855,0xDCF9,0xD842,0xDC04,0xD862,0xDDDD,0xD850,0xDE11,0xD85C,
+    0xDCFD,0x0F5C,0x0F5D,0x0F49,0x0F5F,0x0F41,0x0F61,0x1820,0x1833,0x1834,
+    0x1871,0x1832,0x1846,0x186B,0x183C,0x1862,0x182D,0x0F58,0x0F67,0x0F5B,
+    0x0F5B,0x0F46,0x0F5F,0x0F5F,0x0F61,0x0F4E,0x0F49,0x0F57,0x0F5C,0x0F5C,
+    0x0F56,0x0F49,0x0F4F,0x0F40,0x0F57,0x0F6A,0x0F40,0x0F49,0x0F5C,0x185C,
+    0x185C,0x186F,0x1848,0x185B,0x1840,0x186A,0x1842,0x1861,0x1837,0x1866,
+    0x185A,0x56FD,0x52A1,0x9662,0x5173,0x4E8E,0x8FDB,0xD1AF,0xCE3D,0xC706,
+    0xD663,0xD434,0xB19D,0xCF35,0xB9DC,0xCA69,0xD721,0x0F4A,0x0F42,0x0F4F,
+    0x0F62,0x0F41,0x0F55,0x0F5C,0xB1F7,0xC0D5,0xCDD2,0xD846,0xDC0A,0xD868,
+    0xDE18,0xD845,0xDDB5,0xD843,0xDDB8,0xD85F,0xDC4B,0x1842,0x1830,0x1858,
+    0x1830,0xD858,0xDD75,0xD854,0xDE84,0x0F60,0x0F55,0x0F63,0x0F4B,0x1827,
+    0x183E,0x1829,0x1877,0x1862,0x184A,0x1829,0x1834,0x182F,0x184C,0x1831,
+    0x1825,0xD858,0xDC42,0xD84D,0xDC7E,0x5F3A,0x6570,0x636E,0x7BA1,0x7406,
+    0x5DE5,0x0F5E,0x0F6A,0x0F55,0x0F5B,0x0F62,0x0F4F,0x0F43,0x0F43,0x0F46,
+    0x0F53,0xD867,0xDF97,0xD860,0xDEDC,0xD847,0xDC68,0xD866,0xDD14,0xD85B,
+    0xDDA0,0x1865,0x1871,0x183C,0x1867,0x182A,0x185D,0x1853,0x186E,0xD863,
+    0xDC7B,0xD84A,0xDD1A,0xD84A,0xDD9B,0xD85A,0xDE14,0xD85C,0xDDA1,0xD842,
+    0xDCE4,0x1873,0x1866,0x183D,0x183A,0xB1EE,0xC537,0xC81E,0x000A,0x56FD,
+    0x56FD,0x52A1,0x9662,0x5173,0x4E8E,0x1861,0x185F,0x1842,0x1846,0x1861,
+    0x1825,0x185D,0x1847,0x182A,0x0F40,0x0F64,0x0F63,0x0F53,0x0F6A,0x0F46,
+    0x0F55,0x0F45,0x183A,0x1859,0x1833,0x1877,0x1840,0x1847,0x1867,0x1853,
+    0x1837,0x183D,0x1869,0xD841,0xDD7A,0xD855,0xDEFB,0xBBD3,0xD32A,0xCEB5,
+    0xB9A3,0x4E8E,0x8FDB,0x4E00,0x6B65,0x52A0,0x5F3A,0x6CBB,0x533A,0x76F4,
+    0x8F96,0x5E02,0x4EBA,0x0F62,0x0F47,0x0F4F,0x0F5D,0x0F5E,0x0F43,0x0F69,
+    0x0F5D,0x0F45,0x0F61,0x5404,0x7701,0x81EA,0x6CBB,0x533A,0x76F4,0x0F62,
+    0x0F49,0x0F63,0x0F61,0x0F53,0x0F58,0x0F5F,0xAE39,0xB299,0xBDCB,0xB90E,
+    0xC2F9,0x0F64,0x0F43,0x0F5F,0x0F4C,0x0F5E,0x0F61,0x0F4D,0x0F60,0x0F47,
+    0x0F55,0x0F4D,0x0F67,0x0F43,0x0F49,0x0F47,0x0F5D,0x0F46,0x0F47,0x0F5C,
+    0x0F5A,0x901A,0x77E5,0x5404,0x7701,0x81EA,0x6CBB,0xD85B,0xDEF7,0xD85A,
+    0xDDF7,0xD855,0xDCA9,0xD857,0xDFB9,0xD84D,0xDF4C,0xD84E,0xDFDE,0xC323,
+    0xCDE9,0xAEA1,0xCEA7,0xD384,0xD85E,0xDC99,0xD849,0xDC0E,0xD866,0xDD30,
+    0xD855,0xDF7C,0xD855,0xDC33,0x6B65,0x52A0,0x5F3A,0x6570,0x636E,0x7BA1,
+    0x185D,0x184E,0x1846,0x1861,0x1876,0x1839,0x183F,0x1872,0x184F,0x185C,
+    0x1872,0x0F4A,0x0F57,0x0F5F,0x0F40,0x0F40,0x0F40,0x0F67,0x0F51,0x0F53,
+    0x0F69,0x1872,0x1836,0x1856,0x183C,0x1854,0x183D,0x186F,0x0F4E,0x0F41,
+    0x0F69,0x0F56,0x0F4D,0x0F62,0x0F52,0x0F46,0xD85A,0xDCD5,0xD84E,0xDDFB,
+    0xD862,0xDCB1,0xD85A,0xDF21,0xD847,0xDEDA,0x000A,0x3002,0x186D,0x1820,
+    0x1860,0x182B,0x1853,0x1848,0x1845,0x1850,0xB6D0,0xC145,0xC135,0xAFD8,
+    0xCF76,0xC1B1,0xBEA5,0xCA1E,0xD853,0xDDF1,0xD863,0xDE02,0xD869,0xDECB,
+    0xD84D,0xDDB0,0x5F3A,0x6570,0x636E,0x7BA1,0x7406,0x5DE5,0x1849,0x184F,
+    0x1828,0x185B,0x1855,0x0F63,0x0F46,0x0F4E,0x0F51,0x0F5E,0x0F61,0x0F43,
+    0x0F4E,0x0F42,0x0F58,0x0F6A,0x0F68,0x0F59,0x0F4F,0x0F68,0x0F64,0x0F59
+};
+
 unsigned char latin1_encSource[]={
     0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F,0x10,0x11,0x12,0x13,0x14,
     0x15,0x16,0x17,0x18,0x19,0x1A,0x1B,0x1C,0x1D,0x1E,0x1F,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,
@@ -204,21 +204,25 @@ double measure(Operation &op, int32_t pieceLength) {
     int32_t iterations = 1;
     for (;;) {
         double seconds = op.call(iterations, pieceLength);
-        if (seconds >= 1) {
+        if (seconds >= 1 || iterations == INT32_MAX) {
             if (iterations > 1) {
-                return seconds / (iterations * pieceLength);
+                return seconds / ((double)iterations * pieceLength);
             } else {
                 // Run it once more, to avoid measuring only the warm-up.
                 return op.call(1, pieceLength) / (iterations * pieceLength);
             }
         }
+        double factor;
         if (seconds < 0.01) {
-            iterations *= 10;
+            factor = 10;
         } else if (seconds < 0.55) {
-            iterations *= 1.1 / seconds;
+            factor = 1.1 / seconds;
         } else {
-            iterations *= 2;
+            factor = 2;
         }
+        // Fast operations on short pieces can need more than INT32_MAX iterations.
+        double next = iterations * factor;
+        iterations = next < INT32_MAX ? (int32_t)next : INT32_MAX;
     }
 }
 
@@ -294,12 +298,124 @@ double NormalizeUTF8::call(int32_t iterations, int32_t pieceLength) {
         int32_t start8 = offsets[start];
         int32_t limit8 = offsets[start + pieceLength];
         icu::StringPiece piece(s + start8, limit8 - start8);
+        dest.clear();
         norm2.normalizeUTF8(0, piece, sink, nullptr, errorCode);
         start = (start + pieceLength) % limit;
     }
     return utimer_getElapsedSeconds(&startTime);
 }
 
+class IsNormalizedUTF16 : public Operation {
+public:
+    IsNormalizedUTF16(const Normalizer2 &n2, const UnicodeString &text) :
+            norm2(n2), src(text), s(src.getBuffer()) {}
+    virtual ~IsNormalizedUTF16();
+    virtual double call(int32_t iterations, int32_t pieceLength);
+
+private:
+    const Normalizer2 &norm2;
+    UnicodeString src;
+    const UChar *s;
+};
+
+IsNormalizedUTF16::~IsNormalizedUTF16() {}
+
+// Assumes all BMP characters.
+double IsNormalizedUTF16::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = src.length() - pieceLength;
+    UnicodeString piece;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t count = 0;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        piece.setTo(FALSE, s + start, pieceLength);
+        count += norm2.isNormalized(piece, errorCode);
+        start = (start + pieceLength) % limit;
+    }
+    double seconds = utimer_getElapsedSeconds(&startTime);
+    if (count != iterations) {
+        fprintf(stderr, "IsNormalizedUTF16: text is not normalized\n");
+    }
+    return seconds;
+}
+
+class IsNormalizedUTF8 : public Operation {
+public:
+    IsNormalizedUTF8(const Normalizer2 &n2, const UnicodeString &text) : norm2(n2) {
+        offsets = CommonChars::toUTF8WithOffsets(text, src, numCodePoints);
+        s = src.data();
+    }
+    virtual ~IsNormalizedUTF8();
+    virtual double call(int32_t iterations, int32_t pieceLength);
+
+private:
+    const Normalizer2 &norm2;
+    std::string src;
+    const char *s;
+    int32_t *offsets;
+    int32_t numCodePoints;
+};
+
+IsNormalizedUTF8::~IsNormalizedUTF8() {
+    delete[] offsets;
+}
+
+double IsNormalizedUTF8::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = numCodePoints - pieceLength;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t count = 0;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        int32_t start8 = offsets[start];
+        int32_t limit8 = offsets[start + pieceLength];
+        icu::StringPiece piece(s + start8, limit8 - start8);
+        count += norm2.isNormalizedUTF8(piece, errorCode);
+        start = (start + pieceLength) % limit;
+    }
+    double seconds = utimer_getElapsedSeconds(&startTime);
+    if (count != iterations) {
+        fprintf(stderr, "IsNormalizedUTF8: text is not normalized\n");
+    }
+    return seconds;
+}
+
+class QuickCheckUTF16 : public Operation {
+public:
+    QuickCheckUTF16(const Normalizer2 &n2, const UnicodeString &text) :
+            norm2(n2), src(text), s(src.getBuffer()) {}
+    virtual ~QuickCheckUTF16();
+    virtual double call(int32_t iterations, int32_t pieceLength);
+
+private:
+    const Normalizer2 &norm2;
+    UnicodeString src;
+    const UChar *s;
+};
+
+QuickCheckUTF16::~QuickCheckUTF16() {}
+
+// Assumes all BMP characters.
+double QuickCheckUTF16::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = src.length() - pieceLength;
+    UnicodeString piece;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t count = 0;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        piece.setTo(FALSE, s + start, pieceLength);
+        count += norm2.quickCheck(piece, errorCode) == UNORM_YES;
+        start = (start + pieceLength) % limit;
+    }
+    double seconds = utimer_getElapsedSeconds(&startTime);
+    if (count != iterations) {
+        fprintf(stderr, "QuickCheckUTF16: text is not normalized\n");
+    }
+    return seconds;
+}
+
 }  // namespace
 
 extern int main(int /*argc*/, const char * /*argv*/[]) {
@@ -308,6 +424,7 @@ extern int main(int /*argc*/, const char * /*argv*/[]) {
     int32_t maxLength = getMaxLength() * 10;
     UErrorCode errorCode = U_ZERO_ERROR;
     const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
     const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
     if (U_FAILURE(errorCode)) {
         fprintf(stderr,
@@ -348,5 +465,43 @@ extern int main(int /*argc*/, const char * /*argv*/[]) {
         NormalizeUTF8 op(*nfkc_cf, CommonChars::getJapanese(maxLength));
         benchmark("NFKC_CF/UTF-8/japanese", op);
     }
+    // Already-normalized text: The quick check should run close to memchr() speed
+    // over the code units below the normalization threshold.
+    {
+        IsNormalizedUTF16 op(*nfc, CommonChars::getASCII(maxLength));
+        benchmark("NFC/UTF-16/isNormalized/ascii", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfc, CommonChars::getLatin1(maxLength));
+        benchmark("NFC/UTF-16/isNormalized/latin1", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getASCII(maxLength));
+        benchmark("NFC/UTF-8/isNormalized/ascii", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getMixed(maxLength));
+        benchmark("NFC/UTF-8/isNormalized/mixed", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfd, CommonChars::getASCII(maxLength));
+        benchmark("NFD/UTF-8/isNormalized/ascii", op);
+    }
+    // Runs of code units below the normalization thresholds are skipped a block at a time.
+    // Mostly-Latin-1 text stays below the NFC thresholds U+0300 and lead byte 0xCC.
+    // For the numbers without block skipping, build the common library
+    // with -DU_NORMALIZER2_BLOCK_SKIP=0.
+    {
+        NormalizeUTF8 op(*nfc, CommonChars::getLatin1(maxLength));
+        benchmark("NFC/UTF-8/latin1", op);
+    }
+    {
+        QuickCheckUTF16 op(*nfc, CommonChars::getLatin1(maxLength));
+        benchmark("NFC/UTF-16/quickCheck/latin1", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getLatin1(maxLength));
+        benchmark("NFC/UTF-8/isNormalized/latin1", op);
+    }
     return 0;
 }
@@ -23,6 +23,14 @@
 *   for a before-and-after comparison of
 *   ticket 6441: make ucnv_countAvailable() not fully load converters
 *
+*   Also test the time for looking up converter names and aliases
+*   with ucnv_getCanonicalName() and ucnv_open(),
+*   for a before-and-after comparison of the perfect-hash alias index
+*   in cnvalias.icu versus the binary search over the aliases.
+*   For the "before" numbers, write a cnvalias.icu without the index
+*   into the data directory, for example with
+*     gencnval --nohash -d <ICU data directory>/icudt62l convrtrs.txt
+*
 *   Run with one optional command-line argument:
 *   You can specify the path to the ICU data directory.
 *
@@ -50,6 +58,16 @@
 #include "unicode/ucnv.h"
 #include "unicode/utimer.h"
 
+// Canonical names and aliases of different lengths and spellings,
+// and a name that is not an alias at all.
+static const char *const gAliases[] = {
+    "UTF-8", "utf8", "ISO-8859-1", "latin1", "windows-1252", "cp1252",
+    "Shift_JIS", "ibm-943_P15A-2003", "EUC-KR", "csISO2022JP", "GB18030",
+    "ibm-1208", "US-ASCII", "x-no-such-charset"
+};
+static const int32_t gAliasesCount = (int32_t)(sizeof(gAliases) / sizeof(gAliases[0]));
+static const int32_t gLookupIterations = 100000;
+
 static size_t icuMemUsage = 0;
 
 U_CDECL_BEGIN
@@ -125,6 +143,41 @@ int main(int argc, const char *argv[]) {
     printf("ucnv_countAvailable() took %g seconds to figure this out.\n", elapsed);
     printf("memory usage after ucnv_countAvailable(): %lu\n", (long)icuMemUsage);
 
+    // Measure the time to look up aliases, without and with a standard.
+    utimer_getTime(&start_time);
+    for (int32_t i = 0; i < gLookupIterations; ++i) {
+        for (int32_t j = 0; j < gAliasesCount; ++j) {
+            UErrorCode lookupErrorCode = U_ZERO_ERROR;
+            ucnv_countAliases(gAliases[j], &lookupErrorCode);
+        }
+    }
+    elapsed = utimer_getElapsedSeconds(&start_time);
+    printf("%d x ucnv_countAliases() took %g seconds, %g ns per call\n",
+           (int)(gLookupIterations * gAliasesCount), elapsed,
+           elapsed * 1e9 / ((double)gLookupIterations * gAliasesCount));
+
+    utimer_getTime(&start_time);
+    for (int32_t i = 0; i < gLookupIterations; ++i) {
+        for (int32_t j = 0; j < gAliasesCount; ++j) {
+            UErrorCode lookupErrorCode = U_ZERO_ERROR;
+            ucnv_getCanonicalName(gAliases[j], "IANA", &lookupErrorCode);
+        }
+    }
+    elapsed = utimer_getElapsedSeconds(&start_time);
+    printf("%d x ucnv_getCanonicalName(IANA) took %g seconds, %g ns per call\n",
+           (int)(gLookupIterations * gAliasesCount), elapsed,
+           elapsed * 1e9 / ((double)gLookupIterations * gAliasesCount));
+
+    // Measure ucnv_open() of a cached converter, which includes the alias lookup.
+    utimer_getTime(&start_time);
+    for (int32_t i = 0; i < gLookupIterations; ++i) {
+        UErrorCode openErrorCode = U_ZERO_ERROR;
+        ucnv_close(ucnv_open("utf-8", &openErrorCode));
+    }
+    elapsed = utimer_getElapsedSeconds(&start_time);
+    printf("%d x ucnv_open(utf-8)+ucnv_close() took %g seconds, %g ns per pair\n",
+           (int)gLookupIterations, elapsed, elapsed * 1e9 / gLookupIterations);
+
     ucnv_flushCache();
     printf("memory usage after ucnv_flushCache(): %lu\n", (long)icuMemUsage);
 
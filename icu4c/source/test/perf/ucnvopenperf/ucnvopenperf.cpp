@@ -0,0 +1,110 @@
+/*
+*******************************************************************************
+*
+*   © 2018 and later: Unicode, Inc. and others.
+*   License & terms of use: http://www.unicode.org/copyright.html#License
+*
+*******************************************************************************
+*   file name:  ucnvopenperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Test the multi-threaded throughput of ucnv_open()+ucnv_close()
+*   for converters that are already in the shared-data cache,
+*   as a server would open a converter per request,
+*   and of ucnv_acquire()+ucnv_release() with the per-thread converter pool.
+*
+*   Run with optional command-line arguments:
+*     ucnvopenperf [maxThreads [iterationsPerThread [ICU data directory]]]
+*   The test runs with 1, 2, 4, ... up to maxThreads threads (default 8),
+*   and prints the time and the number of open/close pairs per second.
+*   Each thread uses a rotating set of as many converters as the pool holds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+#include "unicode/utypes.h"
+#include "unicode/putil.h"
+#include "unicode/uclean.h"
+#include "unicode/ucnv.h"
+#include "unicode/utimer.h"
+#include "cmemory.h"
+
+static const char *const gNames[] = {
+    // Canonical names, aliases and options, all for data-driven converters.
+    "windows-1252", "Shift_JIS", "ibm-943_P15A-2003", "EUC-KR",
+    "gb18030", "Big5", "ibm-37,swaplfnl", "iso-8859-15"
+};
+
+static void openClose(int32_t iterations, int32_t offset) {
+    for (int32_t i = 0; i < iterations; ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(gNames[(i + offset) % UPRV_LENGTHOF(gNames)], &errorCode);
+        ucnv_close(cnv);
+    }
+}
+
+static void acquireRelease(int32_t iterations, int32_t offset) {
+    for (int32_t i = 0; i < iterations; ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_acquire(gNames[(i + offset) % UPRV_LENGTHOF(gNames)], &errorCode);
+        ucnv_release(cnv);
+    }
+    ucnv_flushPool();
+}
+
+static void runThreads(void (*fn)(int32_t, int32_t), const char *fnName,
+                       int32_t numThreads, int32_t iterations) {
+    UTimer start_time;
+    utimer_getTime(&start_time);
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < numThreads; ++t) {
+        threads.push_back(std::thread(fn, iterations, t));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    double elapsed = utimer_getElapsedSeconds(&start_time);
+    printf("%2d threads x %d %s: %8.4f seconds, %12.0f pairs/second\n",
+           (int)numThreads, (int)iterations, fnName, elapsed,
+           (double)numThreads * iterations / elapsed);
+}
+
+int main(int argc, const char *argv[]) {
+    int32_t maxThreads = 8;
+    int32_t iterations = 200000;
+    if (argc > 1) {
+        maxThreads = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        iterations = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        printf("u_setDataDirectory(%s)\n", argv[3]);
+        u_setDataDirectory(argv[3]);
+    }
+
+    // Load all converters once so that the measurement only sees cache hits.
+    for (int32_t i = 0; i < UPRV_LENGTHOF(gNames); ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(gNames[i], &errorCode);
+        if (U_FAILURE(errorCode)) {
+            fprintf(stderr, "unable to open converter %s - %s\n", gNames[i], u_errorName(errorCode));
+            return errorCode;
+        }
+        ucnv_close(cnv);
+    }
+
+    for (int32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        runThreads(openClose, "ucnv_open()+ucnv_close()", numThreads, iterations);
+    }
+    for (int32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        runThreads(acquireRelease, "ucnv_acquire()+ucnv_release()", numThreads, iterations);
+    }
+
+    u_cleanup();
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+*******************************************************************************
+*
+*   © 2018 and later: Unicode, Inc. and others.
+*   License & terms of use: http://www.unicode.org/copyright.html#License
+*
+*******************************************************************************
+*   file name:  uhashperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Test the uhash_put()+uhash_get() throughput for realistic sets of
+*   string keys: locale IDs, time zone IDs, and data file paths
+*   (long keys with long common prefixes, like the udata and resource bundle
+*   caches use), with the current string hash function
+*   and with the earlier one that sampled only about 32 characters of each key,
+*   and with the default double-hashing table layout and with
+*   UHASH_GROUP_PROBING.
+*
+*   Run with optional command-line arguments:
+*     uhashperf [iterations [ICU data directory]]
+*   For each key set, hash function and table layout, the test prints the number of
+*   distinct hash codes, and the time for filling a new table with all
+*   of the keys and then looking up each key iterations times.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "unicode/utypes.h"
+#include "unicode/putil.h"
+#include "unicode/uclean.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "unicode/ustring.h"
+#include "unicode/utimer.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uhash.h"
+
+// The string hash before it was changed to cover all characters.
+static int32_t U_CALLCONV sampledHashChars(const UHashTok key) {
+    const uint8_t *p = static_cast<const uint8_t *>(key.pointer);
+    uint32_t hash = 0;
+    if (p != NULL) {
+        int32_t len = static_cast<int32_t>(uprv_strlen(static_cast<const char *>(key.pointer)));
+        int32_t inc = ((len - 32) / 32) + 1;
+        const uint8_t *limit = p + len;
+        while (p < limit) {
+            hash = (hash * 37) + *p;
+            p += inc;
+        }
+    }
+    return static_cast<int32_t>(hash);
+}
+
+typedef std::vector<std::string> KeySet;
+
+static KeySet getLocaleIDs() {
+    KeySet keys;
+    for (int32_t i = 0; i < uloc_countAvailable(); ++i) {
+        keys.push_back(uloc_getAvailable(i));
+    }
+    return keys;
+}
+
+static KeySet getZoneIDs(UErrorCode &errorCode) {
+    KeySet keys;
+    UResourceBundle *top = ures_openDirect(NULL, "zoneinfo64", &errorCode);
+    UResourceBundle *names = ures_getByKey(top, "Names", NULL, &errorCode);
+    while (U_SUCCESS(errorCode) && ures_hasNext(names)) {
+        int32_t length;
+        const UChar *s = ures_getNextString(names, &length, NULL, &errorCode);
+        char buffer[100];
+        if (U_SUCCESS(errorCode) && length < UPRV_LENGTHOF(buffer)) {
+            u_UCharsToChars(s, buffer, length + 1);
+            keys.push_back(buffer);
+        }
+    }
+    ures_close(names);
+    ures_close(top);
+    return keys;
+}
+
+static KeySet getDataPaths(const KeySet &localeIDs) {
+    static const char *const trees[] = { "", "coll/", "curr/", "lang/", "region/", "unit/", "zone/" };
+    KeySet keys;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(trees); ++i) {
+        for (const std::string &id : localeIDs) {
+            keys.push_back(std::string("/opt/services/localization-runtime/share/icu/" U_ICU_VERSION "/" U_ICUDATA_NAME "/") +
+                           trees[i] + id + ".res");
+        }
+    }
+    return keys;
+}
+
+static void run(const char *setName, const KeySet &keys,
+                UHashFunction *hasher, const char *hasherName,
+                uint32_t flags, int32_t iterations) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UHashtable *codes = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &errorCode);
+    for (const std::string &key : keys) {
+        UHashTok tok;
+        tok.pointer = const_cast<char *>(key.c_str());
+        uhash_iputi(codes, hasher(tok), 1, &errorCode);
+    }
+    int32_t distinct = uhash_count(codes);
+    uhash_close(codes);
+
+    UTimer start_time;
+    utimer_getTime(&start_time);
+    UHashtable *hash = uhash_openSizeWithFlags(hasher, uhash_compareChars, NULL,
+                                               0, flags, &errorCode);
+    for (const std::string &key : keys) {
+        uhash_put(hash, const_cast<char *>(key.c_str()), const_cast<char *>(key.c_str()), &errorCode);
+    }
+    int32_t found = 0;
+    for (int32_t i = 0; i < iterations; ++i) {
+        for (const std::string &key : keys) {
+            found += uhash_get(hash, key.c_str()) != NULL;
+        }
+    }
+    uhash_close(hash);
+    double elapsed = utimer_getElapsedSeconds(&start_time);
+    if (U_FAILURE(errorCode) || found != iterations * (int32_t)keys.size()) {
+        fprintf(stderr, "error: %s with %s, flags %x - %s\n",
+                setName, hasherName, (unsigned)flags, u_errorName(errorCode));
+        return;
+    }
+    const char *layoutName = (flags & UHASH_GROUP_PROBING) != 0 ? "groups" : "double";
+    printf("%-12s %5d keys, %-7s hash, %s: %5d distinct codes, %8.4f seconds, %12.0f lookups/second\n",
+           setName, (int)keys.size(), hasherName, layoutName, (int)distinct, elapsed,
+           (double)iterations * keys.size() / elapsed);
+}
+
+int main(int argc, const char *argv[]) {
+    int32_t iterations = 200;
+    if (argc > 1) {
+        iterations = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        printf("u_setDataDirectory(%s)\n", argv[2]);
+        u_setDataDirectory(argv[2]);
+    }
+
+    UErrorCode errorCode = U_ZERO_ERROR;
+    KeySet localeIDs = getLocaleIDs();
+    KeySet zoneIDs = getZoneIDs(errorCode);
+    if (U_FAILURE(errorCode)) {
+        fprintf(stderr, "unable to read the time zone IDs - %s\n", u_errorName(errorCode));
+        return errorCode;
+    }
+    KeySet dataPaths = getDataPaths(localeIDs);
+
+    const struct {
+        const char *name;
+        const KeySet &keys;
+    } sets[] = {
+        { "locale IDs", localeIDs },
+        { "zone IDs", zoneIDs },
+        { "data paths", dataPaths }
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(sets); ++i) {
+        run(sets[i].name, sets[i].keys, uhash_hashChars, "full", 0, iterations);
+        run(sets[i].name, sets[i].keys, uhash_hashChars, "full", UHASH_GROUP_PROBING, iterations);
+        run(sets[i].name, sets[i].keys, sampledHashChars, "sampled", 0, iterations);
+    }
+
+    u_cleanup();
+    return 0;
+}
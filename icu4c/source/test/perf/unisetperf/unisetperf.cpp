@@ -42,7 +42,8 @@ static UOption options[UNISETPERF_OPTIONS_COUNT]={
 static const char *const unisetperf_usage =
     "\t--pattern   UnicodeSet pattern for instantiation.\n"
     "\t            Default: [:ID_Continue:]\n"
-    "\t--type      Type of UnicodeSet: slow fast\n"
+    "\t--type      Type of UnicodeSet: slow fast trie\n"
+    "\t            (fast: frozen; trie: frozen with a code point trie)\n"
     "\t            Default: slow\n";
 
 // Test object with setup data.
@@ -57,6 +58,8 @@ class UnicodeSetPerformanceTest : public UPerfTest {
             prefrozen=set;
             if(0==strcmp(options[FAST_TYPE].value, "fast")) {
                 set.freeze();
+            } else if(0==strcmp(options[FAST_TYPE].value, "trie")) {
+                set.freeze(USET_FREEZE_CODE_POINT_TRIE);
             }
 
             int32_t inputLength;
@@ -0,0 +1,190 @@
+/*
+*******************************************************************************
+*
+*   © 2018 and later: Unicode, Inc. and others.
+*   License & terms of use: http://www.unicode.org/copyright.html#License
+*
+*******************************************************************************
+*   file name:  utextperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Test the UText access performance for UTF-8 text (utext_openUTF8())
+*   and for the same text in a UTF-8 file (utext_openUTF8File(), "file")
+*   compared with the same text in UTF-16 (utext_openUChars()):
+*   Sequential forward iteration with native indexes (as break iteration
+*   and regular expressions use it), backward iteration, random access,
+*   and word break iteration.
+*   Each test runs over ASCII-dominant text (English with a few non-ASCII
+*   characters) and over pure ASCII text.
+*
+*   Run with optional command-line arguments:
+*     utextperf [iterations [ICU data directory]]
+*   For each text, encoding and test, the test prints the time and
+*   the throughput in millions of code points per second.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include "unicode/utypes.h"
+#include "unicode/putil.h"
+#include "unicode/ubrk.h"
+#include "unicode/uclean.h"
+#include "unicode/ustring.h"
+#include "unicode/utext.h"
+#include "unicode/utimer.h"
+#include "cmemory.h"
+
+static const char *const mixedWords[] = {
+    "The", "café", "on", "the", "corner", "serves", "a", "naïve", "but", "excellent",
+    "crème", "brûlée", "—", "and", "its", "owner,", "Zoë,", "knows", "every", "regular",
+    "by", "name.", "Prices", "are", "quoted", "in", "€", "and", "in", "dollars."
+};
+
+static const char *const asciiWords[] = {
+    "The", "cafe", "on", "the", "corner", "serves", "a", "naive", "but", "excellent",
+    "creme", "brulee", "-", "and", "its", "owner,", "Zoe,", "knows", "every", "regular",
+    "by", "name.", "Prices", "are", "quoted", "in", "EUR", "and", "in", "dollars."
+};
+
+static std::string makeText(const char *const words[], int32_t numWords, int32_t minLength) {
+    std::string s;
+    int32_t i = 0;
+    while ((int32_t)s.length() < minLength) {
+        s.append(words[i % numWords]);
+        s.push_back((i % 97) == 96 ? '\n' : ' ');
+        ++i;
+    }
+    return s;
+}
+
+// Forward iteration, reading the native index of each code point.
+static int64_t forward(UText *ut) {
+    int64_t sum = 0;
+    UChar32 c;
+    utext_setNativeIndex(ut, 0);
+    while ((c = UTEXT_NEXT32(ut)) >= 0) {
+        sum += c + UTEXT_GETNATIVEINDEX(ut);
+    }
+    return sum;
+}
+
+static int64_t backward(UText *ut) {
+    int64_t sum = 0;
+    UChar32 c;
+    utext_setNativeIndex(ut, utext_nativeLength(ut));
+    while ((c = UTEXT_PREVIOUS32(ut)) >= 0) {
+        sum += c;
+    }
+    return sum;
+}
+
+// Random access to as many positions as there are native units.
+static int64_t randomAccess(UText *ut) {
+    int64_t sum = 0;
+    int32_t length = (int32_t)utext_nativeLength(ut);
+    uint32_t r = 1;
+    for (int32_t i = 0; i < length; ++i) {
+        r = r * 1103515245u + 12345u;
+        sum += utext_char32At(ut, (r >> 1) % length);
+    }
+    return sum;
+}
+
+static int64_t wordBreaks(UText *ut) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UBreakIterator *bi = ubrk_open(UBRK_WORD, "en", NULL, 0, &errorCode);
+    ubrk_setUText(bi, ut, &errorCode);
+    int64_t count = 0;
+    if (U_SUCCESS(errorCode)) {
+        while (ubrk_next(bi) != UBRK_DONE) {
+            ++count;
+        }
+    } else {
+        fprintf(stderr, "error: unable to open a word break iterator - %s\n", u_errorName(errorCode));
+    }
+    ubrk_close(bi);
+    return count;
+}
+
+static void run(const char *textName, const char *encodingName, UText *ut, int32_t numCodePoints,
+                const char *testName, int64_t (*test)(UText *), int32_t iterations) {
+    UTimer start_time;
+    utimer_getTime(&start_time);
+    int64_t sum = 0;
+    for (int32_t i = 0; i < iterations; ++i) {
+        sum += test(ut);
+    }
+    double elapsed = utimer_getElapsedSeconds(&start_time);
+    printf("%-6s %-6s %-12s %8.4f seconds, %8.2f M code points/second (%lld)\n",
+           textName, encodingName, testName, elapsed,
+           (double)iterations * numCodePoints / elapsed / 1e6, (long long)(sum % 1000));
+}
+
+int main(int argc, const char *argv[]) {
+    int32_t iterations = 20;
+    if (argc > 1) {
+        iterations = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        printf("u_setDataDirectory(%s)\n", argv[2]);
+        u_setDataDirectory(argv[2]);
+    }
+
+    static const char *const fileName = "utextperf.txt";
+    const struct {
+        const char *name;
+        std::string text;
+    } texts[] = {
+        { "mixed", makeText(mixedWords, UPRV_LENGTHOF(mixedWords), 1000000) },
+        { "ascii", makeText(asciiWords, UPRV_LENGTHOF(asciiWords), 1000000) }
+    };
+    const struct {
+        const char *name;
+        int64_t (*test)(UText *);
+    } tests[] = {
+        { "forward", forward },
+        { "backward", backward },
+        { "random", randomAccess },
+        { "word breaks", wordBreaks }
+    };
+
+    for (int32_t t = 0; t < UPRV_LENGTHOF(texts); ++t) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const std::string &s8 = texts[t].text;
+        int32_t length16;
+        u_strFromUTF8(NULL, 0, &length16, s8.data(), (int32_t)s8.length(), &errorCode);
+        errorCode = U_ZERO_ERROR;
+        UChar *s16 = (UChar *)uprv_malloc(length16 * U_SIZEOF_UCHAR);
+        u_strFromUTF8(s16, length16, NULL, s8.data(), (int32_t)s8.length(), &errorCode);
+        int32_t numCodePoints = u_countChar32(s16, length16);
+
+        UText *ut8 = utext_openUTF8(NULL, s8.data(), (int64_t)s8.length(), &errorCode);
+        UText *ut16 = utext_openUChars(NULL, s16, length16, &errorCode);
+        FILE *f = fopen(fileName, "wb");
+        if (f == NULL || fwrite(s8.data(), 1, s8.length(), f) != s8.length() || fclose(f) != 0) {
+            fprintf(stderr, "error: unable to write %s\n", fileName);
+            return 1;
+        }
+        UText *utFile = utext_openUTF8File(NULL, fileName, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            fprintf(stderr, "error: unable to set up the %s text - %s\n", texts[t].name, u_errorName(errorCode));
+            return errorCode;
+        }
+        for (int32_t i = 0; i < UPRV_LENGTHOF(tests); ++i) {
+            run(texts[t].name, "UTF-8", ut8, numCodePoints, tests[i].name, tests[i].test, iterations);
+            run(texts[t].name, "UTF-16", ut16, numCodePoints, tests[i].name, tests[i].test, iterations);
+            run(texts[t].name, "file", utFile, numCodePoints, tests[i].name, tests[i].test, iterations);
+        }
+        utext_close(ut8);
+        utext_close(ut16);
+        utext_close(utFile);
+        remove(fileName);
+        uprv_free(s16);
+    }
+
+    u_cleanup();
+    return 0;
+}
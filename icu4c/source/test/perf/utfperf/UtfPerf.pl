@@ -45,6 +45,8 @@
     "Roundtrip",      ["$p1,Roundtrip",        "$p2,Roundtrip"],
     "FromUnicode",    ["$p1,FromUnicode",      "$p2,FromUnicode"],
     "FromUTF8",       ["$p1,FromUTF8",         "$p2,FromUTF8"],
+    "StrToUTF8",      ["$p1,StrToUTF8",        "$p2,StrToUTF8"],
+    "StrFromUTF8",    ["$p1,StrFromUTF8",      "$p2,StrFromUTF8"],
 };
 
 my $dataFiles = {
@@ -328,11 +328,57 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test u_strToUTF8() UTF-16->UTF-8, independent of the --charset.
+class StrToUTF8 : public Command {
+protected:
+    StrToUTF8(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrToUTF8 * t = new StrToUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        u_strToUTF8WithSub(intermediate, OUTPUT_CAPACITY, &encodedLength,
+                           input, inputLength, 0xfffd, NULL, pErrorCode);
+    }
+};
+
+// Test u_strFromUTF8() UTF-8->UTF-16, independent of the --charset.
+class StrFromUTF8 : public Command {
+protected:
+    StrFromUTF8(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrFromUTF8 * t = new StrFromUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8WithSub(output, OUTPUT_CAPACITY, &outputLength,
+                             utf8, utf8Length, 0xfffd, NULL, pErrorCode);
+        if(U_SUCCESS(*pErrorCode) && inputLength!=outputLength) {
+            fprintf(stderr, "error: u_strFromUTF8() inputLength %d!=outputLength %d\n", inputLength, outputLength);
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "StrToUTF8";     if (exec) return StrToUTF8::get(*this); break;
+        case 4: name = "StrFromUTF8";   if (exec) return StrFromUTF8::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
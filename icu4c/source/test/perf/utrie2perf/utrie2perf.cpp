@@ -15,13 +15,16 @@
  *  created on: 2008sep07
  *  created by: Markus W. Scherer
  *
- *  Performance test program for UTrie2.
+ *  Performance test program for UTrie2 and for the UCPTrie
+ *  code point properties (general category, script, bidi and case).
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include "unicode/uchar.h"
 #include "unicode/unorm.h"
+#include "unicode/uscript.h"
+#include "unicode/ustring.h"
 #include "unicode/uperf.h"
 #include "uoptions.h"
 
@@ -229,14 +232,95 @@ class GetBiDiClass : public Command {
     }
 };
 
+class GetCharType : public Command {
+protected:
+    GetCharType(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new GetCharType(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        uint32_t bitSet=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            bitSet|=(uint32_t)1<<u_charType(c);
+        }
+        if(length>0 && bitSet==0) {
+            fprintf(stderr, "error: GetCharType() did not collect bits\n");
+        }
+    }
+};
+
+class GetScript : public Command {
+protected:
+    GetScript(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new GetScript(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        int32_t sum=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            sum+=uscript_getScript(c, pErrorCode);
+        }
+        if(length>0 && sum==0) {
+            fprintf(stderr, "error: GetScript() did not sum up scripts\n");
+        }
+    }
+};
+
+class ToLower : public Command {
+protected:
+    ToLower(const UTrie2PerfTest &testcase) : Command(testcase) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        destCapacity=u_strToLower(NULL, 0,
+                                  testcase.getBuffer(), testcase.getBufferLen(),
+                                  "", &errorCode);
+        dest=new UChar[destCapacity];
+    }
+    ~ToLower() {
+        delete [] dest;
+    }
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ToLower(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t destLength=u_strToLower(dest, destCapacity,
+                                        testcase.getBuffer(), testcase.getBufferLen(),
+                                        "", &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=destCapacity) {
+            fprintf(stderr, "error: u_strToLower() failed: %s\n",
+                    u_errorName(errorCode));
+        }
+    }
+
+private:
+    UChar *dest;
+    int32_t destCapacity;
+};
+
 UPerfFunction* UTrie2PerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "CheckFCD";              if (exec) return CheckFCD::get(*this); break;
         case 1: name = "ToNFC";                 if (exec) return ToNFC::get(*this); break;
         case 2: name = "GetBiDiClass";          if (exec) return GetBiDiClass::get(*this); break;
+        case 3: name = "GetCharType";           if (exec) return GetCharType::get(*this); break;
+        case 4: name = "GetScript";             if (exec) return GetScript::get(*this); break;
+        case 5: name = "ToLower";               if (exec) return ToLower::get(*this); break;
 #if 0  // See comment at unorm_initUTrie2() forward declaration.
-        case 3: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
-        case 4: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
+        case 6: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
+        case 7: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
 #endif
         default: name = ""; break;
     }
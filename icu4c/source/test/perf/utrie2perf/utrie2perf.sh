@@ -25,4 +25,7 @@ for file in udhr_eng.txt \
 # $PERF CheckFCDUTF8        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF ToNFC               -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF GetBiDiClass        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF GetCharType         -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF GetScript           -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ToLower             -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
 done
@@ -18,10 +18,11 @@
 *   This program reads convrtrs.txt and writes a memory-mappable
 *   converter name alias table to cnvalias.dat .
 *
-*   This program currently writes version 2.1 of the data format. See
-*   ucnv_io.c for more details on the format. Note that version 2.1
-*   is written in such a way that a 2.0 reader will be able to use it,
-*   and a 2.1 reader will be able to read 2.0.
+*   This program currently writes version 3.0.1 of the data format. See
+*   ucnv_io.cpp for more details on the format. The optional perfect-hash
+*   index is appended as a 10th section and is signaled only by the
+*   section count in the table of contents, so that the formatVersion
+*   remains acceptable to existing readers, including ICU4J's.
 */
 
 #include "unicode/utypes.h"
@@ -138,6 +139,7 @@ static uint16_t aliasListsSize = 0;
 static UBool standardTagsUsed = FALSE;
 static UBool verbose = FALSE;
 static UBool quiet = FALSE;
+static UBool noHashIndex = FALSE;
 static int lineNum = 1;
 
 static UConverterAliasOptions tableOptions = {
@@ -207,7 +209,8 @@ enum
     COPYRIGHT,
     DESTDIR,
     SOURCEDIR,
-    QUIET
+    QUIET,
+    NOHASH
 };
 
 static UOption options[]={
@@ -217,7 +220,8 @@ static UOption options[]={
     UOPTION_COPYRIGHT,
     UOPTION_DESTDIR,
     UOPTION_SOURCEDIR,
-    UOPTION_QUIET
+    UOPTION_QUIET,
+    UOPTION_DEF("nohash", 'n', UOPT_NO_ARG)
 };
 
 extern int
@@ -250,7 +254,8 @@ main(int argc, char* argv[]) {
             "\t-q or --quiet       do not display warnings and progress\n"
             "\t-c or --copyright   include a copyright notice\n"
             "\t-d or --destdir     destination directory, followed by the path\n"
-            "\t-s or --sourcedir   source directory, followed by the path\n",
+            "\t-s or --sourcedir   source directory, followed by the path\n"
+            "\t-n or --nohash      do not write the perfect-hash alias index\n",
             argv[0]);
         return argc<0 ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -263,6 +268,10 @@ main(int argc, char* argv[]) {
         quiet = TRUE;
     }
 
+    if(options[NOHASH].doesOccur) {
+        noHashIndex = TRUE;
+    }
+
     if(argc>=2) {
         path=argv[1];
     } else {
@@ -976,10 +985,162 @@ createNormalizedAliasStrings(char *normalizedStrings, const char *origStringBloc
     }
 }
 
+/*
+ * Try to place each bucket's aliases into empty slots with one displacement
+ * per bucket, largest buckets first ("hash and displace").
+ */
+static UBool
+fillPerfectHashIndex(uint16_t *hashTable, const uint32_t *hashes, uint32_t count,
+                     uint32_t bucketBits, uint32_t slotBits) {
+    uint32_t bucketCount = (uint32_t)1 << bucketBits;
+    uint32_t slotCount = (uint32_t)1 << slotBits;
+    uint16_t *displacements = hashTable + UCNV_IO_HASH_HEADER_LENGTH;
+    uint16_t *slots = displacements + bucketCount;
+    uint32_t *bucketStarts = (uint32_t *)uprv_malloc((bucketCount + 1) * sizeof(uint32_t));
+    uint32_t *members = (uint32_t *)uprv_malloc(count * sizeof(uint32_t));
+    uint32_t *memberSlots = (uint32_t *)uprv_malloc(count * sizeof(uint32_t));
+    uint32_t i, bucket, size, maxSize, displacement;
+    UBool success = TRUE;
+
+    if (bucketStarts == NULL || members == NULL || memberSlots == NULL) {
+        fprintf(stderr, "gencnval: error: out of memory for the perfect-hash index\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+
+    hashTable[0] = (uint16_t)bucketBits;
+    hashTable[1] = (uint16_t)slotBits;
+    uprv_memset(displacements, 0, bucketCount * sizeof(uint16_t));
+    for (i = 0; i < slotCount; ++i) {
+        slots[i] = UCNV_IO_EMPTY_HASH_SLOT;
+    }
+
+    /* counting sort of the aliases by bucket */
+    uprv_memset(bucketStarts, 0, (bucketCount + 1) * sizeof(uint32_t));
+    for (i = 0; i < count; ++i) {
+        ++bucketStarts[(hashes[i] & (bucketCount - 1)) + 1];
+    }
+    maxSize = 0;
+    for (bucket = 0; bucket < bucketCount; ++bucket) {
+        if (bucketStarts[bucket + 1] > maxSize) {
+            maxSize = bucketStarts[bucket + 1];
+        }
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+    }
+    for (i = 0; i < count; ++i) {
+        members[bucketStarts[hashes[i] & (bucketCount - 1)]++] = i;
+    }
+    for (bucket = bucketCount; bucket > 0; --bucket) {
+        bucketStarts[bucket] = bucketStarts[bucket - 1];
+    }
+    bucketStarts[0] = 0;
+
+    for (size = maxSize; size > 0 && success; --size) {
+        for (bucket = 0; bucket < bucketCount && success; ++bucket) {
+            const uint32_t *bucketMembers = members + bucketStarts[bucket];
+            if (bucketStarts[bucket + 1] - bucketStarts[bucket] != size) {
+                continue;
+            }
+            for (displacement = 0; displacement < 0x10000; ++displacement) {
+                uint32_t j, k;
+                for (j = 0; j < size; ++j) {
+                    uint32_t slot = ucnv_io_getHashSlot(hashes[bucketMembers[j]], displacement, slotCount - 1);
+                    if (slots[slot] != UCNV_IO_EMPTY_HASH_SLOT) {
+                        break;
+                    }
+                    for (k = 0; k < j && memberSlots[k] != slot; ++k) {}
+                    if (k < j) {
+                        break;
+                    }
+                    memberSlots[j] = slot;
+                }
+                if (j == size) {
+                    break;
+                }
+            }
+            if (displacement < 0x10000) {
+                uint32_t j;
+                displacements[bucket] = (uint16_t)displacement;
+                for (j = 0; j < size; ++j) {
+                    slots[memberSlots[j]] = (uint16_t)bucketMembers[j];
+                }
+            } else {
+                success = FALSE;
+            }
+        }
+    }
+
+    uprv_free(memberSlots);
+    uprv_free(members);
+    uprv_free(bucketStarts);
+    return success;
+}
+
+/*
+ * Build the optional perfect-hash index over the normalized unique aliases.
+ * Returns NULL if no index could be built, for example because two aliases
+ * have the same 32-bit hash code; the runtime then uses its binary search.
+ */
+static uint16_t *
+createPerfectHashIndex(const char *normalizedStrings, const uint16_t *uniqueAliases,
+                       uint32_t count, uint32_t *pLength) {
+    uint32_t bucketBits = 0, slotBits = 1;
+    uint32_t *hashes;
+    uint16_t *hashTable = NULL;
+    uint32_t i;
+
+    if (count == 0) {
+        return NULL;
+    }
+    hashes = (uint32_t *)uprv_malloc(count * sizeof(uint32_t));
+    if (hashes == NULL) {
+        fprintf(stderr, "gencnval: error: out of memory for the perfect-hash index\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    for (i = 0; i < count; ++i) {
+        hashes[i] = ucnv_io_hashNormalizedName(normalizedStrings + 2 * (size_t)uniqueAliases[i]);
+    }
+
+    /* about four aliases per bucket, and a load factor of at most 0.8 */
+    while (((uint32_t)4 << bucketBits) < count) {
+        ++bucketBits;
+    }
+    while (((uint32_t)1 << slotBits) < count + count / 4) {
+        ++slotBits;
+    }
+    for (; slotBits <= UCNV_IO_MAX_HASH_BITS; ++slotBits) {
+        uint32_t length = UCNV_IO_HASH_HEADER_LENGTH + ((uint32_t)1 << bucketBits) + ((uint32_t)1 << slotBits);
+        hashTable = (uint16_t *)uprv_malloc(length * sizeof(uint16_t));
+        if (hashTable == NULL) {
+            fprintf(stderr, "gencnval: error: out of memory for the perfect-hash index\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        if (fillPerfectHashIndex(hashTable, hashes, count, bucketBits, slotBits)) {
+            *pLength = length;
+            break;
+        }
+        uprv_free(hashTable);
+        hashTable = NULL;
+    }
+    uprv_free(hashes);
+
+    if (hashTable == NULL) {
+        if (!quiet) {
+            fprintf(stderr, "%s: warning: unable to build the perfect-hash alias index\n", path);
+        }
+    } else if (verbose) {
+        printf("perfect-hash alias index: %u aliases, %u buckets, %u slots\n",
+               (unsigned)count, (unsigned)1 << bucketBits, (unsigned)1 << slotBits);
+    }
+    return hashTable;
+}
+
 static void
 writeAliasTable(UNewDataMemory *out) {
     uint32_t i, j;
     uint32_t uniqueAliasesSize;
+    char *normalizedStrings = NULL;
+    uint16_t *hashTable = NULL;
+    uint32_t hashTableLength = 0;
     uint16_t aliasOffset = (uint16_t)(tagBlock.top/sizeof(uint16_t));
     uint16_t *aliasArrLists = (uint16_t *)uprv_malloc(tagCount * converterCount * sizeof(uint16_t));
     uint16_t *uniqueAliases = (uint16_t *)uprv_malloc(knownAliasesCount * sizeof(uint16_t));
@@ -998,13 +1159,25 @@ writeAliasTable(UNewDataMemory *out) {
         }
     }
 
+    if (tableOptions.stringNormalizationType != UCNV_IO_UNNORMALIZED) {
+        normalizedStrings = (char *)uprv_malloc(tagBlock.top + stringBlock.top);
+        createNormalizedAliasStrings(normalizedStrings, tagBlock.store, tagBlock.top);
+        createNormalizedAliasStrings(normalizedStrings + tagBlock.top, stringBlock.store, stringBlock.top);
+        if (!noHashIndex) {
+            hashTable = createPerfectHashIndex(normalizedStrings, uniqueAliases, uniqueAliasesSize, &hashTableLength);
+        }
+    }
+
     /* Write the size of the TOC */
     if (tableOptions.stringNormalizationType == UCNV_IO_UNNORMALIZED) {
         udata_write32(out, 8);
     }
-    else {
+    else if (hashTable == NULL) {
         udata_write32(out, 9);
     }
+    else {
+        udata_write32(out, 10);
+    }
 
     /* Write the sizes of each section */
     /* All sizes are the number of uint16_t units, not bytes */
@@ -1019,6 +1192,9 @@ writeAliasTable(UNewDataMemory *out) {
     if (tableOptions.stringNormalizationType != UCNV_IO_UNNORMALIZED) {
         udata_write32(out, (tagBlock.top + stringBlock.top) / sizeof(uint16_t));
     }
+    if (hashTable != NULL) {
+        udata_write32(out, hashTableLength);
+    }
 
     /* write the table of converters */
     /* Think of this as the column headers */
@@ -1062,16 +1238,18 @@ writeAliasTable(UNewDataMemory *out) {
     udata_writeString(out, stringBlock.store, stringBlock.top);
 
     /* write the normalized aliases strings */
-    if (tableOptions.stringNormalizationType != UCNV_IO_UNNORMALIZED) {
-        char *normalizedStrings = (char *)uprv_malloc(tagBlock.top + stringBlock.top);
-        createNormalizedAliasStrings(normalizedStrings, tagBlock.store, tagBlock.top);
-        createNormalizedAliasStrings(normalizedStrings + tagBlock.top, stringBlock.store, stringBlock.top);
-
+    if (normalizedStrings != NULL) {
         /* Write out the complete normalized array. */
         udata_writeString(out, normalizedStrings, tagBlock.top + stringBlock.top);
         uprv_free(normalizedStrings);
     }
 
+    /* write the perfect-hash index */
+    if (hashTable != NULL) {
+        udata_writeBlock(out, hashTable, hashTableLength * sizeof(uint16_t));
+        uprv_free(hashTable);
+    }
+
     uprv_free(uniqueAliasesToConverter);
     uprv_free(uniqueAliases);
     uprv_free(aliasArrLists);
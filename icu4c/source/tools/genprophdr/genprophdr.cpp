@@ -0,0 +1,394 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  genprophdr.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   This program builds UCPTrie data for selected Unicode properties
+*   from the ICU data and writes a standalone C++11 header file with
+*   constexpr trie arrays and constexpr inline lookup functions.
+*   The header needs neither the ICU libraries nor any runtime initialization,
+*   which suits embedded code that needs only a handful of properties.
+*/
+
+#include "unicode/utypes.h"
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "unicode/putil.h"
+#include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
+#include "unicode/uset.h"
+#include "cstring.h"
+#include "toolutil.h"
+#include "uoptions.h"
+#include "writesrc.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+UBool beVerbose = FALSE;
+
+enum {
+    HELP_H,
+    HELP_QUESTION_MARK,
+    VERBOSE,
+    DESTDIR,
+    OUTPUT_FILENAME,
+    NAMESPACE
+};
+
+UOption options[]={
+    UOPTION_HELP_H,
+    UOPTION_HELP_QUESTION_MARK,
+    UOPTION_VERBOSE,
+    UOPTION_DESTDIR,
+    UOPTION_DEF("output", 'o', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("namespace", 'n', UOPT_REQUIRES_ARG)
+};
+
+/** How the values of one property are stored and what its lookup function returns. */
+enum PropertyKind {
+    KIND_BINARY,   // 0/1 values, bool lookup function
+    KIND_INT,      // enumerated/int values, int32_t lookup function
+    KIND_MAPPING   // simple case mappings stored as code point deltas
+};
+
+PropertyKind getKind(UProperty prop) {
+    if (UCHAR_BINARY_START <= prop && prop < UCHAR_BINARY_LIMIT) {
+        return KIND_BINARY;
+    } else if (UCHAR_INT_START <= prop && prop < UCHAR_INT_LIMIT) {
+        return KIND_INT;
+    } else {
+        return KIND_MAPPING;
+    }
+}
+
+UChar32 getSimpleMapping(UProperty prop, UChar32 c) {
+    switch (prop) {
+    case UCHAR_SIMPLE_CASE_FOLDING:
+        return u_foldCase(c, U_FOLD_CASE_DEFAULT);
+    case UCHAR_SIMPLE_LOWERCASE_MAPPING:
+        return u_tolower(c);
+    case UCHAR_SIMPLE_UPPERCASE_MAPPING:
+        return u_toupper(c);
+    case UCHAR_SIMPLE_TITLECASE_MAPPING:
+        return u_totitle(c);
+    default:
+        return c;  // unreachable
+    }
+}
+
+/**
+ * Builds a fast-type UCPTrie for the property.
+ * Binary properties get 8-bit 0/1 values, int properties the narrowest width
+ * that holds their maximum value, and case mappings 32-bit deltas c'-c.
+ */
+UCPTrie *buildTrie(UProperty prop, PropertyKind kind, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    LocalUMutableCPTriePointer mutableTrie;
+    UCPTrieValueWidth valueWidth;
+    if (kind == KIND_BINARY) {
+        const USet *set = u_getBinaryPropertySet(prop, &errorCode);
+        mutableTrie.adoptInstead(umutablecptrie_open(0, 0, &errorCode));
+        if (U_FAILURE(errorCode)) { return nullptr; }
+        int32_t count = uset_getItemCount(set);
+        for (int32_t i = 0; i < count; ++i) {
+            UChar32 start, end;
+            uset_getItem(set, i, &start, &end, nullptr, 0, &errorCode);
+            umutablecptrie_setRange(mutableTrie.getAlias(), start, end, 1, &errorCode);
+        }
+        valueWidth = UCPTRIE_VALUE_BITS_8;
+    } else if (kind == KIND_INT) {
+        const UCPMap *map = u_getIntPropertyMap(prop, &errorCode);
+        mutableTrie.adoptInstead(umutablecptrie_fromUCPMap(map, &errorCode));
+        int32_t maxValue = u_getIntPropertyMaxValue(prop);
+        valueWidth = maxValue <= 0xff ? UCPTRIE_VALUE_BITS_8 :
+            maxValue <= 0xffff ? UCPTRIE_VALUE_BITS_16 : UCPTRIE_VALUE_BITS_32;
+    } else {
+        mutableTrie.adoptInstead(umutablecptrie_open(0, 0, &errorCode));
+        if (U_FAILURE(errorCode)) { return nullptr; }
+        for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+            int32_t delta = getSimpleMapping(prop, c) - c;
+            if (delta != 0) {
+                umutablecptrie_set(mutableTrie.getAlias(), c, (uint32_t)delta, &errorCode);
+            }
+        }
+        valueWidth = UCPTRIE_VALUE_BITS_32;
+    }
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    return umutablecptrie_buildImmutable(mutableTrie.getAlias(), UCPTRIE_TYPE_FAST, valueWidth,
+                                         &errorCode);
+}
+
+/** "White_Space" -> "WhiteSpace"; with lowerFirst: "whiteSpace". */
+std::string toIdentifier(const char *longName, bool lowerFirst) {
+    std::string id;
+    for (const char *p = longName; *p != 0; ++p) {
+        if (*p != '_') {
+            id.push_back(*p);
+        }
+    }
+    if (lowerFirst && !id.empty()) {
+        id[0] = uprv_asciitolower(id[0]);
+    }
+    return id;
+}
+
+const char *getTypeName(int32_t valueWidth) {
+    switch (valueWidth) {
+    case UCPTRIE_VALUE_BITS_8:
+        return "uint8_t";
+    case UCPTRIE_VALUE_BITS_16:
+        return "uint16_t";
+    default:
+        return "uint32_t";
+    }
+}
+
+// Written once per header. Constants from ucptrie_impl.h, for the fast trie type:
+// UCPTRIE_FAST_SHIFT=6, UCPTRIE_SHIFT_1/2/3=14/9/4,
+// UCPTRIE_BMP_INDEX_LENGTH-UCPTRIE_OMITTED_BMP_INDEX_1_LENGTH=1020,
+// UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET=2 and UCPTRIE_ERROR_VALUE_NEG_DATA_OFFSET=1.
+const char *const lookupFunctions =
+    "// Same lookup as UCPTRIE_FAST_GET() for a UCPTRIE_TYPE_FAST trie,\n"
+    "// with single-return-statement functions so that they are C++11 constexpr.\n"
+    "constexpr int32_t dataBlock18(const uint16_t *index, int32_t i3Block, int32_t i3) {\n"
+    "    return ((int32_t(index[i3Block]) << (2 + 2 * i3)) & 0x30000) | index[i3Block + 1 + i3];\n"
+    "}\n"
+    "\n"
+    "constexpr int32_t dataBlock(const uint16_t *index, int32_t i3Block, int32_t i3) {\n"
+    "    return (i3Block & 0x8000) == 0 ? index[i3Block + i3] :\n"
+    "        dataBlock18(index, (i3Block & 0x7fff) + (i3 & ~7) + (i3 >> 3), i3 & 7);\n"
+    "}\n"
+    "\n"
+    "constexpr int32_t supplementaryIndex(const uint16_t *index, int32_t c) {\n"
+    "    return dataBlock(index, index[index[(c >> 14) + 1020] + ((c >> 9) & 0x1f)], (c >> 4) & 0x1f) +\n"
+    "        (c & 0xf);\n"
+    "}\n"
+    "\n"
+    "constexpr int32_t cpIndex(const uint16_t *index, int32_t dataLength, int32_t highStart, int32_t c) {\n"
+    "    return uint32_t(c) <= 0xffff ? index[c >> 6] + (c & 0x3f) :\n"
+    "        uint32_t(c) <= 0x10ffff ?\n"
+    "            (c >= highStart ? dataLength - 2 : supplementaryIndex(index, c)) :\n"
+    "            dataLength - 1;\n"
+    "}\n\n";
+
+void writeTrieArrays(FILE *f, const std::string &name, const UCPTrie *trie) {
+    std::string prefix = "constexpr uint16_t " + name + "_index[%ld]={\n";
+    usrc_writeArray(f, prefix.c_str(), trie->index, 16, trie->indexLength, "\n};\n\n");
+    prefix = std::string("constexpr ") + getTypeName(trie->valueWidth) + " " + name + "_data[%ld]={\n";
+    const void *data;
+    int32_t width;
+    switch (trie->valueWidth) {
+    case UCPTRIE_VALUE_BITS_8:
+        data = trie->data.ptr8;
+        width = 8;
+        break;
+    case UCPTRIE_VALUE_BITS_16:
+        data = trie->data.ptr16;
+        width = 16;
+        break;
+    default:
+        data = trie->data.ptr32;
+        width = 32;
+        break;
+    }
+    usrc_writeArray(f, prefix.c_str(), data, width, trie->dataLength, "\n};\n\n");
+}
+
+void writeLookupFunction(FILE *f, UProperty prop, PropertyKind kind,
+                         const std::string &name, const UCPTrie *trie) {
+    const char *longName = u_getPropertyName(prop, U_LONG_PROPERTY_NAME);
+    const char *shortName = u_getPropertyName(prop, U_SHORT_PROPERTY_NAME);
+    char lookup[300];
+    sprintf(lookup, "detail::%s_data[detail::cpIndex(detail::%s_index, %ld, 0x%lx, c)]",
+            name.c_str(), name.c_str(), (long)trie->dataLength, (long)trie->highStart);
+    switch (kind) {
+    case KIND_BINARY:
+        fprintf(f,
+                "/** @return true if code point c has the binary property %s (%s). */\n"
+                "constexpr bool is%s(int32_t c) {\n"
+                "    return %s != 0;\n"
+                "}\n\n",
+                longName, shortName, toIdentifier(longName, false).c_str(), lookup);
+        break;
+    case KIND_INT:
+        fprintf(f,
+                "/** @return the %s (%s) property value of code point c, as in u_getIntPropertyValue(). */\n"
+                "constexpr int32_t %s(int32_t c) {\n"
+                "    return %s;\n"
+                "}\n\n",
+                longName, shortName, name.c_str(), lookup);
+        break;
+    case KIND_MAPPING:
+        fprintf(f,
+                "/** @return the %s (%s) of code point c. */\n"
+                "constexpr int32_t %s(int32_t c) {\n"
+                "    return c + int32_t(%s);\n"
+                "}\n\n",
+                longName, shortName, name.c_str(), lookup);
+        break;
+    }
+}
+
+/** Closes and deletes a partially written output file, so that no truncated header is left. */
+void removeOutputFile(FILE *f, const std::string &path) {
+    fclose(f);
+    if(remove(path.c_str())!=0) {
+        fprintf(stderr, "genprophdr: unable to remove the partial output file %s\n", path.c_str());
+    }
+}
+
+}  // namespace
+
+extern "C" int
+main(int argc, char* argv[]) {
+    U_MAIN_INIT_ARGS(argc, argv);
+
+    /* preset then read command line options */
+    options[DESTDIR].value=".";
+    options[NAMESPACE].value="uprops";
+    argc=u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+
+    /* error handling, printing usage message */
+    if(argc<0) {
+        fprintf(stderr,
+            "error in command line argument \"%s\"\n",
+            argv[-argc]);
+    }
+    if(!options[OUTPUT_FILENAME].doesOccur) {
+        argc=-1;
+    }
+    if( argc<2 ||
+        options[HELP_H].doesOccur || options[HELP_QUESTION_MARK].doesOccur
+    ) {
+        fprintf(stderr,
+            "Usage: %s [-options] -o filename.h properties+\n"
+            "\n"
+            "Writes a standalone C++11 header file with constexpr UCPTrie arrays\n"
+            "and constexpr lookup functions for the given Unicode properties,\n"
+            "for code that must not depend on the ICU libraries or data at runtime.\n"
+            "Properties are given by their long or short names, e.g. gc WSpace Alpha sc scf.\n"
+            "Supported are binary properties, enumerated/int properties, and the\n"
+            "simple case mappings scf, slc, suc and stc.\n"
+            "\n",
+            argv[0]);
+        fprintf(stderr,
+            "Options:\n"
+            "\t-h or -? or --help  this usage text\n"
+            "\t-v or --verbose     verbose output\n"
+            "\t-d or --destdir     destination directory, followed by the path\n"
+            "\t-o or --output      output filename\n"
+            "\t-n or --namespace   C++ namespace for the lookup functions (default: uprops)\n");
+        return argc<0 ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
+    }
+
+    beVerbose=options[VERBOSE].doesOccur;
+
+    // Resolve the property names before writing anything.
+    std::vector<UProperty> props;
+    for(int i=1; i<argc; ++i) {
+        UProperty prop=u_getPropertyEnum(argv[i]);
+        if(!((UCHAR_BINARY_START<=prop && prop<UCHAR_BINARY_LIMIT) ||
+                (UCHAR_INT_START<=prop && prop<UCHAR_INT_LIMIT) ||
+                prop==UCHAR_SIMPLE_CASE_FOLDING || prop==UCHAR_SIMPLE_LOWERCASE_MAPPING ||
+                prop==UCHAR_SIMPLE_UPPERCASE_MAPPING || prop==UCHAR_SIMPLE_TITLECASE_MAPPING)) {
+            fprintf(stderr, "genprophdr: unknown or unsupported property \"%s\"\n", argv[i]);
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        props.push_back(prop);
+    }
+
+    const char *filename=options[OUTPUT_FILENAME].value;
+    FILE *f=usrc_create(options[DESTDIR].value, filename, 2018, "icu/tools/genprophdr/genprophdr.cpp");
+    if(f==NULL) {
+        return U_FILE_ACCESS_ERROR;
+    }
+    // Same path as usrc_create() opened, for removing the file on failure.
+    std::string path(options[DESTDIR].value);
+    if(!path.empty() && path.back()!=U_FILE_SEP_CHAR && path.back()!=U_FILE_ALT_SEP_CHAR) {
+        path.push_back(U_FILE_SEP_CHAR);
+    }
+    path.append(filename);
+
+    std::string guard;
+    for(const char *p=findBasename(filename); *p!=0; ++p) {
+        guard.push_back(uprv_isASCIILetter(*p) || ('0'<=*p && *p<='9') ? uprv_toupper(*p) : '_');
+    }
+    UVersionInfo version;
+    char versionString[U_MAX_VERSION_STRING_LENGTH];
+    u_getUnicodeVersion(version);
+    u_versionToString(version, versionString);
+    const char *ns=options[NAMESPACE].value;
+    fprintf(f,
+            "// Unicode %s property lookup functions for:", versionString);
+    for(UProperty prop : props) {
+        fprintf(f, " %s", u_getPropertyName(prop, U_SHORT_PROPERTY_NAME));
+    }
+    fprintf(f,
+            "\n"
+            "// The lookup functions are constexpr and need no runtime initialization.\n"
+            "// The constexpr arrays have internal linkage: Include this header\n"
+            "// in only one translation unit to avoid duplicating the data.\n"
+            "\n"
+            "#ifndef %s\n"
+            "#define %s\n"
+            "\n"
+            "#include <stdint.h>\n"
+            "\n"
+            "namespace %s {\n"
+            "\n"
+            "namespace detail {\n"
+            "\n",
+            guard.c_str(), guard.c_str(), ns);
+    fputs(lookupFunctions, f);
+
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t propsLength=(int32_t)props.size();
+    std::vector<LocalUCPTriePointer> tries(propsLength);
+    std::vector<std::string> names(propsLength);
+    for(int32_t i=0; i<propsLength; ++i) {
+        UProperty prop=props[i];
+        tries[i].adoptInstead(buildTrie(prop, getKind(prop), errorCode));
+        if(U_FAILURE(errorCode)) {
+            fprintf(stderr, "genprophdr: error building the trie for %s - %s\n",
+                    argv[i+1], u_errorName(errorCode));
+            removeOutputFile(f, path);
+            return errorCode;
+        }
+        names[i]=toIdentifier(u_getPropertyName(prop, U_LONG_PROPERTY_NAME), true);
+        if(beVerbose) {
+            printf("%s: UCPTrie index length %ld, data length %ld (%s values)\n",
+                   names[i].c_str(), (long)tries[i]->indexLength, (long)tries[i]->dataLength,
+                   getTypeName(tries[i]->valueWidth));
+        }
+        writeTrieArrays(f, names[i], tries[i].getAlias());
+    }
+    fputs("}  // namespace detail\n\n", f);
+    for(int32_t i=0; i<propsLength; ++i) {
+        writeLookupFunction(f, props[i], getKind(props[i]), names[i], tries[i].getAlias());
+    }
+    fprintf(f,
+            "}  // namespace %s\n"
+            "\n"
+            "#endif  // %s\n",
+            ns, guard.c_str());
+    if(ferror(f)) {
+        fprintf(stderr, "genprophdr: error writing %s\n", path.c_str());
+        removeOutputFile(f, path);
+        return U_FILE_ACCESS_ERROR;
+    }
+    if(fclose(f)!=0) {
+        fprintf(stderr, "genprophdr: error writing %s\n", path.c_str());
+        remove(path.c_str());
+        return U_FILE_ACCESS_ERROR;
+    }
+    return 0;
+}
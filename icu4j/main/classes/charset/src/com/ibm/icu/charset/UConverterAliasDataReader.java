@@ -147,7 +147,14 @@ protected UConverterAliasDataReader(ByteBuffer bytes)
     protected int[] readToc(int n)throws IOException
     {
         //Read the toc
-        return ICUBinary.getInts(byteBuffer, n, 0);
+        int[] toc = ICUBinary.getInts(byteBuffer, n, 0);
+        //Skip the lengths of optional sections that are not read here,
+        //such as the perfect-hash index, so that the buffer is positioned
+        //at the first section.
+        if (toc[0] >= n) {
+            ICUBinary.skipBytes(byteBuffer, (toc[0] - (n - 1)) * 4);
+        }
+        return toc;
     }
 
     @Override
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include "unicode/utypes.h"
 #include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
 #include "cmemory.h"
 #include "cstring.h"
@@ -187,6 +188,7 @@ class BiDiPropsBuilder : public PropsBuilder {
 
     UnicodeSet relevantProps;
     UTrie2 *pTrie;
+    UCPTrie *ucpTrie;
     uint8_t jgArray[MAX_JG_LIMIT-MIN_JG_START];
     uint8_t jgArray2[MAX_JG_LIMIT2-MIN_JG_START2];
     uint32_t mirrors[UBIDI_MAX_MIRROR_INDEX+1][2];
@@ -194,7 +196,7 @@ class BiDiPropsBuilder : public PropsBuilder {
 };
 
 BiDiPropsBuilder::BiDiPropsBuilder(UErrorCode &errorCode)
-        : pTrie(NULL),
+        : pTrie(NULL), ucpTrie(NULL),
           mirrorTop(0) {
     // This builder encodes the following properties.
     relevantProps.
@@ -216,6 +218,7 @@ BiDiPropsBuilder::BiDiPropsBuilder(UErrorCode &errorCode)
 
 BiDiPropsBuilder::~BiDiPropsBuilder() {
     utrie2_close(pTrie);
+    ucptrie_close(ucpTrie);
 }
 
 void
@@ -426,6 +429,10 @@ BiDiPropsBuilder::build(UErrorCode &errorCode) {
                 u_errorName(errorCode), (long)trieSize);
         return;
     }
+    // The bidi algorithm looks up every character: Use the fast trie type.
+    ucpTrie=buildUCPTrieFromUTrie2("bidi", pTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                   errorCode);
+    if(U_FAILURE(errorCode)) { return; }
 
     // Finish jgArray & jgArray2.
     UChar32 jgStart;  // First code point with a Joining_Group, first range.
@@ -515,9 +522,10 @@ BiDiPropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "static const int32_t ubidi_props_indexes[UBIDI_IX_TOP]={",
         indexes, 32, UBIDI_IX_TOP,
         "};\n\n");
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t ubidi_props_trieIndex[%ld]={\n", NULL,
-        pTrie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t ubidi_props_trieIndex[%ld]={\n",
+        "static const uint16_t ubidi_props_trieData[%ld]={\n",
+        ucpTrie,
         "\n};\n\n");
     usrc_writeArray(f,
         "static const uint32_t ubidi_props_mirrors[%ld]={\n",
@@ -543,9 +551,9 @@ BiDiPropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "  ubidi_props_jgArray,\n"
         "  ubidi_props_jgArray2,\n",
         f);
-    usrc_writeUTrie2Struct(f,
+    usrc_writeUCPTrieStruct(f,
         "  {\n",
-        pTrie, "ubidi_props_trieIndex", NULL,
+        ucpTrie, "ubidi_props_trieIndex", "ubidi_props_trieData",
         "  },\n");
     usrc_writeArray(f, "  { ", dataInfo.formatVersion, 8, 4, " }\n");
     fputs("};\n\n"
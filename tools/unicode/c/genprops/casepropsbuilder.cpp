@@ -24,6 +24,7 @@
 #include "unicode/utypes.h"
 #include "unicode/localpointer.h"
 #include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
 #include "unicode/udata.h"
 #include "unicode/uniset.h"
 #include "unicode/usetiter.h"
@@ -304,10 +305,12 @@ class CasePropsBuilder : public PropsBuilder {
     /* becomes indexes[UCASE_IX_MAX_FULL_LENGTH] */
     int32_t maxFullLength;
     UTrie2 *pTrie;
+    UCPTrie *ucpTrie;
 };
 
 CasePropsBuilder::CasePropsBuilder(UErrorCode &errorCode)
-        : excProps(NULL), excPropsCount(0), maxFullLength(U16_MAX_LENGTH), pTrie(NULL) {
+        : excProps(NULL), excPropsCount(0), maxFullLength(U16_MAX_LENGTH),
+          pTrie(NULL), ucpTrie(NULL) {
     // This builder encodes the following properties.
     relevantProps.
         add(UCHAR_CANONICAL_COMBINING_CLASS).  // 0 vs. 230 vs. other
@@ -350,6 +353,7 @@ CasePropsBuilder::CasePropsBuilder(UErrorCode &errorCode)
 
 CasePropsBuilder::~CasePropsBuilder() {
     utrie2_close(pTrie);
+    ucptrie_close(ucpTrie);
     for(int32_t i=0; i<excPropsCount; ++i) {
         delete excProps[i];
     }
@@ -1160,6 +1164,10 @@ CasePropsBuilder::build(UErrorCode &errorCode) {
                 u_errorName(errorCode), (long)trieSize);
         return;
     }
+    // Case mapping is performance-critical: Use the fast trie type.
+    ucpTrie=buildUCPTrieFromUTrie2("case", pTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                   errorCode);
+    if(U_FAILURE(errorCode)) { return; }
 
     indexes[UCASE_IX_EXC_LENGTH]=exceptions.length();
     indexes[UCASE_IX_TRIE_SIZE]=trieSize;
@@ -1196,9 +1204,10 @@ CasePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "static const int32_t ucase_props_indexes[UCASE_IX_TOP]={",
         indexes, 32, UCASE_IX_TOP,
         "};\n\n");
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t ucase_props_trieIndex[%ld]={\n", NULL,
-        pTrie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t ucase_props_trieIndex[%ld]={\n",
+        "static const uint16_t ucase_props_trieData[%ld]={\n",
+        ucpTrie,
         "\n};\n\n");
     usrc_writeArray(f,
         "static const uint16_t ucase_props_exceptions[%ld]={\n",
@@ -1215,9 +1224,9 @@ CasePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "  ucase_props_exceptions,\n"
         "  ucase_props_unfold,\n",
         f);
-    usrc_writeUTrie2Struct(f,
+    usrc_writeUCPTrieStruct(f,
         "  {\n",
-        pTrie, "ucase_props_trieIndex", NULL,
+        ucpTrie, "ucase_props_trieIndex", "ucase_props_trieData",
         "  },\n");
     usrc_writeArray(f, "  { ", dataInfo.formatVersion, 8, 4, " }\n");
     fputs("};\n\n"
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include "unicode/utypes.h"
 #include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
 #include "unicode/udata.h"
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
@@ -308,12 +309,14 @@ class CorePropsBuilder : public PropsBuilder {
 
     UTrie2 *pTrie;
     UTrie2 *props2Trie;
+    UCPTrie *ucpTrie;
+    UCPTrie *props2UCPTrie;
     UPropsVectors *pv;
     UnicodeString scriptExtensions;
 };
 
 CorePropsBuilder::CorePropsBuilder(UErrorCode &errorCode)
-        : pTrie(NULL), props2Trie(NULL), pv(NULL) {
+        : pTrie(NULL), props2Trie(NULL), ucpTrie(NULL), props2UCPTrie(NULL), pv(NULL) {
     pTrie=utrie2_open(0, 0, &errorCode);
     if(U_FAILURE(errorCode)) {
         fprintf(stderr, "genprops error: corepropsbuilder utrie2_open() failed - %s\n",
@@ -329,6 +332,8 @@ CorePropsBuilder::CorePropsBuilder(UErrorCode &errorCode)
 CorePropsBuilder::~CorePropsBuilder() {
     utrie2_close(pTrie);
     utrie2_close(props2Trie);
+    ucptrie_close(ucpTrie);
+    ucptrie_close(props2UCPTrie);
     upvec_close(pv);
 }
 
@@ -775,6 +780,15 @@ CorePropsBuilder::build(UErrorCode &errorCode) {
         return;
     }
 
+    // Use the fast trie type for both tries.
+    // The small type would save about 7kB for the properties vectors trie
+    // but make lookups slower for most of the BMP, for example script lookups for CJK.
+    ucpTrie=buildUCPTrieFromUTrie2("props", pTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                   errorCode);
+    props2UCPTrie=buildUCPTrieFromUTrie2("propsVectors", props2Trie,
+                                         UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+
     int32_t pvRows;
     const uint32_t *pvArray=upvec_getArray(pv, &pvRows, NULL);
     int32_t pvCount=pvRows*UPROPS_VECTOR_WORDS;
@@ -844,22 +858,24 @@ CorePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "static const UVersionInfo dataVersion={",
         dataInfo.dataVersion, 8, 4,
         "};\n\n");
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t propsTrie_index[%ld]={\n", NULL,
-        pTrie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t propsTrie_index[%ld]={\n",
+        "static const uint16_t propsTrie_data[%ld]={\n",
+        ucpTrie,
         "\n};\n\n");
-    usrc_writeUTrie2Struct(f,
-        "static const UTrie2 propsTrie={\n",
-        pTrie, "propsTrie_index", NULL,
+    usrc_writeUCPTrieStruct(f,
+        "static const UCPTrie propsTrie={\n",
+        ucpTrie, "propsTrie_index", "propsTrie_data",
         "};\n\n");
 
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t propsVectorsTrie_index[%ld]={\n", NULL,
-        props2Trie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t propsVectorsTrie_index[%ld]={\n",
+        "static const uint16_t propsVectorsTrie_data[%ld]={\n",
+        props2UCPTrie,
         "\n};\n\n");
-    usrc_writeUTrie2Struct(f,
-        "static const UTrie2 propsVectorsTrie={\n",
-        props2Trie, "propsVectorsTrie_index", NULL,
+    usrc_writeUCPTrieStruct(f,
+        "static const UCPTrie propsVectorsTrie={\n",
+        props2UCPTrie, "propsVectorsTrie_index", "propsVectorsTrie_data",
         "};\n\n");
 
     usrc_writeArray(f,
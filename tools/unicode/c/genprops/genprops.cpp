@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include "unicode/utypes.h"
 #include "unicode/localpointer.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "charstr.h"
@@ -47,6 +48,59 @@ void PropsBuilder::writeCSourceFile(const char *, UErrorCode &) {}
 void PropsBuilder::writeJavaSourceFile(const char *, UErrorCode &) {}
 void PropsBuilder::writeBinaryData(const char *, UBool, UErrorCode &) {}
 
+namespace {
+
+struct UTrie2ToUCPTrie {
+    UMutableCPTrie *mutableTrie;
+    UErrorCode errorCode;
+};
+
+UBool U_CALLCONV
+setUCPTrieRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
+    UTrie2ToUCPTrie *converter=(UTrie2ToUCPTrie *)context;
+    umutablecptrie_setRange(converter->mutableTrie, start, end, value, &converter->errorCode);
+    return U_SUCCESS(converter->errorCode);
+}
+
+}  // namespace
+
+UCPTrie *buildUCPTrieFromUTrie2(const char *name, const UTrie2 *trie2,
+                                UCPTrieType type, UCPTrieValueWidth valueWidth,
+                                UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return NULL; }
+    UTrie2ToUCPTrie converter={
+        umutablecptrie_open(trie2->initialValue, trie2->errorValue, &errorCode),
+        U_ZERO_ERROR
+    };
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "genprops error: umutablecptrie_open(%s) failed - %s\n",
+                name, u_errorName(errorCode));
+        return NULL;
+    }
+    utrie2_enum(trie2, NULL, setUCPTrieRange, &converter);
+    UCPTrie *trie=NULL;
+    if(U_SUCCESS(converter.errorCode)) {
+        trie=umutablecptrie_buildImmutable(converter.mutableTrie, type, valueWidth,
+                                           &converter.errorCode);
+    }
+    umutablecptrie_close(converter.mutableTrie);
+    if(U_FAILURE(converter.errorCode)) {
+        fprintf(stderr, "genprops error: unable to build the %s UCPTrie - %s\n",
+                name, u_errorName(converter.errorCode));
+        errorCode=converter.errorCode;
+        return NULL;
+    }
+    if(!beQuiet) {
+        UErrorCode overflow=U_ZERO_ERROR;
+        int32_t length=ucptrie_toBinary(trie, NULL, 0, &overflow);
+        UErrorCode overflow2=U_ZERO_ERROR;
+        int32_t length2=utrie2_serialize(trie2, NULL, 0, &overflow2);
+        printf("%11s UCPTrie size in bytes: %5d (UTrie2: %5d)\n",
+               name, (int)length, (int)length2);
+    }
+    return trie;
+}
+
 enum {
     HELP_H,
     HELP_QUESTION_MARK,
@@ -21,9 +21,11 @@
 
 #include <stdio.h>
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
 #include "ppucd.h"
 #include "unewdata.h"
+#include "utrie2.h"
 
 #define LENGTHOF(array) (int32_t)(sizeof(array)/sizeof((array)[0]))
 
@@ -53,6 +55,15 @@ PropsBuilder *createCasePropsBuilder(UErrorCode &errorCode);
 PropsBuilder *createLayoutPropsBuilder(UErrorCode &errorCode);
 PropsBuilder *createNamesPropsBuilder(UErrorCode &errorCode);
 
+/**
+ * Builds a UCPTrie with the same values as the frozen UTrie2.
+ * The runtime C source data uses UCPTrie,
+ * while the .icu data files (also read by ICU4J) keep the UTrie2.
+ */
+UCPTrie *buildUCPTrieFromUTrie2(const char *name, const UTrie2 *trie2,
+                                UCPTrieType type, UCPTrieValueWidth valueWidth,
+                                UErrorCode &errorCode);
+
 /* global flags */
 extern UBool beVerbose;
 extern UBool beQuiet;